@@ -72,21 +72,23 @@ int main()
     std::cout << "Date,30-Day Moving Average\n";
 
     size_t loop_count = 0; // Trivial counter to ensure this ran in the CI
-    for (size_t i = window_size - 1; i < stock_data.size(); ++i)
+
+    // The window keeps the exact sum of its values, updating it as each day enters and the oldest one leaves
+    rolling_window<decimal64_t> window(window_size);
+    for (const auto& day : stock_data)
     {
-        decimal64_t sum(0);
+        window.push(day.close);
 
-        // Calculate sum for the window
-        for (size_t j = 0; j < window_size; ++j)
+        if (!window.full())
         {
-            sum += stock_data[i - j].close;
+            continue;
         }
 
         // Calculate average
-        decimal64_t moving_avg = sum / decimal64_t(window_size);
+        decimal64_t moving_avg = window.mean();
 
         // Print result
-        std::cout << stock_data[i].date << ","
+        std::cout << day.date << ","
                   << std::fixed << std::setprecision(2) << moving_avg << "\n";
 
         ++loop_count;
@@ -100,6 +100,12 @@ int main()
     const auto variance_closing_price = boost::math::statistics::variance(closing_prices);
     const auto std_dev_closing_price = sqrt(variance_closing_price);
 
+    // The same mean and variance from sums that are exact until their final rounding,
+    // which do not depend on the order of the prices and can be split between threads
+    const decimal64_t count {closing_prices.size()};
+    const auto exact_mean = reduce(closing_prices.data(), closing_prices.size()) / count;
+    const auto exact_variance = sum_of_squares(closing_prices.data(), closing_prices.size()) / count - exact_mean * exact_mean;
+
     // 2-Sigma Bollinger Bands
     const auto upper_band = mean_closing_price + 2 * std_dev_closing_price;
     const auto lower_band = mean_closing_price - 2 * std_dev_closing_price;
@@ -108,7 +114,9 @@ int main()
               << "  Mean Closing Price: " << mean_closing_price << '\n'
               << "  Standard Deviation: " << std_dev_closing_price << '\n'
               << "Upper Bollinger Band: " << upper_band << '\n'
-              << "Lower Bollinger Band: " << lower_band << std::endl;
+              << "Lower Bollinger Band: " << lower_band << '\n'
+              << "       Mean (reduce): " << exact_mean << '\n'
+              << "   Variance (reduce): " << exact_variance << std::endl;
 
     //   Mean = 207.21
     // Median = 214.27
@@ -42,7 +42,17 @@
 #include <boost/decimal/cstdio.hpp>
 #include <boost/decimal/bid_conversion.hpp>
 #include <boost/decimal/dpd_conversion.hpp>
+#include <boost/decimal/arrow.hpp>
+#include <boost/decimal/ordered_key.hpp>
+#include <boost/decimal/sort.hpp>
 #include <boost/decimal/string.hpp>
+#include <boost/decimal/batch.hpp>
+#include <boost/decimal/decimal_column.hpp>
+#include <boost/decimal/fixed_decimal.hpp>
+#include <boost/decimal/decimal_accumulator.hpp>
+#include <boost/decimal/reduce.hpp>
+#include <boost/decimal/rolling_window.hpp>
+#include <boost/decimal/fused_expression.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <boost/decimal/fmt_format.hpp>
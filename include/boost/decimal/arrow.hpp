@@ -0,0 +1,457 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_ARROW_HPP
+#define BOOST_DECIMAL_ARROW_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal128_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/fixed_decimal.hpp>
+#include <boost/decimal/detail/cmath/frexp10.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/u256.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#endif
+
+// Conversions to and from the columns of Apache Arrow decimal128(precision, scale) and decimal256(precision, scale) arrays.
+// Only the memory layout of the arrays is used, so there is no dependency on the Arrow libraries:
+// the value of element i is values[i] * 10^-scale where values[i] is a 16 or 32 byte two's complement integer in
+// the byte order of the platform, and bit i % 8 of byte i / 8 of the validity bitmap is set if element i is not null.
+
+namespace boost {
+namespace decimal {
+
+// One element of the values buffer of a decimal256 array
+BOOST_DECIMAL_EXPORT struct arrow_int256_t
+{
+    std::uint64_t words[4];
+};
+
+// Result of writing many values to an Arrow array in one call
+BOOST_DECIMAL_EXPORT struct arrow_conversion_result
+{
+    // Number of elements that were written as null, including those in error
+    std::size_t null_count;
+
+    // Number of values that were infinite or had more than precision digits after rounding to scale,
+    // and the index of the first one. first_error is n if there were no errors
+    std::size_t error_count;
+    std::size_t first_error;
+
+    constexpr explicit operator bool() const noexcept { return error_count == 0U; }
+};
+
+namespace detail {
+
+// The words of arrow_int256_t from least to most significant
+constexpr auto arrow_word_index(const std::size_t i) noexcept -> std::size_t
+{
+    #if BOOST_DECIMAL_ENDIAN_LITTLE_BYTE
+    return i;
+    #else
+    return 3U - i;
+    #endif
+}
+
+constexpr auto arrow_is_valid(const std::uint8_t* validity, const std::size_t i) noexcept -> bool
+{
+    return validity == nullptr || ((validity[i / 8U] >> (i % 8U)) & 1U) != 0U;
+}
+
+constexpr auto arrow_load(const arrow_int256_t& val) noexcept -> u256
+{
+    u256 res {};
+    for (std::size_t i {}; i < 4U; ++i)
+    {
+        res[i] = val.words[arrow_word_index(i)];
+    }
+
+    return res;
+}
+
+constexpr auto arrow_store(arrow_int256_t& val, const u256& x) noexcept -> void
+{
+    for (std::size_t i {}; i < 4U; ++i)
+    {
+        val.words[arrow_word_index(i)] = x[i];
+    }
+}
+
+// Negates in place, one word at a time with the carry of the + 1
+constexpr auto arrow_negate(u256& val) noexcept -> void
+{
+    bool carry {true};
+    for (std::size_t i {}; i < 4U; ++i)
+    {
+        val[i] = ~val[i] + static_cast<std::uint64_t>(carry);
+        carry = carry && val[i] == 0U;
+    }
+}
+
+// Rounds mag * 10^exp to the precision of DecimalType in the current rounding mode.
+// sticky records that nonzero digits were already removed from mag
+template <typename DecimalType>
+constexpr auto arrow_make_decimal(int128::uint128_t mag, int exp, const bool is_neg, bool sticky) noexcept -> DecimalType
+{
+    constexpr int target_digits {precision_v<DecimalType>};
+
+    auto digits {num_digits(mag)};
+    if (digits > target_digits + 1)
+    {
+        const auto digits_to_remove {digits - (target_digits + 1)};
+        const auto shifted {div_pow10(mag, digits_to_remove)};
+        sticky = sticky || shifted * pow10(static_cast<int128::uint128_t>(digits_to_remove)) != mag;
+        mag = shifted;
+        exp += digits_to_remove;
+        digits = target_digits + 1;
+    }
+
+    if (digits > target_digits)
+    {
+        // max_significand_v<decimal128_t> is below 10^34 - 1, which would remove a second digit from most values,
+        // so round against decimal_fast128_t instead as it has the same precision
+        using rounding_type = std::conditional_t<std::is_same<DecimalType, decimal128_t>::value, decimal_fast128_t, DecimalType>;
+        exp += fenv_round<rounding_type>(mag, is_neg, sticky);
+    }
+
+    return DecimalType{mag, exp, is_neg};
+}
+
+template <typename DecimalType>
+constexpr auto arrow_make_decimal(u256 mag, const int exp, const bool is_neg) noexcept -> DecimalType
+{
+    if (mag[2] == 0U && mag[3] == 0U)
+    {
+        return arrow_make_decimal<DecimalType>(int128::uint128_t{mag[1], mag[0]}, exp, is_neg, false);
+    }
+
+    // Keeps one digit more than DecimalType, which is then rounded as above
+    const auto digits_to_remove {num_digits(mag) - (precision_v<DecimalType> + 1)};
+    const auto& divisor {impl::u256_pow_10[digits_to_remove]};
+    const auto shifted {mag / divisor};
+    const bool sticky {shifted * divisor != mag};
+
+    return arrow_make_decimal<DecimalType>(int128::uint128_t{shifted[1], shifted[0]}, exp + digits_to_remove, is_neg, sticky);
+}
+
+// Computes the magnitude of val * 10^scale rounded to an integer in the current rounding mode.
+// Returns false if val is infinite or the magnitude has more than max_digits digits, and shift is set to the
+// power of ten the returned magnitude must still be multiplied by
+template <typename DecimalType>
+constexpr auto arrow_scaled_magnitude(const DecimalType val, const int max_digits, const int scale,
+                                      int128::uint128_t& mag, int& shift) noexcept -> bool
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (isinf(val))
+    {
+        return false;
+    }
+    #endif
+
+    int exp {};
+    mag = static_cast<int128::uint128_t>(frexp10(val, &exp));
+    shift = exp + scale;
+
+    if (shift < 0)
+    {
+        mag = fixed_decimal_shift_right(mag, -shift, signbit(val), false);
+        shift = 0;
+    }
+    else if (mag == 0U)
+    {
+        shift = 0;
+    }
+
+    return mag == 0U || num_digits(mag) + shift <= max_digits;
+}
+
+// Collects the validity bits of consecutive elements and writes each byte once it is full
+class arrow_bitmap_writer
+{
+    std::uint8_t* validity_;
+    std::uint8_t byte_ {};
+    std::size_t bit_ {};
+
+public:
+    explicit constexpr arrow_bitmap_writer(std::uint8_t* validity) noexcept : validity_ {validity} {}
+
+    constexpr auto push(const bool valid) noexcept -> void
+    {
+        byte_ = static_cast<std::uint8_t>(byte_ | (static_cast<std::uint8_t>(valid) << (bit_ % 8U)));
+        if (++bit_ % 8U == 0U)
+        {
+            validity_[bit_ / 8U - 1U] = byte_;
+            byte_ = 0U;
+        }
+    }
+
+    // Writes the last partial byte, with the unused bits cleared
+    constexpr auto finish() noexcept -> void
+    {
+        if (bit_ % 8U != 0U)
+        {
+            validity_[bit_ / 8U] = byte_;
+        }
+    }
+};
+
+} // namespace detail
+
+// ----- decimal128 arrays -----
+
+// out[i] = values[offset + i] * 10^-scale for i in [0, n), where a null element gives a quiet NaN.
+// validity may be nullptr if the array has no nulls, and offset is that of the array, which applies to both buffers.
+// int128::int128_t has the layout of a native 16 byte integer, so the values buffer of an array can be passed directly.
+// Values with more digits than DecimalType are rounded in the current rounding mode.
+// Returns the number of nulls
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto from_arrow_decimal128(const std::uint8_t* validity, const int128::int128_t* values, DecimalType* out,
+                                     const std::size_t n, const int scale, const std::size_t offset = 0U) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, std::size_t)
+{
+    std::size_t null_count {};
+    for (std::size_t i {}; i < n; ++i)
+    {
+        if (!detail::arrow_is_valid(validity, offset + i))
+        {
+            out[i] = std::numeric_limits<DecimalType>::quiet_NaN();
+            ++null_count;
+            continue;
+        }
+
+        const auto val {values[offset + i]};
+        const bool is_neg {val < 0};
+        auto mag {static_cast<int128::uint128_t>(val)};
+        if (is_neg)
+        {
+            mag = int128::uint128_t{0U} - mag;
+        }
+
+        out[i] = detail::arrow_make_decimal<DecimalType>(mag, -scale, is_neg, false);
+    }
+
+    return null_count;
+}
+
+// Writes values[i] rounded to scale fractional digits in the current rounding mode to out[i] for i in [0, n),
+// and fills the validity bitmap, which must have room for (n + 7) / 8 bytes.
+// NaNs are written as nulls. Infinities, and values that have more than precision digits once rounded,
+// are written as nulls as well and counted as errors. Null elements of out are zero.
+// precision must be in the range [1, 38]
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto to_arrow_decimal128(const DecimalType* values, std::uint8_t* validity, int128::int128_t* out,
+                                   const std::size_t n, const int precision, const int scale) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, arrow_conversion_result)
+{
+    BOOST_DECIMAL_ASSERT(precision >= 1 && precision <= 38);
+
+    arrow_conversion_result res {0U, 0U, n};
+    detail::arrow_bitmap_writer bitmap {validity};
+
+    for (std::size_t i {}; i < n; ++i)
+    {
+        const auto val {values[i]};
+        int128::uint128_t mag {};
+        int shift {};
+
+        #ifndef BOOST_DECIMAL_FAST_MATH
+        if (isnan(val))
+        {
+            out[i] = 0;
+            bitmap.push(false);
+            ++res.null_count;
+            continue;
+        }
+        #endif
+
+        if (!detail::arrow_scaled_magnitude(val, precision, scale, mag, shift))
+        {
+            out[i] = 0;
+            bitmap.push(false);
+            ++res.null_count;
+            res.first_error = res.error_count++ == 0U ? i : res.first_error;
+            continue;
+        }
+
+        mag *= detail::pow10(static_cast<int128::uint128_t>(shift));
+        out[i] = signbit(val) ? -static_cast<int128::int128_t>(mag) : static_cast<int128::int128_t>(mag);
+        bitmap.push(true);
+    }
+
+    bitmap.finish();
+
+    return res;
+}
+
+// ----- decimal256 arrays -----
+
+// Same as from_arrow_decimal128
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto from_arrow_decimal256(const std::uint8_t* validity, const arrow_int256_t* values, DecimalType* out,
+                                     const std::size_t n, const int scale, const std::size_t offset = 0U) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, std::size_t)
+{
+    std::size_t null_count {};
+    for (std::size_t i {}; i < n; ++i)
+    {
+        if (!detail::arrow_is_valid(validity, offset + i))
+        {
+            out[i] = std::numeric_limits<DecimalType>::quiet_NaN();
+            ++null_count;
+            continue;
+        }
+
+        auto mag {detail::arrow_load(values[offset + i])};
+        const bool is_neg {(mag[3] >> 63U) != 0U};
+        if (is_neg)
+        {
+            detail::arrow_negate(mag);
+        }
+
+        out[i] = detail::arrow_make_decimal<DecimalType>(mag, -scale, is_neg);
+    }
+
+    return null_count;
+}
+
+// Same as to_arrow_decimal128, except that precision must be in the range [1, 76]
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto to_arrow_decimal256(const DecimalType* values, std::uint8_t* validity, arrow_int256_t* out,
+                                   const std::size_t n, const int precision, const int scale) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, arrow_conversion_result)
+{
+    BOOST_DECIMAL_ASSERT(precision >= 1 && precision <= 76);
+
+    arrow_conversion_result res {0U, 0U, n};
+    detail::arrow_bitmap_writer bitmap {validity};
+
+    for (std::size_t i {}; i < n; ++i)
+    {
+        const auto val {values[i]};
+        int128::uint128_t mag {};
+        int shift {};
+
+        #ifndef BOOST_DECIMAL_FAST_MATH
+        if (isnan(val))
+        {
+            detail::arrow_store(out[i], detail::u256{});
+            bitmap.push(false);
+            ++res.null_count;
+            continue;
+        }
+        #endif
+
+        if (!detail::arrow_scaled_magnitude(val, precision, scale, mag, shift))
+        {
+            detail::arrow_store(out[i], detail::u256{});
+            bitmap.push(false);
+            ++res.null_count;
+            res.first_error = res.error_count++ == 0U ? i : res.first_error;
+            continue;
+        }
+
+        auto scaled {detail::u256{int128::uint128_t{}, mag} * detail::impl::u256_pow_10[shift]};
+        if (signbit(val))
+        {
+            detail::arrow_negate(scaled);
+        }
+
+        detail::arrow_store(out[i], scaled);
+        bitmap.push(true);
+    }
+
+    bitmap.finish();
+
+    return res;
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+// values must have at least offset + out.size() elements
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto from_arrow_decimal128(const std::uint8_t* validity, std::span<const int128::int128_t> values, std::span<DecimalType> out,
+                                     const int scale, const std::size_t offset = 0U) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, std::size_t)
+{
+    BOOST_DECIMAL_ASSERT(values.size() >= offset + out.size());
+    return from_arrow_decimal128(validity, values.data(), out.data(), out.size(), scale, offset);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto from_arrow_decimal256(const std::uint8_t* validity, std::span<const arrow_int256_t> values, std::span<DecimalType> out,
+                                     const int scale, const std::size_t offset = 0U) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, std::size_t)
+{
+    BOOST_DECIMAL_ASSERT(values.size() >= offset + out.size());
+    return from_arrow_decimal256(validity, values.data(), out.data(), out.size(), scale, offset);
+}
+
+// values and out must have the same extent, and validity must have room for (values.size() + 7) / 8 bytes
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto to_arrow_decimal128(std::span<const DecimalType> values, std::span<std::uint8_t> validity, std::span<int128::int128_t> out,
+                                   const int precision, const int scale) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, arrow_conversion_result)
+{
+    BOOST_DECIMAL_ASSERT(values.size() == out.size());
+    BOOST_DECIMAL_ASSERT(validity.size() >= (values.size() + 7U) / 8U);
+    return to_arrow_decimal128(values.data(), validity.data(), out.data(), values.size(), precision, scale);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto to_arrow_decimal256(std::span<const DecimalType> values, std::span<std::uint8_t> validity, std::span<arrow_int256_t> out,
+                                   const int precision, const int scale) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, arrow_conversion_result)
+{
+    BOOST_DECIMAL_ASSERT(values.size() == out.size());
+    BOOST_DECIMAL_ASSERT(validity.size() >= (values.size() + 7U) / 8U);
+    return to_arrow_decimal256(values.data(), validity.data(), out.data(), values.size(), precision, scale);
+}
+
+// DecimalType cannot be deduced from a span of non-const values for the overloads above.
+// Taking the extent as well keeps these out of overload resolution when DecimalType is given explicitly for a container
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, std::size_t Extent>
+constexpr auto to_arrow_decimal128(std::span<DecimalType, Extent> values, std::span<std::uint8_t> validity, std::span<int128::int128_t> out,
+                                   const int precision, const int scale) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, arrow_conversion_result)
+{
+    BOOST_DECIMAL_ASSERT(values.size() == out.size());
+    BOOST_DECIMAL_ASSERT(validity.size() >= (values.size() + 7U) / 8U);
+    return to_arrow_decimal128(values.data(), validity.data(), out.data(), values.size(), precision, scale);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, std::size_t Extent>
+constexpr auto to_arrow_decimal256(std::span<DecimalType, Extent> values, std::span<std::uint8_t> validity, std::span<arrow_int256_t> out,
+                                   const int precision, const int scale) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, arrow_conversion_result)
+{
+    BOOST_DECIMAL_ASSERT(values.size() == out.size());
+    BOOST_DECIMAL_ASSERT(validity.size() >= (values.size() + 7U) / 8U);
+    return to_arrow_decimal256(values.data(), validity.data(), out.data(), values.size(), precision, scale);
+}
+
+#endif // BOOST_DECIMAL_HAS_STD_SPAN
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_ARROW_HPP
@@ -0,0 +1,350 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_BATCH_HPP
+#define BOOST_DECIMAL_BATCH_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal128_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/detail/cmath/fma.hpp>
+#include <boost/decimal/detail/batch_d32_impl.hpp>
+#include <boost/decimal/detail/add_impl.hpp>
+#include <boost/decimal/detail/mul_impl.hpp>
+#include <boost/decimal/detail/div_impl.hpp>
+#include <boost/decimal/detail/normalize.hpp>
+#include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/config.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// Branch-free version of decimal64_t::to_components
+// The selects compile to conditional moves, which allows the decoding pass to be vectorized
+BOOST_DECIMAL_FORCE_INLINE constexpr auto d64_batch_decode(const std::uint64_t bits) noexcept -> decimal64_t_components
+{
+    constexpr std::uint64_t implied_bit {UINT64_C(0b1000'0000000000'0000000000'0000000000'0000000000'0000000000)};
+
+    const bool big_combination {(bits & d64_combination_field_mask) == d64_combination_field_mask};
+
+    const auto significand {big_combination ? (implied_bit | (bits & d64_11_significand_mask)) :
+                                              (bits & d64_not_11_significand_mask)};
+
+    const auto expval {big_combination ? ((bits & d64_11_exp_mask) >> d64_11_exp_shift) :
+                                         ((bits & d64_not_11_exp_mask) >> d64_not_11_exp_shift)};
+
+    return {significand, static_cast<std::int32_t>(expval) - bias_v<decimal64_t>, (bits & d64_sign_mask) != 0U};
+}
+
+// Each operation provides:
+//   1) scalar: the fallback used for non-finite values and for types without a decoded path
+//   2) admits: whether the decoded components can be passed to the impl directly
+//   3) d64: the decoded path, which is identical to the body of the matching decimal64_t operator
+//   4) d32_simd: the SIMD path for the 32-bit types, which returns the number of elements it computed
+
+struct batch_add_op
+{
+    template <typename DecimalType>
+    static constexpr auto scalar(const DecimalType lhs, const DecimalType rhs) noexcept -> DecimalType
+    {
+        return lhs + rhs;
+    }
+
+    static constexpr auto admits(const decimal64_t_components&, const decimal64_t_components&) noexcept -> bool
+    {
+        return true;
+    }
+
+    static constexpr auto d64(decimal64_t_components lhs, decimal64_t_components rhs) noexcept -> decimal64_t
+    {
+        normalize<decimal64_t>(lhs.sig, lhs.exp);
+        normalize<decimal64_t>(rhs.sig, rhs.exp);
+
+        return d64_add_impl<decimal64_t>(lhs, rhs);
+    }
+
+    template <typename DecimalType>
+    static constexpr auto d32_simd(const DecimalType* lhs, const DecimalType* rhs, DecimalType* result, const std::size_t n) noexcept -> std::size_t
+    {
+        return d32_batch_add_simd(lhs, rhs, result, n);
+    }
+};
+
+struct batch_sub_op
+{
+    template <typename DecimalType>
+    static constexpr auto scalar(const DecimalType lhs, const DecimalType rhs) noexcept -> DecimalType
+    {
+        return lhs - rhs;
+    }
+
+    static constexpr auto admits(const decimal64_t_components&, const decimal64_t_components&) noexcept -> bool
+    {
+        return true;
+    }
+
+    static constexpr auto d64(decimal64_t_components lhs, decimal64_t_components rhs) noexcept -> decimal64_t
+    {
+        normalize<decimal64_t>(lhs.sig, lhs.exp);
+        normalize<decimal64_t>(rhs.sig, rhs.exp);
+        rhs.sign = !rhs.sign;
+
+        return d64_add_impl<decimal64_t>(lhs, rhs);
+    }
+
+    template <typename DecimalType>
+    static constexpr auto d32_simd(const DecimalType*, const DecimalType*, DecimalType*, std::size_t) noexcept -> std::size_t
+    {
+        return 0U;
+    }
+};
+
+struct batch_mul_op
+{
+    template <typename DecimalType>
+    static constexpr auto scalar(const DecimalType lhs, const DecimalType rhs) noexcept -> DecimalType
+    {
+        return lhs * rhs;
+    }
+
+    static constexpr auto admits(const decimal64_t_components&, const decimal64_t_components&) noexcept -> bool
+    {
+        return true;
+    }
+
+    static constexpr auto d64(decimal64_t_components lhs, decimal64_t_components rhs) noexcept -> decimal64_t
+    {
+        normalize<decimal64_t>(lhs.sig, lhs.exp);
+        normalize<decimal64_t>(rhs.sig, rhs.exp);
+
+        return d64_mul_impl<decimal64_t>(lhs, rhs);
+    }
+
+    template <typename DecimalType>
+    static constexpr auto d32_simd(const DecimalType* lhs, const DecimalType* rhs, DecimalType* result, const std::size_t n) noexcept -> std::size_t
+    {
+        return d32_batch_mul_simd(lhs, rhs, result, n);
+    }
+};
+
+struct batch_div_op
+{
+    template <typename DecimalType>
+    static constexpr auto scalar(const DecimalType lhs, const DecimalType rhs) noexcept -> DecimalType
+    {
+        return lhs / rhs;
+    }
+
+    // Division by zero and zero dividends have their own signed results,
+    // so leave them to the operator
+    static constexpr auto admits(const decimal64_t_components& lhs, const decimal64_t_components& rhs) noexcept -> bool
+    {
+        return lhs.sig != 0U && rhs.sig != 0U;
+    }
+
+    static constexpr auto d64(decimal64_t_components lhs, const decimal64_t_components rhs) noexcept -> decimal64_t
+    {
+        const bool sign {lhs.sign != rhs.sign};
+        normalize<decimal64_t>(lhs.sig, lhs.exp);
+
+        return d64_generic_div_impl<decimal64_t>(lhs, rhs, sign);
+    }
+
+    template <typename DecimalType>
+    static constexpr auto d32_simd(const DecimalType*, const DecimalType*, DecimalType*, std::size_t) noexcept -> std::size_t
+    {
+        return 0U;
+    }
+};
+
+template <typename DecimalType>
+using is_batch_d32_type = std::integral_constant<bool, std::is_same<DecimalType, decimal32_t>::value ||
+                                                       std::is_same<DecimalType, decimal_fast32_t>::value>;
+
+// The remaining types have no decoding that could be done a block at a time.
+// decimal_fast64_t in particular is stored decoded, and copying it into blocks is slower than the operators
+template <typename Op, typename DecimalType>
+constexpr auto batch_binary_impl(const DecimalType* lhs, const DecimalType* rhs, DecimalType* result, const std::size_t n) noexcept
+    -> std::enable_if_t<!std::is_same<DecimalType, decimal64_t>::value && !is_batch_d32_type<DecimalType>::value, void>
+{
+    for (std::size_t i {}; i < n; ++i)
+    {
+        result[i] = Op::scalar(lhs[i], rhs[i]);
+    }
+}
+
+// The 32-bit types run full blocks through the SIMD kernels when they are available,
+// and everything else through the scalar operator
+template <typename Op, typename DecimalType>
+constexpr auto batch_binary_impl(const DecimalType* lhs, const DecimalType* rhs, DecimalType* result, const std::size_t n) noexcept
+    -> std::enable_if_t<is_batch_d32_type<DecimalType>::value, void>
+{
+    std::size_t i {};
+
+    if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(n))
+    {
+        i = Op::d32_simd(lhs, rhs, result, n);
+    }
+
+    for (; i < n; ++i)
+    {
+        result[i] = Op::scalar(lhs[i], rhs[i]);
+    }
+}
+
+// decimal64_t has to pay for decoding the BID encoding on every operation.
+// Decode a full block up front with no branches, and only then run the arithmetic
+template <typename Op, typename DecimalType>
+constexpr auto batch_binary_impl(const DecimalType* lhs, const DecimalType* rhs, DecimalType* result, const std::size_t n) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal64_t>::value, void>
+{
+    decimal64_t_components lhs_block[batch_block_size] {};
+    decimal64_t_components rhs_block[batch_block_size] {};
+    bool finite_block[batch_block_size] {};
+
+    std::size_t i {};
+    while (i < n)
+    {
+        const auto block_size {n - i < batch_block_size ? n - i : batch_block_size};
+
+        for (std::size_t j {}; j < block_size; ++j)
+        {
+            const auto lhs_bits {to_bits(lhs[i + j])};
+            const auto rhs_bits {to_bits(rhs[i + j])};
+
+            lhs_block[j] = d64_batch_decode(lhs_bits);
+            rhs_block[j] = d64_batch_decode(rhs_bits);
+
+            #ifndef BOOST_DECIMAL_FAST_MATH
+            finite_block[j] = ((lhs_bits & d64_inf_mask) != d64_inf_mask) & ((rhs_bits & d64_inf_mask) != d64_inf_mask);
+            #else
+            finite_block[j] = true;
+            #endif
+        }
+
+        for (std::size_t j {}; j < block_size; ++j)
+        {
+            if (BOOST_DECIMAL_LIKELY(finite_block[j] && Op::admits(lhs_block[j], rhs_block[j])))
+            {
+                result[i + j] = Op::d64(lhs_block[j], rhs_block[j]);
+            }
+            else
+            {
+                result[i + j] = Op::scalar(lhs[i + j], rhs[i + j]);
+            }
+        }
+
+        i += block_size;
+    }
+}
+
+} // namespace detail
+
+// Element-wise operations over contiguous ranges of n elements: result[i] = lhs[i] op rhs[i]
+// The results are identical to applying the scalar operator to each element.
+// result may alias lhs or rhs, but must not partially overlap either of them.
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto add(const DecimalType* lhs, const DecimalType* rhs, DecimalType* result, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    detail::batch_binary_impl<detail::batch_add_op>(lhs, rhs, result, n);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto sub(const DecimalType* lhs, const DecimalType* rhs, DecimalType* result, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    detail::batch_binary_impl<detail::batch_sub_op>(lhs, rhs, result, n);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto mul(const DecimalType* lhs, const DecimalType* rhs, DecimalType* result, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    detail::batch_binary_impl<detail::batch_mul_op>(lhs, rhs, result, n);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto div(const DecimalType* lhs, const DecimalType* rhs, DecimalType* result, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    detail::batch_binary_impl<detail::batch_div_op>(lhs, rhs, result, n);
+}
+
+// result[i] = fma(x[i], y[i], z[i])
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto fma(const DecimalType* x, const DecimalType* y, const DecimalType* z, DecimalType* result, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    for (std::size_t i {}; i < n; ++i)
+    {
+        result[i] = fma(x[i], y[i], z[i]);
+    }
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+// All spans must have the same extent.
+// DecimalType is deduced from result only, so the inputs may also be spans of non-const values
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto add(std::span<const detail::type_identity_t<DecimalType>> lhs, std::span<const detail::type_identity_t<DecimalType>> rhs, std::span<DecimalType> result) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    BOOST_DECIMAL_ASSERT(lhs.size() == result.size() && rhs.size() == result.size());
+    add(lhs.data(), rhs.data(), result.data(), result.size());
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto sub(std::span<const detail::type_identity_t<DecimalType>> lhs, std::span<const detail::type_identity_t<DecimalType>> rhs, std::span<DecimalType> result) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    BOOST_DECIMAL_ASSERT(lhs.size() == result.size() && rhs.size() == result.size());
+    sub(lhs.data(), rhs.data(), result.data(), result.size());
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto mul(std::span<const detail::type_identity_t<DecimalType>> lhs, std::span<const detail::type_identity_t<DecimalType>> rhs, std::span<DecimalType> result) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    BOOST_DECIMAL_ASSERT(lhs.size() == result.size() && rhs.size() == result.size());
+    mul(lhs.data(), rhs.data(), result.data(), result.size());
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto div(std::span<const detail::type_identity_t<DecimalType>> lhs, std::span<const detail::type_identity_t<DecimalType>> rhs, std::span<DecimalType> result) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    BOOST_DECIMAL_ASSERT(lhs.size() == result.size() && rhs.size() == result.size());
+    div(lhs.data(), rhs.data(), result.data(), result.size());
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto fma(std::span<const detail::type_identity_t<DecimalType>> x, std::span<const detail::type_identity_t<DecimalType>> y, std::span<const detail::type_identity_t<DecimalType>> z, std::span<DecimalType> result) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    BOOST_DECIMAL_ASSERT(x.size() == result.size() && y.size() == result.size() && z.size() == result.size());
+    fma(x.data(), y.data(), z.data(), result.data(), result.size());
+}
+
+#endif // BOOST_DECIMAL_HAS_STD_SPAN
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_BATCH_HPP
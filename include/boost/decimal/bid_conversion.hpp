@@ -12,8 +12,14 @@
 #include <boost/decimal/decimal_fast64_t.hpp>
 #include <boost/decimal/decimal_fast128_t.hpp>
 #include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/config.hpp>
 #include "detail/int128.hpp"
 
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <cstdint>
+#endif
+
 namespace boost {
 namespace decimal {
 
@@ -182,6 +188,91 @@ constexpr auto from_bid<decimal_fast128_t>(const int128::uint128_t bits) noexcep
     return from_bid_d128f(bits);
 }
 
+namespace detail {
+
+// The unsigned integer type that holds the BID or DPD encoding of each decimal type
+template <typename DecimalType>
+struct interchange_bits { using type = void; };
+
+template <>
+struct interchange_bits<decimal32_t> { using type = std::uint32_t; };
+
+template <>
+struct interchange_bits<decimal_fast32_t> { using type = std::uint32_t; };
+
+template <>
+struct interchange_bits<decimal64_t> { using type = std::uint64_t; };
+
+template <>
+struct interchange_bits<decimal_fast64_t> { using type = std::uint64_t; };
+
+template <>
+struct interchange_bits<decimal128_t> { using type = int128::uint128_t; };
+
+template <>
+struct interchange_bits<decimal_fast128_t> { using type = int128::uint128_t; };
+
+template <typename DecimalType>
+using interchange_bits_t = typename interchange_bits<DecimalType>::type;
+
+} // namespace detail
+
+// Bulk conversions over contiguous ranges of n elements: bits[i] = to_bid(values[i]) and values[i] = from_bid(bits[i])
+// For the IEEE types these are plain copies of the storage.
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto to_bid(const DecimalType* values, detail::interchange_bits_t<DecimalType>* bits, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    for (std::size_t i {}; i < n; ++i)
+    {
+        bits[i] = to_bid(values[i]);
+    }
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto from_bid(const detail::interchange_bits_t<DecimalType>* bits, DecimalType* values, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    // Decode to the IEEE type of the same width, which converts exactly to the fast types
+    for (std::size_t i {}; i < n; ++i)
+    {
+        values[i] = static_cast<DecimalType>(from_bid(bits[i]));
+    }
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+// Both spans must have the same extent
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto to_bid(std::span<const DecimalType> values, std::span<detail::interchange_bits_t<DecimalType>> bits) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    BOOST_DECIMAL_ASSERT(values.size() == bits.size());
+    to_bid(values.data(), bits.data(), values.size());
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto from_bid(std::span<const detail::interchange_bits_t<DecimalType>> bits, std::span<DecimalType> values) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    BOOST_DECIMAL_ASSERT(values.size() == bits.size());
+    from_bid(bits.data(), values.data(), values.size());
+}
+
+// DecimalType cannot be deduced from a span of non-const values for to_bid above.
+// Taking the extent as well keeps this out of overload resolution when DecimalType is given explicitly for a container
+BOOST_DECIMAL_EXPORT template <typename DecimalType, std::size_t Extent>
+constexpr auto to_bid(std::span<DecimalType, Extent> values, std::span<detail::interchange_bits_t<DecimalType>> bits) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    BOOST_DECIMAL_ASSERT(values.size() == bits.size());
+    to_bid(values.data(), bits.data(), values.size());
+}
+
+#endif // BOOST_DECIMAL_HAS_STD_SPAN
+
 #if defined(__GNUC__) && __GNUC__ == 7
 #  pragma GCC diagnostic pop
 #endif
@@ -24,22 +24,157 @@ BOOST_DECIMAL_EXPORT enum class rounding_mode : unsigned
     fe_dec_default = fe_dec_to_nearest
 };
 
+#ifndef BOOST_DECIMAL_THREAD_LOCAL_ROUNDING_MODE
+
 BOOST_DECIMAL_INLINE_VARIABLE rounding_mode _boost_decimal_global_rounding_mode {rounding_mode::fe_dec_default};
 
-BOOST_DECIMAL_EXPORT inline auto fegetround() noexcept -> rounding_mode
+namespace detail {
+
+inline auto current_rounding_mode() noexcept -> rounding_mode&
 {
     return _boost_decimal_global_rounding_mode;
 }
 
+} // namespace detail
+
+#else
+
+namespace detail {
+
+// A function local static so that every translation unit shares the same variable in every language standard.
+// It is constant initialized, so reading it does not need a guard
+inline auto current_rounding_mode() noexcept -> rounding_mode&
+{
+    static thread_local rounding_mode thread_rounding_mode {rounding_mode::fe_dec_default};
+    return thread_rounding_mode;
+}
+
+} // namespace detail
+
+#endif // BOOST_DECIMAL_THREAD_LOCAL_ROUNDING_MODE
+
+BOOST_DECIMAL_EXPORT inline auto fegetround() noexcept -> rounding_mode
+{
+    return detail::current_rounding_mode();
+}
+
 // If we can't support constexpr and non-constexpr code paths we won't honor the updated rounding-mode,
 // since it will not be used anyway.
 // Return the default rounding mode
 BOOST_DECIMAL_EXPORT inline auto fesetround(const rounding_mode round) noexcept -> rounding_mode
 {
-    _boost_decimal_global_rounding_mode = round;
+    detail::current_rounding_mode() = round;
     return round;
 }
 
+// Sets the rounding mode for the lifetime of the object, and restores the previous one when it is destroyed
+BOOST_DECIMAL_EXPORT class rounding_scope
+{
+private:
+    rounding_mode previous_;
+
+public:
+    explicit rounding_scope(const rounding_mode round) noexcept : previous_ {fegetround()}
+    {
+        fesetround(round);
+    }
+
+    rounding_scope(const rounding_scope&) = delete;
+    rounding_scope& operator=(const rounding_scope&) = delete;
+
+    ~rounding_scope() noexcept
+    {
+        fesetround(previous_);
+    }
+
+    auto previous() const noexcept -> rounding_mode
+    {
+        return previous_;
+    }
+};
+
+BOOST_DECIMAL_EXPORT enum class exception_flag : unsigned
+{
+    fe_dec_none = 0,
+    fe_dec_invalid = 1 << 0,
+    fe_dec_divbyzero = 1 << 1,
+    fe_dec_overflow = 1 << 2,
+    fe_dec_underflow = 1 << 3,
+    fe_dec_inexact = 1 << 4,
+    fe_dec_all_except = fe_dec_invalid | fe_dec_divbyzero | fe_dec_overflow | fe_dec_underflow | fe_dec_inexact
+};
+
+BOOST_DECIMAL_EXPORT constexpr auto operator|(const exception_flag lhs, const exception_flag rhs) noexcept -> exception_flag
+{
+    return static_cast<exception_flag>(static_cast<unsigned>(lhs) | static_cast<unsigned>(rhs));
+}
+
+BOOST_DECIMAL_EXPORT constexpr auto operator&(const exception_flag lhs, const exception_flag rhs) noexcept -> exception_flag
+{
+    return static_cast<exception_flag>(static_cast<unsigned>(lhs) & static_cast<unsigned>(rhs));
+}
+
+namespace detail {
+
+#ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+
+// The status flags are always per thread, like the floating-point environment of <cfenv>
+inline auto current_exception_flags() noexcept -> unsigned&
+{
+    static thread_local unsigned thread_exception_flags {};
+    return thread_exception_flags;
+}
+
+// Operations evaluated at compile time do not record anything
+BOOST_DECIMAL_FORCE_INLINE constexpr auto raise_exception_flag(const exception_flag flag) noexcept -> void
+{
+    if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(flag))
+    {
+        current_exception_flags() |= static_cast<unsigned>(flag);
+    }
+}
+
+#else
+
+// Flag tracking is compiled out entirely
+BOOST_DECIMAL_FORCE_INLINE constexpr auto raise_exception_flag(const exception_flag) noexcept -> void {}
+
+#endif
+
+} // namespace detail
+
+#ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+
+// Returns which of the requested flags are currently set
+BOOST_DECIMAL_EXPORT inline auto fetestexcept(const exception_flag flags) noexcept -> exception_flag
+{
+    return static_cast<exception_flag>(detail::current_exception_flags()) & flags;
+}
+
+BOOST_DECIMAL_EXPORT inline auto feclearexcept(const exception_flag flags) noexcept -> void
+{
+    detail::current_exception_flags() &= ~static_cast<unsigned>(flags);
+}
+
+BOOST_DECIMAL_EXPORT inline auto feraiseexcept(const exception_flag flags) noexcept -> void
+{
+    detail::current_exception_flags() |= static_cast<unsigned>(flags);
+}
+
+#else
+
+// Without BOOST_DECIMAL_ENABLE_EXCEPTION_FLAGS no flag is ever set
+BOOST_DECIMAL_EXPORT inline auto fetestexcept(const exception_flag) noexcept -> exception_flag
+{
+    return exception_flag::fe_dec_none;
+}
+
+BOOST_DECIMAL_EXPORT inline auto feclearexcept(const exception_flag) noexcept -> void {}
+
+BOOST_DECIMAL_EXPORT inline auto feraiseexcept(const exception_flag) noexcept -> void {}
+
+#endif
+
 } // namespace decimal
 } // namespace boost
 
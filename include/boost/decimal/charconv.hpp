@@ -28,6 +28,7 @@
 #include <boost/decimal/detail/promotion.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
 #include <cstdint>
 #endif
 
@@ -161,6 +162,128 @@ constexpr auto from_chars(std::string_view str, DecimalType& value, std::chars_f
 }
 #endif
 
+// ---------------------------------------------------------------------------------------------------------------------
+// from_chars_bulk and implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+constexpr auto from_chars_bulk_impl(const char* first, const char* last, TargetDecimalType* values, const std::size_t n,
+                                    const char* delimiters, const chars_format fmt, std::uint64_t* error_bits,
+                                    const bool last_chunk) noexcept -> from_chars_bulk_result
+{
+    bool is_delimiter[256] {};
+    for (auto delimiter {delimiters}; *delimiter != '\0'; ++delimiter)
+    {
+        is_delimiter[static_cast<unsigned char>(*delimiter)] = true;
+    }
+
+    from_chars_bulk_result res {first, 0U, 0U, 0U, std::errc()};
+
+    auto field_first {first};
+    std::size_t i {};
+    for (; i < n && field_first < last; ++i)
+    {
+        auto field_last {field_first};
+        while (field_last < last && !is_delimiter[static_cast<unsigned char>(*field_last)])
+        {
+            ++field_last;
+        }
+
+        // Unless this is the last chunk, a field without a delimiter may continue in the next one,
+        // and so may a \r at the very end that would be the first half of \r\n. Leave it for the next call
+        if (!last_chunk && (field_last == last || (*field_last == '\r' && last - field_last == 1 && is_delimiter[static_cast<unsigned char>('\n')])))
+        {
+            break;
+        }
+
+        // Empty fields and trailing characters are errors, and leave a signaling NaN like from_chars does
+        from_chars_result r {field_last, std::errc::invalid_argument};
+        if (field_first == field_last)
+        {
+            values[i] = std::numeric_limits<TargetDecimalType>::signaling_NaN();
+        }
+        else
+        {
+            r = from_chars_general_impl(field_first, field_last, values[i], fmt);
+
+            if (r && r.ptr != field_last)
+            {
+                values[i] = std::numeric_limits<TargetDecimalType>::signaling_NaN();
+                r.ec = std::errc::invalid_argument;
+            }
+        }
+
+        if (BOOST_DECIMAL_UNLIKELY(!r))
+        {
+            if (res.error_count == 0U)
+            {
+                res.first_error = i;
+                res.ec = r.ec;
+            }
+
+            ++res.error_count;
+        }
+
+        if (error_bits != nullptr)
+        {
+            const auto bit {UINT64_C(1) << (i % 64U)};
+            error_bits[i / 64U] = r ? (error_bits[i / 64U] & ~bit) : (error_bits[i / 64U] | bit);
+        }
+
+        // Consume the delimiter, where \r\n counts as a single one
+        field_first = field_last;
+        if (field_first < last)
+        {
+            if (*field_first == '\r' && last - field_first > 1 && field_first[1] == '\n' && is_delimiter[static_cast<unsigned char>('\n')])
+            {
+                ++field_first;
+            }
+
+            ++field_first;
+        }
+    }
+
+    res.ptr = field_first;
+    res.count = i;
+
+    if (res.error_count == 0U)
+    {
+        res.first_error = i;
+    }
+
+    return res;
+}
+
+} // namespace detail
+
+// Parses up to n fields separated by any of the characters in delimiters into values.
+// If error_bits is not null, bit i of error_bits[i / 64] is set if field i had an error, and cleared otherwise.
+// If last_chunk is false a final field without a delimiter is left unconsumed, so that a stream can be parsed in chunks
+BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+constexpr auto from_chars_bulk(const char* first, const char* last, TargetDecimalType* values, const std::size_t n,
+                               const char* delimiters = ",\r\n", const chars_format fmt = chars_format::general,
+                               std::uint64_t* error_bits = nullptr, const bool last_chunk = true) noexcept -> from_chars_bulk_result
+{
+    return detail::from_chars_bulk_impl(first, last, values, n, delimiters, fmt, error_bits, last_chunk);
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+constexpr auto from_chars_bulk(std::string_view str, std::span<TargetDecimalType> values,
+                               const char* delimiters = ",\r\n", const chars_format fmt = chars_format::general,
+                               std::span<std::uint64_t> error_bits = {}, const bool last_chunk = true) noexcept -> from_chars_bulk_result
+{
+    BOOST_DECIMAL_ASSERT(error_bits.empty() || error_bits.size() * 64U >= values.size());
+
+    return detail::from_chars_bulk_impl(str.data(), str.data() + str.size(), values.data(), values.size(),
+                                        delimiters, fmt, error_bits.empty() ? nullptr : error_bits.data(), last_chunk);
+}
+
+#endif // BOOST_DECIMAL_HAS_STD_SPAN
+
 // ---------------------------------------------------------------------------------------------------------------------
 // to_chars and implementation
 // ---------------------------------------------------------------------------------------------------------------------
@@ -1209,6 +1332,266 @@ BOOST_DECIMAL_CONSTEXPR auto to_chars(char* first, char* last, const TargetDecim
     return detail::to_chars_impl(first, last, value, fmt, precision);
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// to_chars_bulk and implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+// Writes the lowest count digits of value so that they end at last.
+// Every group of nine digits is written with decompose32, which has no data dependent branches
+constexpr auto to_chars_bulk_digits(char* last, std::uint32_t value, int count) noexcept -> void
+{
+    char buffer[10] {};
+    decompose32(value, buffer);
+    boost::decimal::detail::memcpy(last - count, buffer + (sizeof(buffer) - static_cast<std::size_t>(count)), static_cast<std::size_t>(count));
+}
+
+constexpr auto to_chars_bulk_digits(char* last, std::uint64_t value, int count) noexcept -> void
+{
+    constexpr std::uint64_t split {UINT64_C(1000000000)};
+    constexpr int split_digits {9};
+
+    while (count > split_digits)
+    {
+        to_chars_bulk_digits(last, static_cast<std::uint32_t>(value % split), split_digits);
+        value /= split;
+        last -= split_digits;
+        count -= split_digits;
+    }
+
+    to_chars_bulk_digits(last, static_cast<std::uint32_t>(value), count);
+}
+
+// 128-bit significands are split once so that the digits themselves are generated with 64-bit arithmetic
+constexpr auto to_chars_bulk_digits(char* last, int128::uint128_t value, int count) noexcept -> void
+{
+    constexpr std::uint64_t split {UINT64_C(1000000000000000000)};
+    constexpr int split_digits {18};
+
+    if (count > split_digits)
+    {
+        to_chars_bulk_digits(last, static_cast<std::uint64_t>(value % split), split_digits);
+        to_chars_bulk_digits(last - split_digits, static_cast<std::uint64_t>(value / split), count - split_digits);
+    }
+    else
+    {
+        to_chars_bulk_digits(last, static_cast<std::uint64_t>(value), count);
+    }
+}
+
+// Formats a finite value exactly like to_chars_fixed_impl or to_chars_scientific_impl would,
+// but with the length known up front so that nothing past the separator is touched.
+// Returns nullptr if the value and its separator do not fit
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+constexpr auto to_chars_bulk_finite(char* first, char* last, const TargetDecimalType& value,
+                                    const chars_format fmt, const char separator) noexcept -> char*
+{
+    auto components {value.to_components()};
+    if (components.sig == 0U)
+    {
+        components.exp = 0;
+    }
+    else if (components.sig % 10U == 0U)
+    {
+        const auto zeros_removal_result {remove_trailing_zeros(components.sig)};
+        components.sig = zeros_removal_result.trimmed_number;
+        components.exp += static_cast<int>(zeros_removal_result.number_of_removed_zeros);
+    }
+
+    const auto sig {components.sig};
+    const int exp {components.exp};
+    const int digits {num_digits(sig)};
+    const bool is_neg {components.sign};
+
+    // General formatting uses fixed in [1, 10^precision) like to_chars_impl, which for zero is "0"
+    const bool use_fixed {fmt == chars_format::fixed ||
+                          (fmt == chars_format::general && digits + exp >= 1 && digits + exp <= precision_v<TargetDecimalType>)};
+
+    if (use_fixed)
+    {
+        // The three cases of to_chars_fixed_impl: 12345000, 12.345, and 0.0012345
+        const int length {exp >= 0 ? digits + exp : -exp < digits ? digits + 1 : 2 - exp};
+        if (last - first <= static_cast<std::ptrdiff_t>(is_neg) + length)
+        {
+            return nullptr;
+        }
+
+        if (is_neg)
+        {
+            *first++ = '-';
+        }
+
+        if (exp >= 0)
+        {
+            to_chars_bulk_digits(first + digits, sig, digits);
+            detail::memset(first + digits, '0', static_cast<std::size_t>(exp));
+        }
+        else if (-exp < digits)
+        {
+            // Write the digits shifted by one, then move the integer digits in front of the decimal point
+            const int integer_digits {digits + exp};
+            to_chars_bulk_digits(first + length, sig, digits);
+            detail::memmove(first, first + 1, static_cast<std::size_t>(integer_digits));
+            first[integer_digits] = '.';
+        }
+        else
+        {
+            first[0] = '0';
+            first[1] = '.';
+            detail::memset(first + 2, '0', static_cast<std::size_t>(-exp - digits));
+            to_chars_bulk_digits(first + length, sig, digits);
+        }
+
+        first += length;
+    }
+    else
+    {
+        // d[.ddd]e+XX with at least two exponent digits like to_chars_scientific_impl
+        int sci_exp {exp + digits - 1};
+        const char exp_sign {sci_exp < 0 ? '-' : '+'};
+        sci_exp = sci_exp < 0 ? -sci_exp : sci_exp;
+        const int exp_digits {sci_exp < 100 ? 2 : sci_exp < 1000 ? 3 : 4};
+
+        const int length {digits + static_cast<int>(digits > 1) + 2 + exp_digits};
+        if (last - first <= static_cast<std::ptrdiff_t>(is_neg) + length)
+        {
+            return nullptr;
+        }
+
+        if (is_neg)
+        {
+            *first++ = '-';
+        }
+
+        // Write all the digits shifted by one, then move the leading digit in front of the decimal point
+        to_chars_bulk_digits(first + 1 + digits, sig, digits);
+        first[0] = first[1];
+        if (digits > 1)
+        {
+            first[1] = '.';
+            first += digits + 1;
+        }
+        else
+        {
+            ++first;
+        }
+
+        *first++ = 'e';
+        *first++ = exp_sign;
+        to_chars_bulk_digits(first + exp_digits, static_cast<std::uint32_t>(sci_exp), exp_digits);
+        first += exp_digits;
+    }
+
+    *first++ = separator;
+    return first;
+}
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+BOOST_DECIMAL_CONSTEXPR auto to_chars_bulk_impl(char* first, char* last, const TargetDecimalType* values, const std::size_t n,
+                                                const char separator, const chars_format fmt, std::size_t* offsets) noexcept -> to_chars_bulk_result
+{
+    to_chars_bulk_result res {first, 0U, std::errc()};
+
+    auto current {first};
+    std::size_t i {};
+    for (; i < n; ++i)
+    {
+        if (offsets != nullptr)
+        {
+            offsets[i] = static_cast<std::size_t>(current - first);
+        }
+
+        const auto& value {values[i]};
+        char* next {nullptr};
+
+        // Any failure other than running out of room comes from to_chars itself
+        std::errc ec {std::errc::value_too_large};
+
+        if (BOOST_DECIMAL_LIKELY(fmt != chars_format::hex && isfinite(value)))
+        {
+            next = to_chars_bulk_finite(current, last, value, fmt, separator);
+        }
+        else
+        {
+            // Non-finite values and hex are rare enough to go through to_chars itself.
+            // It may use more room than it ends up writing, so it writes to scratch space first
+            char scratch[64] {};
+            const auto r {to_chars_impl(scratch, scratch + sizeof(scratch), value, fmt)};
+            const auto length {r.ptr - scratch};
+            if (!r)
+            {
+                ec = r.ec;
+            }
+            else if (last - current > length)
+            {
+                detail::memcpy(current, scratch, static_cast<std::size_t>(length));
+                next = current + length;
+                *next++ = separator;
+            }
+        }
+
+        if (BOOST_DECIMAL_UNLIKELY(next == nullptr))
+        {
+            res.ec = ec;
+            break;
+        }
+
+        current = next;
+    }
+
+    if (offsets != nullptr)
+    {
+        offsets[i] = static_cast<std::size_t>(current - first);
+    }
+
+    res.ptr = current;
+    res.count = i;
+
+    return res;
+}
+
+} // namespace detail
+
+// Formats the n values into [first, last), each one followed by separator, as to_chars(first, last, value, fmt) would.
+// If offsets is not null it needs n + 1 elements, and value i is written to [first + offsets[i], first + offsets[i + 1] - 1).
+// If the buffer fills up the values that fit are kept, and count says how many there are
+BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+BOOST_DECIMAL_CONSTEXPR auto to_chars_bulk(char* first, char* last, const TargetDecimalType* values, const std::size_t n,
+                                           const char separator = ',', const chars_format fmt = chars_format::general,
+                                           std::size_t* offsets = nullptr) noexcept -> to_chars_bulk_result
+{
+    return detail::to_chars_bulk_impl(first, last, values, n, separator, fmt, offsets);
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+BOOST_DECIMAL_CONSTEXPR auto to_chars_bulk(std::span<char> buffer, std::span<const TargetDecimalType> values,
+                                           const char separator = ',', const chars_format fmt = chars_format::general,
+                                           std::span<std::size_t> offsets = {}) noexcept -> to_chars_bulk_result
+{
+    BOOST_DECIMAL_ASSERT(offsets.empty() || offsets.size() > values.size());
+
+    return detail::to_chars_bulk_impl(buffer.data(), buffer.data() + buffer.size(), values.data(), values.size(),
+                                      separator, fmt, offsets.empty() ? nullptr : offsets.data());
+}
+
+// TargetDecimalType cannot be deduced from a span of non-const values for the overload above.
+// Taking the extent as well keeps this out of overload resolution when TargetDecimalType is given explicitly for a container
+BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType, std::size_t Extent>
+BOOST_DECIMAL_CONSTEXPR auto to_chars_bulk(std::span<char> buffer, std::span<TargetDecimalType, Extent> values,
+                                           const char separator = ',', const chars_format fmt = chars_format::general,
+                                           std::span<std::size_t> offsets = {}) noexcept -> to_chars_bulk_result
+{
+    BOOST_DECIMAL_ASSERT(offsets.empty() || offsets.size() > values.size());
+
+    return detail::to_chars_bulk_impl(buffer.data(), buffer.data() + buffer.size(), values.data(), values.size(),
+                                      separator, fmt, offsets.empty() ? nullptr : offsets.data());
+}
+
+#endif // BOOST_DECIMAL_HAS_STD_SPAN
+
 #ifdef BOOST_DECIMAL_HAS_STD_CHARCONV
 
 BOOST_DECIMAL_EXPORT template <typename DecimalType>
@@ -33,22 +33,19 @@ namespace decimal {
 
 namespace detail {
 
-// 3.8.2
+// Parses [first, last) which has to use '.' as the decimal point, and sets end to one past the last parsed character
 template <typename TargetDecimalType>
-inline auto strtod_calculation(const char* str, char** endptr, char* buffer, const std::size_t str_length) noexcept -> TargetDecimalType
+inline auto strtod_parse(const char* first, const char* last, const char*& end) noexcept -> TargetDecimalType
 {
     using significand_type = std::conditional_t<(std::numeric_limits<typename TargetDecimalType::significand_type>::digits >
                                                  std::numeric_limits<std::uint64_t>::digits),
                                                  int128::uint128_t, std::uint64_t>;
 
-    std::memcpy(buffer, str, str_length);
-    convert_string_to_c_locale(buffer);
-
     bool sign {};
     significand_type significand {};
     std::int32_t expval {};
 
-    const auto r {detail::parser(buffer, buffer + str_length, sign, significand, expval)};
+    const auto r {detail::parser(first, last, sign, significand, expval)};
     TargetDecimalType d {};
 
     if (r.ec != std::errc{})
@@ -79,9 +76,45 @@ inline auto strtod_calculation(const char* str, char** endptr, char* buffer, con
         d = TargetDecimalType(significand, expval, sign);
     }
 
+    end = r.ptr;
+
+    return d;
+}
+
+// 3.8.2
+template <typename TargetDecimalType>
+inline auto strtod_calculation(const char* str, char** endptr, char* buffer, const std::size_t str_length) noexcept -> TargetDecimalType
+{
+    std::memcpy(buffer, str, str_length);
+    convert_string_to_c_locale(buffer);
+
+    const char* end {};
+    const auto d {strtod_parse<TargetDecimalType>(buffer, buffer + str_length, end)};
+
     if (endptr != nullptr)
     {
-        *endptr = const_cast<char*>(str + (r.ptr - buffer));
+        *endptr = const_cast<char*>(str + (end - buffer));
+    }
+
+    return d;
+}
+
+// Parses the string where it is, so there is no copy, no call to localeconv, and no allocation
+template <typename TargetDecimalType>
+inline auto strtod_c_locale_impl(const char* str, char** endptr) noexcept -> TargetDecimalType
+{
+    if (str == nullptr)
+    {
+        errno = EINVAL;
+        return std::numeric_limits<TargetDecimalType>::quiet_NaN();
+    }
+
+    const char* end {};
+    const auto d {strtod_parse<TargetDecimalType>(str, str + detail::strlen(str), end)};
+
+    if (endptr != nullptr)
+    {
+        *endptr = const_cast<char*>(end);
     }
 
     return d;
@@ -90,6 +123,12 @@ inline auto strtod_calculation(const char* str, char** endptr, char* buffer, con
 template <typename TargetDecimalType>
 inline auto strtod_impl(const char* str, char** endptr) noexcept -> TargetDecimalType
 {
+    #ifdef BOOST_DECIMAL_STRTOD_C_LOCALE
+
+    return strtod_c_locale_impl<TargetDecimalType>(str, endptr);
+
+    #else
+
     if (str == nullptr)
     {
         errno = EINVAL;
@@ -119,6 +158,8 @@ inline auto strtod_impl(const char* str, char** endptr) noexcept -> TargetDecima
     auto d = strtod_calculation<TargetDecimalType>(str, endptr, buffer.get(), str_length);
 
     return d;
+
+    #endif
 }
 
 // 3.9.2
@@ -196,6 +237,13 @@ inline auto wcstod(const wchar_t* str, wchar_t** endptr) noexcept -> TargetDecim
     return detail::wcstod_impl<TargetDecimalType>(str, endptr);
 }
 
+// Same as strtod, but the caller guarantees that str uses '.' as the decimal point regardless of the global locale
+BOOST_DECIMAL_EXPORT template <typename TargetDecimalType = decimal64_t>
+inline auto strtod_c_locale(const char* str, char** endptr) noexcept -> TargetDecimalType
+{
+    return detail::strtod_c_locale_impl<TargetDecimalType>(str, endptr);
+}
+
 BOOST_DECIMAL_EXPORT inline auto strtod32(const char* str, char** endptr) noexcept -> decimal32_t
 {
     return detail::strtod_impl<decimal32_t>(str, endptr);
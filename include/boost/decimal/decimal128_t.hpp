@@ -37,6 +37,7 @@
 #include <boost/decimal/detail/mul_impl.hpp>
 #include <boost/decimal/detail/div_impl.hpp>
 #include <boost/decimal/detail/cmath/next.hpp>
+#include <boost/decimal/detail/hash_impl.hpp>
 #include "detail/int128.hpp"
 #include <boost/decimal/detail/to_chars_result.hpp>
 #include <boost/decimal/detail/chars_format.hpp>
@@ -96,6 +97,9 @@ constexpr auto to_chars_scientific_impl(char* first, char* last, const TargetDec
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
 constexpr auto to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+constexpr auto to_chars_bulk_finite(char* first, char* last, const TargetDecimalType& value, const chars_format fmt, const char separator) noexcept -> char*;
+
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
 constexpr auto to_chars_hex_impl(char* first, char* last, const TargetDecimalType& value) noexcept -> to_chars_result;
 
@@ -170,6 +174,26 @@ private:
 
     friend constexpr auto d128_div_impl(const decimal128_t& lhs, const decimal128_t& rhs, decimal128_t& q, decimal128_t& r) noexcept -> void;
 
+    // Construction that rounds with the given policy rather than the current rounding mode
+    template <typename Rounding, typename T1, typename T2>
+    constexpr decimal128_t(detail::rounding_policy_tag<Rounding>, T1 coeff, T2 exp, bool sign) noexcept;
+
+    template <typename DecimalType, typename Rounding>
+    friend struct detail::rounded_result;
+
+    // Arithmetic with the rounding mode fixed at compile time
+    template <rounding_mode Mode>
+    friend constexpr auto add(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t;
+
+    template <rounding_mode Mode>
+    friend constexpr auto sub(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t;
+
+    template <rounding_mode Mode>
+    friend constexpr auto mul(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t;
+
+    template <rounding_mode Mode>
+    friend constexpr auto div(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t;
+
     friend constexpr auto d128_mod_impl(const decimal128_t& lhs, const decimal128_t& rhs, const decimal128_t& q, decimal128_t& r) noexcept -> void;
 
     template <typename T>
@@ -197,12 +221,18 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
     friend constexpr auto detail::nextafter_impl(DecimalType val, bool direction) noexcept -> DecimalType;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
+    friend constexpr auto detail::canonical_hash(const DecimalType& val) noexcept -> std::size_t;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_scientific_impl(char* first, char* last, const TargetDecimalType& value, chars_format fmt) noexcept -> to_chars_result;
 
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+    friend constexpr auto detail::to_chars_bulk_finite(char* first, char* last, const TargetDecimalType& value, const chars_format fmt, const char separator) noexcept -> char*;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_hex_impl(char* first, char* last, const TargetDecimalType& value) noexcept -> to_chars_result;
 
@@ -316,6 +346,11 @@ public:
     friend constexpr auto operator+(decimal128_t rhs) noexcept -> decimal128_t;
     friend constexpr auto operator-(decimal128_t rhs) noexcept -> decimal128_t;
 
+    // Arithmetic without the checks for non-finite operands
+    friend constexpr auto unchecked_add(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t;
+    friend constexpr auto unchecked_sub(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t;
+    friend constexpr auto unchecked_mul(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t;
+
     // 3.2.8 Binary arithmetic operators
     friend constexpr auto operator+(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t;
 
@@ -701,7 +736,10 @@ template <BOOST_DECIMAL_UNSIGNED_INTEGRAL T1, BOOST_DECIMAL_INTEGRAL T2>
 #else
 template <typename T1, typename T2, std::enable_if_t<detail::is_unsigned_v<T1> && detail::is_integral_v<T2>, bool>>
 #endif
-constexpr decimal128_t::decimal128_t(T1 coeff, T2 exp, bool sign) noexcept
+constexpr decimal128_t::decimal128_t(T1 coeff, T2 exp, bool sign) noexcept : decimal128_t(detail::rounding_policy_tag<detail::dynamic_rounding>{}, coeff, exp, sign) {}
+
+template <typename Rounding, typename T1, typename T2>
+constexpr decimal128_t::decimal128_t(detail::rounding_policy_tag<Rounding>, T1 coeff, T2 exp, bool sign) noexcept
 {
     bits_.high = sign ? detail::d128_sign_mask : UINT64_C(0);
 
@@ -725,19 +763,26 @@ constexpr decimal128_t::decimal128_t(T1 coeff, T2 exp, bool sign) noexcept
                 #  pragma GCC diagnostic ignored "-Wconversion"
                 #endif
 
-                coeff /= detail::pow10(static_cast<T1>(digits_to_remove));
+                #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+                if (coeff % detail::pow10(static_cast<T1>(digits_to_remove)) != 0U)
+                {
+                    detail::raise_exception_flag(exception_flag::fe_dec_inexact);
+                }
+                #endif
+
+                coeff = detail::div_pow10(coeff, digits_to_remove);
 
                 #if defined(__GNUC__) && !defined(__clang__)
                 #  pragma GCC diagnostic pop
                 #endif
 
                 coeff_digits -= digits_to_remove;
-                exp += detail::fenv_round<decimal128_t>(coeff, sign) + digits_to_remove;
+                exp += detail::fenv_round<decimal128_t, Rounding>(coeff, sign) + digits_to_remove;
             }
             // Round as required
             else
             {
-                exp += detail::fenv_round<decimal128_t>(coeff, sign);
+                exp += detail::fenv_round<decimal128_t, Rounding>(coeff, sign);
             }
         }
     }
@@ -782,6 +827,11 @@ constexpr decimal128_t::decimal128_t(T1 coeff, T2 exp, bool sign) noexcept
         }
         else
         {
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            detail::raise_exception_flag(exp < 0 ? exception_flag::fe_dec_underflow | exception_flag::fe_dec_inexact :
+                                                   exception_flag::fe_dec_overflow | exception_flag::fe_dec_inexact);
+            #endif
+
             bits_ = exp < 0 ? zero : detail::d128_inf_mask;
         }
     }
@@ -1380,11 +1430,30 @@ constexpr auto d128_div_impl(const decimal128_t& lhs, const decimal128_t& rhs, d
 
     if (lhs_fp == FP_NAN || rhs_fp == FP_NAN)
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (issignaling(lhs) || issignaling(rhs))
+        {
+            detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        }
+        #endif
+
         q = nan;
         r = nan;
         return;
     }
 
+    // inf / inf and 0 / 0 are invalid operations
+    if (lhs_fp == rhs_fp && (lhs_fp == FP_INFINITE || lhs_fp == FP_ZERO))
+    {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        #endif
+
+        q = boost::decimal::from_bits(boost::decimal::detail::d128_nan_mask);
+        r = q;
+        return;
+    }
+
     switch (lhs_fp)
     {
         case FP_INFINITE:
@@ -1402,6 +1471,10 @@ constexpr auto d128_div_impl(const decimal128_t& lhs, const decimal128_t& rhs, d
     switch (rhs_fp)
     {
         case FP_ZERO:
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            detail::raise_exception_flag(exception_flag::fe_dec_divbyzero);
+            #endif
+
             q = inf;
             r = zero;
             return;
@@ -1452,15 +1525,10 @@ constexpr auto d128_mod_impl(const decimal128_t& lhs, const decimal128_t& rhs, c
     r = lhs - (decimal128_t(q_trunc) * rhs);
 }
 
-constexpr auto operator+(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t
+// Arithmetic that assumes both operands are finite.
+// The checks for infinities and NaNs are skipped as with BOOST_DECIMAL_FAST_MATH, but only for these calls
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_add(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t
 {
-    #ifndef BOOST_DECIMAL_FAST_MATH
-    if (not_finite(lhs) || not_finite(rhs))
-    {
-        return detail::check_non_finite(lhs, rhs);
-    }
-    #endif
-
     auto lhs_sig {lhs.full_significand()};
     auto lhs_exp {lhs.biased_exponent()};
     detail::normalize<decimal128_t>(lhs_sig, lhs_exp);
@@ -1471,7 +1539,19 @@ constexpr auto operator+(const decimal128_t& lhs, const decimal128_t& rhs) noexc
 
     return detail::d128_add_impl<decimal128_t>(lhs_sig, lhs_exp, lhs.isneg(),
                                              rhs_sig, rhs_exp, rhs.isneg(),
-                                             abs(lhs) > abs(rhs));
+                                             abs_greater_parts_impl(lhs_sig, lhs_exp, rhs_sig, rhs_exp));
+}
+
+constexpr auto operator+(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (not_finite(lhs) || not_finite(rhs))
+    {
+        return detail::check_non_finite_add(lhs, rhs);
+    }
+    #endif
+
+    return unchecked_add(lhs, rhs);
 }
 
 template <typename Integer>
@@ -1509,16 +1589,8 @@ constexpr auto operator+(const Integer lhs, const decimal128_t rhs) noexcept
     return rhs + lhs;
 }
 
-// NOLINTNEXTLINE: If subtraction is actually addition than use operator+ and vice versa
-constexpr auto operator-(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_sub(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t
 {
-    #ifndef BOOST_DECIMAL_FAST_MATH
-    if (not_finite(lhs) || not_finite(rhs))
-    {
-        return detail::check_non_finite(lhs, rhs);
-    }
-    #endif
-
     auto sig_lhs {lhs.full_significand()};
     auto exp_lhs {lhs.biased_exponent()};
     detail::normalize<decimal128_t>(sig_lhs, exp_lhs);
@@ -1530,7 +1602,20 @@ constexpr auto operator-(const decimal128_t& lhs, const decimal128_t& rhs) noexc
     return detail::d128_sub_impl<decimal128_t>(
             sig_lhs, exp_lhs, lhs.isneg(),
             sig_rhs, exp_rhs, rhs.isneg(),
-            abs(lhs) > abs(rhs));
+            abs_greater_parts_impl(sig_lhs, exp_lhs, sig_rhs, exp_rhs));
+}
+
+// NOLINTNEXTLINE: If subtraction is actually addition than use operator+ and vice versa
+constexpr auto operator-(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (not_finite(lhs) || not_finite(rhs))
+    {
+        return detail::check_non_finite_add(lhs, rhs, true);
+    }
+    #endif
+
+    return unchecked_sub(lhs, rhs);
 }
 
 template <typename Integer>
@@ -1591,15 +1676,8 @@ constexpr auto operator-(const Integer lhs, const decimal128_t rhs) noexcept
             abs_lhs_bigger);
 }
 
-constexpr auto operator*(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_mul(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t
 {
-    #ifndef BOOST_DECIMAL_FAST_MATH
-    if (not_finite(lhs) || not_finite(rhs))
-    {
-        return detail::check_non_finite(lhs, rhs);
-    }
-    #endif
-
     const auto lhs_sig {lhs.full_significand()};
     const auto lhs_exp {lhs.biased_exponent()};
 
@@ -1611,6 +1689,18 @@ constexpr auto operator*(const decimal128_t& lhs, const decimal128_t& rhs) noexc
             rhs_sig, rhs_exp, rhs.isneg());
 }
 
+constexpr auto operator*(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (not_finite(lhs) || not_finite(rhs))
+    {
+        return detail::check_non_finite_mul(lhs, rhs);
+    }
+    #endif
+
+    return unchecked_mul(lhs, rhs);
+}
+
 template <typename Integer>
 constexpr auto operator*(const decimal128_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal128_t)
@@ -1657,6 +1747,103 @@ constexpr auto operator/(const decimal128_t& lhs, const decimal128_t& rhs) noexc
     return q;
 }
 
+// Arithmetic with the rounding mode fixed at compile time.
+// The results are identical to the operators evaluated with fesetround(Mode) in effect
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode>
+constexpr auto add(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (not_finite(lhs) || not_finite(rhs))
+    {
+        return detail::check_non_finite_add(lhs, rhs);
+    }
+    #endif
+
+    auto lhs_sig {lhs.full_significand()};
+    auto lhs_exp {lhs.biased_exponent()};
+    detail::normalize<decimal128_t>(lhs_sig, lhs_exp);
+
+    auto rhs_sig {rhs.full_significand()};
+    auto rhs_exp {rhs.biased_exponent()};
+    detail::normalize<decimal128_t>(rhs_sig, rhs_exp);
+
+    using result_type = detail::rounded_result<decimal128_t, detail::fixed_rounding<Mode>>;
+    return detail::d128_add_impl<result_type>(lhs_sig, lhs_exp, lhs.isneg(),
+                                              rhs_sig, rhs_exp, rhs.isneg(),
+                                              abs(lhs) > abs(rhs)).value;
+}
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode>
+constexpr auto sub(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (not_finite(lhs) || not_finite(rhs))
+    {
+        return detail::check_non_finite_add(lhs, rhs, true);
+    }
+    #endif
+
+    auto sig_lhs {lhs.full_significand()};
+    auto exp_lhs {lhs.biased_exponent()};
+    detail::normalize<decimal128_t>(sig_lhs, exp_lhs);
+
+    auto sig_rhs {rhs.full_significand()};
+    auto exp_rhs {rhs.biased_exponent()};
+    detail::normalize<decimal128_t>(sig_rhs, exp_rhs);
+
+    using result_type = detail::rounded_result<decimal128_t, detail::fixed_rounding<Mode>>;
+    return detail::d128_sub_impl<result_type>(
+            sig_lhs, exp_lhs, lhs.isneg(),
+            sig_rhs, exp_rhs, rhs.isneg(),
+            abs(lhs) > abs(rhs)).value;
+}
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode>
+constexpr auto mul(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (not_finite(lhs) || not_finite(rhs))
+    {
+        return detail::check_non_finite_mul(lhs, rhs);
+    }
+    #endif
+
+    using result_type = detail::rounded_result<decimal128_t, detail::fixed_rounding<Mode>>;
+    return detail::d128_mul_impl<result_type>(
+            lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
+            rhs.full_significand(), rhs.biased_exponent(), rhs.isneg()).value;
+}
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode>
+constexpr auto div(const decimal128_t& lhs, const decimal128_t& rhs) noexcept -> decimal128_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    // Non-finite and zero operands have exact results which do not depend on the rounding mode
+    if (not_finite(lhs) || not_finite(rhs) || lhs.full_significand() == 0U || rhs.full_significand() == 0U)
+    {
+        return lhs / rhs;
+    }
+    #endif
+
+    auto sig_lhs {lhs.full_significand()};
+    auto exp_lhs {lhs.biased_exponent()};
+    detail::normalize<decimal128_t>(sig_lhs, exp_lhs);
+
+    auto sig_rhs {rhs.full_significand()};
+    auto exp_rhs {rhs.biased_exponent()};
+    detail::normalize<decimal128_t>(sig_rhs, exp_rhs);
+
+    detail::decimal128_t_components lhs_components {sig_lhs, exp_lhs, lhs.isneg()};
+    detail::decimal128_t_components rhs_components {sig_rhs, exp_rhs, rhs.isneg()};
+    detail::decimal128_t_components q_components {};
+
+    detail::d128_generic_div_impl(lhs_components, rhs_components, q_components);
+
+    using result_type = detail::rounded_result<decimal128_t, detail::fixed_rounding<Mode>>;
+    return result_type{q_components.sig, q_components.exp, q_components.sign}.value;
+}
+
 template <typename Integer>
 constexpr auto operator/(const decimal128_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal128_t)
@@ -1940,6 +2127,10 @@ constexpr auto quantized128(const decimal128_t& lhs, const decimal128_t& rhs) no
     // If one is infinity then return a signaling NAN
     if (isinf(lhs) != isinf(rhs))
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        #endif
+
         return boost::decimal::from_bits(boost::decimal::detail::d128_snan_mask);
     }
     else if (isinf(lhs) && isinf(rhs))
@@ -39,6 +39,7 @@
 #include <boost/decimal/detail/promote_significand.hpp>
 #include <boost/decimal/detail/components.hpp>
 #include <boost/decimal/detail/cmath/next.hpp>
+#include <boost/decimal/detail/hash_impl.hpp>
 #include <boost/decimal/detail/to_chars_result.hpp>
 #include <boost/decimal/detail/chars_format.hpp>
 
@@ -99,6 +100,9 @@ constexpr auto to_chars_scientific_impl(char* first, char* last, const TargetDec
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
 constexpr auto to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+constexpr auto to_chars_bulk_finite(char* first, char* last, const TargetDecimalType& value, const chars_format fmt, const char separator) noexcept -> char*;
+
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
 constexpr auto to_chars_hex_impl(char* first, char* last, const TargetDecimalType& value) noexcept -> to_chars_result;
 
@@ -151,6 +155,26 @@ private:
     friend constexpr auto to_decimal(Decimal val) noexcept -> TargetType;
 
     friend constexpr auto div_impl(decimal32_t lhs, decimal32_t rhs, decimal32_t& q, decimal32_t& r) noexcept -> void;
+
+    // Construction that rounds with the given policy rather than the current rounding mode
+    template <typename Rounding, typename T1, typename T2>
+    constexpr decimal32_t(detail::rounding_policy_tag<Rounding>, T1 coeff, T2 exp, bool sign) noexcept;
+
+    template <typename DecimalType, typename Rounding>
+    friend struct detail::rounded_result;
+
+    // Arithmetic with the rounding mode fixed at compile time
+    template <rounding_mode Mode>
+    friend constexpr auto add(decimal32_t lhs, decimal32_t rhs) noexcept -> decimal32_t;
+
+    template <rounding_mode Mode>
+    friend constexpr auto sub(decimal32_t lhs, decimal32_t rhs) noexcept -> decimal32_t;
+
+    template <rounding_mode Mode>
+    friend constexpr auto mul(decimal32_t lhs, decimal32_t rhs) noexcept -> decimal32_t;
+
+    template <rounding_mode Mode>
+    friend constexpr auto div(decimal32_t lhs, decimal32_t rhs) noexcept -> decimal32_t;
     friend constexpr auto mod_impl(decimal32_t lhs, decimal32_t rhs, const decimal32_t& q, decimal32_t& r) noexcept -> void;
 
     template <typename T>
@@ -203,12 +227,18 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
     friend constexpr auto detail::nextafter_impl(DecimalType val, bool direction) noexcept -> DecimalType;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
+    friend constexpr auto detail::canonical_hash(const DecimalType& val) noexcept -> std::size_t;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_scientific_impl(char* first, char* last, const TargetDecimalType& value, chars_format fmt) noexcept -> to_chars_result;
 
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+    friend constexpr auto detail::to_chars_bulk_finite(char* first, char* last, const TargetDecimalType& value, const chars_format fmt, const char separator) noexcept -> char*;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_hex_impl(char* first, char* last, const TargetDecimalType& value) noexcept -> to_chars_result;
 
@@ -320,6 +350,11 @@ public:
     friend constexpr auto operator+(decimal32_t rhs) noexcept -> decimal32_t;
     friend constexpr auto operator-(decimal32_t rhs) noexcept -> decimal32_t;
 
+    // Arithmetic without the checks for non-finite operands
+    friend constexpr auto unchecked_add(decimal32_t lhs, decimal32_t rhs) noexcept -> decimal32_t;
+    friend constexpr auto unchecked_sub(decimal32_t lhs, decimal32_t rhs) noexcept -> decimal32_t;
+    friend constexpr auto unchecked_mul(decimal32_t lhs, decimal32_t rhs) noexcept -> decimal32_t;
+
     // 3.2.8 binary arithmetic operators:
     friend constexpr auto operator+(decimal32_t lhs, decimal32_t rhs) noexcept -> decimal32_t;
 
@@ -604,7 +639,10 @@ template <BOOST_DECIMAL_UNSIGNED_INTEGRAL T1, BOOST_DECIMAL_INTEGRAL T2>
 #else
 template <typename T1, typename T2, std::enable_if_t<detail::is_unsigned_v<T1> && detail::is_integral_v<T2>, bool>>
 #endif
-constexpr decimal32_t::decimal32_t(T1 coeff, T2 exp, bool sign) noexcept // NOLINT(readability-function-cognitive-complexity,misc-no-recursion)
+constexpr decimal32_t::decimal32_t(T1 coeff, T2 exp, bool sign) noexcept : decimal32_t(detail::rounding_policy_tag<detail::dynamic_rounding>{}, coeff, exp, sign) {}
+
+template <typename Rounding, typename T1, typename T2>
+constexpr decimal32_t::decimal32_t(detail::rounding_policy_tag<Rounding>, T1 coeff, T2 exp, bool sign) noexcept // NOLINT(readability-function-cognitive-complexity,misc-no-recursion)
 {
     static_assert(detail::is_integral_v<T1>, "Coefficient must be an integer");
     static_assert(detail::is_integral_v<T2>, "Exponent must be an integer");
@@ -617,7 +655,7 @@ constexpr decimal32_t::decimal32_t(T1 coeff, T2 exp, bool sign) noexcept // NOLI
     auto biased_exp {static_cast<int>(exp + detail::bias)};
     if (coeff > detail::d32_max_significand_value || biased_exp < 0)
     {
-        coeff_digits = detail::coefficient_rounding<decimal32_t>(coeff, exp, biased_exp, sign);
+        coeff_digits = detail::coefficient_rounding<decimal32_t, Rounding>(coeff, exp, biased_exp, sign);
     }
 
     auto reduced_coeff {static_cast<significand_type>(coeff)};
@@ -674,6 +712,11 @@ constexpr decimal32_t::decimal32_t(T1 coeff, T2 exp, bool sign) noexcept // NOLI
         }
         else
         {
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            detail::raise_exception_flag(exp < 0 ? exception_flag::fe_dec_underflow | exception_flag::fe_dec_inexact :
+                                                   exception_flag::fe_dec_overflow | exception_flag::fe_dec_inexact);
+            #endif
+
             bits_ = exp < 0 ? UINT32_C(0) : detail::d32_inf_mask;
         }
     }
@@ -778,6 +821,18 @@ constexpr auto operator-(decimal32_t rhs) noexcept-> decimal32_t
     return rhs;
 }
 
+// Arithmetic that assumes both operands are finite.
+// The checks for infinities and NaNs are skipped as with BOOST_DECIMAL_FAST_MATH, but only for these calls
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_add(const decimal32_t lhs, const decimal32_t rhs) noexcept -> decimal32_t
+{
+    auto lhs_components {lhs.to_components()};
+    detail::normalize(lhs_components.sig, lhs_components.exp);
+    auto rhs_components {rhs.to_components()};
+    detail::normalize(rhs_components.sig, rhs_components.exp);
+
+    return detail::d32_add_impl<decimal32_t>(lhs_components, rhs_components);
+}
+
 // We use kahan summation here where applicable
 // https://en.wikipedia.org/wiki/Kahan_summation_algorithm
 // NOLINTNEXTLINE: If addition is actually subtraction than change operator and vice versa
@@ -786,16 +841,11 @@ constexpr auto operator+(const decimal32_t lhs, const decimal32_t rhs) noexcept
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (!isfinite(lhs) || !isfinite(rhs))
     {
-        return detail::check_non_finite(lhs, rhs);
+        return detail::check_non_finite_add(lhs, rhs);
     }
     #endif
 
-    auto lhs_components {lhs.to_components()};
-    detail::normalize(lhs_components.sig, lhs_components.exp);
-    auto rhs_components {rhs.to_components()};
-    detail::normalize(rhs_components.sig, rhs_components.exp);
-
-    return detail::d32_add_impl<decimal32_t>(lhs_components, rhs_components);
+    return unchecked_add(lhs, rhs);
 }
 
 template <typename Integer>
@@ -870,16 +920,8 @@ constexpr auto decimal32_t::operator+=(const Decimal rhs) noexcept
     return *this;
 }
 
-// NOLINTNEXTLINE: If subtraction is actually addition than use operator+ and vice versa
-constexpr auto operator-(const decimal32_t lhs, const decimal32_t rhs) noexcept -> decimal32_t
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_sub(const decimal32_t lhs, const decimal32_t rhs) noexcept -> decimal32_t
 {
-    #ifndef BOOST_DECIMAL_FAST_MATH
-    if (!isfinite(lhs) || !isfinite(rhs))
-    {
-        return detail::check_non_finite(lhs, rhs);
-    }
-    #endif
-
     auto lhs_components {lhs.to_components()};
     detail::normalize(lhs_components.sig, lhs_components.exp);
     auto rhs_components {rhs.to_components()};
@@ -890,6 +932,19 @@ constexpr auto operator-(const decimal32_t lhs, const decimal32_t rhs) noexcept
     return detail::d32_add_impl<decimal32_t>(lhs_components, rhs_components);
 }
 
+// NOLINTNEXTLINE: If subtraction is actually addition than use operator+ and vice versa
+constexpr auto operator-(const decimal32_t lhs, const decimal32_t rhs) noexcept -> decimal32_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(lhs) || !isfinite(rhs))
+    {
+        return detail::check_non_finite_add(lhs, rhs, true);
+    }
+    #endif
+
+    return unchecked_sub(lhs, rhs);
+}
+
 template <typename Integer>
 constexpr auto operator-(const decimal32_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal32_t)
@@ -1542,19 +1597,24 @@ BOOST_DECIMAL_CXX20_CONSTEXPR auto to_bits(const decimal32_t rhs) noexcept -> st
     return bits;
 }
 
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_mul(const decimal32_t lhs, const decimal32_t rhs) noexcept -> decimal32_t
+{
+    const auto lhs_components {lhs.to_components()};
+    const auto rhs_components {rhs.to_components()};
+
+    return detail::mul_impl<decimal32_t>(lhs_components, rhs_components);
+}
+
 constexpr auto operator*(const decimal32_t lhs, const decimal32_t rhs) noexcept -> decimal32_t
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (!isfinite(lhs) || !isfinite(rhs))
     {
-        return detail::check_non_finite(lhs, rhs);
+        return detail::check_non_finite_mul(lhs, rhs);
     }
     #endif
 
-    const auto lhs_components {lhs.to_components()};
-    const auto rhs_components {rhs.to_components()};
-
-    return detail::mul_impl<decimal32_t>(lhs_components, rhs_components);
+    return unchecked_mul(lhs, rhs);
 }
 
 template <typename Integer>
@@ -1628,11 +1688,30 @@ constexpr auto div_impl(const decimal32_t lhs, const decimal32_t rhs, decimal32_
     
     if (lhs_fp == FP_NAN || rhs_fp == FP_NAN)
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (issignaling(lhs) || issignaling(rhs))
+        {
+            detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        }
+        #endif
+
         q = nan;
         r = nan;
         return;
     }
 
+    // inf / inf and 0 / 0 are invalid operations
+    if (lhs_fp == rhs_fp && (lhs_fp == FP_INFINITE || lhs_fp == FP_ZERO))
+    {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        #endif
+
+        q = boost::decimal::from_bits(boost::decimal::detail::d32_nan_mask);
+        r = q;
+        return;
+    }
+
     switch (lhs_fp)
     {
         case FP_INFINITE:
@@ -1650,6 +1729,10 @@ constexpr auto div_impl(const decimal32_t lhs, const decimal32_t rhs, decimal32_
     switch (rhs_fp)
     {
         case FP_ZERO:
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            detail::raise_exception_flag(exception_flag::fe_dec_divbyzero);
+            #endif
+
             q = inf;
             r = zero;
             return;
@@ -1698,6 +1781,87 @@ constexpr auto operator/(const decimal32_t lhs, const decimal32_t rhs) noexcept
     return q;
 }
 
+// Arithmetic with the rounding mode fixed at compile time.
+// The results are identical to the operators evaluated with fesetround(Mode) in effect
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode>
+constexpr auto add(const decimal32_t lhs, const decimal32_t rhs) noexcept -> decimal32_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(lhs) || !isfinite(rhs))
+    {
+        return detail::check_non_finite_add(lhs, rhs);
+    }
+    #endif
+
+    auto lhs_components {lhs.to_components()};
+    detail::normalize(lhs_components.sig, lhs_components.exp);
+    auto rhs_components {rhs.to_components()};
+    detail::normalize(rhs_components.sig, rhs_components.exp);
+
+    using result_type = detail::rounded_result<decimal32_t, detail::fixed_rounding<Mode>>;
+    return detail::d32_add_impl<result_type>(lhs_components, rhs_components).value;
+}
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode>
+constexpr auto sub(const decimal32_t lhs, const decimal32_t rhs) noexcept -> decimal32_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(lhs) || !isfinite(rhs))
+    {
+        return detail::check_non_finite_add(lhs, rhs, true);
+    }
+    #endif
+
+    auto lhs_components {lhs.to_components()};
+    detail::normalize(lhs_components.sig, lhs_components.exp);
+    auto rhs_components {rhs.to_components()};
+    detail::normalize(rhs_components.sig, rhs_components.exp);
+
+    // a - b = a + (-b)
+    rhs_components.sign = !rhs_components.sign;
+
+    using result_type = detail::rounded_result<decimal32_t, detail::fixed_rounding<Mode>>;
+    return detail::d32_add_impl<result_type>(lhs_components, rhs_components).value;
+}
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode>
+constexpr auto mul(const decimal32_t lhs, const decimal32_t rhs) noexcept -> decimal32_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(lhs) || !isfinite(rhs))
+    {
+        return detail::check_non_finite_mul(lhs, rhs);
+    }
+    #endif
+
+    const auto lhs_components {lhs.to_components()};
+    const auto rhs_components {rhs.to_components()};
+
+    using result_type = detail::rounded_result<decimal32_t, detail::fixed_rounding<Mode>>;
+    return detail::mul_impl<result_type>(lhs_components, rhs_components).value;
+}
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode>
+constexpr auto div(const decimal32_t lhs, const decimal32_t rhs) noexcept -> decimal32_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    // Non-finite and zero operands have exact results which do not depend on the rounding mode
+    if (!isfinite(lhs) || !isfinite(rhs) || lhs.full_significand() == 0U || rhs.full_significand() == 0U)
+    {
+        return lhs / rhs;
+    }
+    #endif
+
+    auto lhs_components {lhs.to_components()};
+    detail::normalize(lhs_components.sig, lhs_components.exp);
+    auto rhs_components {rhs.to_components()};
+    detail::normalize(rhs_components.sig, rhs_components.exp);
+
+    using result_type = detail::rounded_result<decimal32_t, detail::fixed_rounding<Mode>>;
+    return detail::generic_div_impl<result_type>(lhs_components, rhs_components).value;
+}
+
 template <typename Integer>
 constexpr auto operator/(const decimal32_t lhs, Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal32_t)
@@ -2052,6 +2216,10 @@ constexpr auto quantized32(const decimal32_t lhs, const decimal32_t rhs) noexcep
     // If one is infinity then return a signaling NAN
     if (isinf(lhs) != isinf(rhs))
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        #endif
+
         return from_bits(detail::d32_snan_mask);
     }
     if (isinf(lhs) && isinf(rhs))
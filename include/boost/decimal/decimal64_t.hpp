@@ -41,6 +41,7 @@
 #include <boost/decimal/detail/promote_significand.hpp>
 #include <boost/decimal/detail/components.hpp>
 #include <boost/decimal/detail/cmath/next.hpp>
+#include <boost/decimal/detail/hash_impl.hpp>
 #include <boost/decimal/detail/chars_format.hpp>
 #include <boost/decimal/detail/to_chars_result.hpp>
 
@@ -98,6 +99,9 @@ constexpr auto to_chars_scientific_impl(char* first, char* last, const TargetDec
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
 constexpr auto to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+constexpr auto to_chars_bulk_finite(char* first, char* last, const TargetDecimalType& value, const chars_format fmt, const char separator) noexcept -> char*;
+
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
 constexpr auto to_chars_hex_impl(char* first, char* last, const TargetDecimalType& value) noexcept -> to_chars_result;
 
@@ -177,6 +181,26 @@ private:
 
     friend constexpr auto d64_div_impl(decimal64_t lhs, decimal64_t rhs, decimal64_t& q, decimal64_t& r) noexcept -> void;
 
+    // Construction that rounds with the given policy rather than the current rounding mode
+    template <typename Rounding, typename T1, typename T2>
+    constexpr decimal64_t(detail::rounding_policy_tag<Rounding>, T1 coeff, T2 exp, bool sign) noexcept;
+
+    template <typename DecimalType, typename Rounding>
+    friend struct detail::rounded_result;
+
+    // Arithmetic with the rounding mode fixed at compile time
+    template <rounding_mode Mode>
+    friend constexpr auto add(decimal64_t lhs, decimal64_t rhs) noexcept -> decimal64_t;
+
+    template <rounding_mode Mode>
+    friend constexpr auto sub(decimal64_t lhs, decimal64_t rhs) noexcept -> decimal64_t;
+
+    template <rounding_mode Mode>
+    friend constexpr auto mul(decimal64_t lhs, decimal64_t rhs) noexcept -> decimal64_t;
+
+    template <rounding_mode Mode>
+    friend constexpr auto div(decimal64_t lhs, decimal64_t rhs) noexcept -> decimal64_t;
+
     friend constexpr auto d64_mod_impl(decimal64_t lhs, decimal64_t rhs, const decimal64_t& q, decimal64_t& r) noexcept -> void;
 
     template <typename T>
@@ -208,12 +232,18 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
     friend constexpr auto detail::nextafter_impl(DecimalType val, bool direction) noexcept -> DecimalType;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
+    friend constexpr auto detail::canonical_hash(const DecimalType& val) noexcept -> std::size_t;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_scientific_impl(char* first, char* last, const TargetDecimalType& value, chars_format fmt) noexcept -> to_chars_result;
 
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+    friend constexpr auto detail::to_chars_bulk_finite(char* first, char* last, const TargetDecimalType& value, const chars_format fmt, const char separator) noexcept -> char*;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_hex_impl(char* first, char* last, const TargetDecimalType& value) noexcept -> to_chars_result;
 
@@ -328,6 +358,11 @@ public:
     friend constexpr auto operator+(decimal64_t rhs) noexcept -> decimal64_t;
     friend constexpr auto operator-(decimal64_t rhs) noexcept -> decimal64_t;
 
+    // Arithmetic without the checks for non-finite operands
+    friend constexpr auto unchecked_add(decimal64_t lhs, decimal64_t rhs) noexcept -> decimal64_t;
+    friend constexpr auto unchecked_sub(decimal64_t lhs, decimal64_t rhs) noexcept -> decimal64_t;
+    friend constexpr auto unchecked_mul(decimal64_t lhs, decimal64_t rhs) noexcept -> decimal64_t;
+
     // 3.2.8 Binary arithmetic operators
     friend constexpr auto operator+(decimal64_t lhs, decimal64_t rhs) noexcept -> decimal64_t;
 
@@ -602,7 +637,10 @@ template <BOOST_DECIMAL_UNSIGNED_INTEGRAL T1, BOOST_DECIMAL_INTEGRAL T2>
 #else
 template <typename T1, typename T2, std::enable_if_t<detail::is_unsigned_v<T1> && detail::is_integral_v<T2>, bool>>
 #endif
-constexpr decimal64_t::decimal64_t(T1 coeff, T2 exp, bool sign) noexcept
+constexpr decimal64_t::decimal64_t(T1 coeff, T2 exp, bool sign) noexcept : decimal64_t(detail::rounding_policy_tag<detail::dynamic_rounding>{}, coeff, exp, sign) {}
+
+template <typename Rounding, typename T1, typename T2>
+constexpr decimal64_t::decimal64_t(detail::rounding_policy_tag<Rounding>, T1 coeff, T2 exp, bool sign) noexcept
 {
     bits_ = sign ? detail::d64_sign_mask : UINT64_C(0);
 
@@ -620,18 +658,25 @@ constexpr decimal64_t::decimal64_t(T1 coeff, T2 exp, bool sign) noexcept
             #  pragma GCC diagnostic ignored "-Wconversion"
             #endif
 
-            coeff /= detail::pow10(static_cast<T1>(digits_to_remove));
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            if (coeff % detail::pow10(static_cast<T1>(digits_to_remove)) != 0U)
+            {
+                detail::raise_exception_flag(exception_flag::fe_dec_inexact);
+            }
+            #endif
+
+            coeff = detail::div_pow10(coeff, digits_to_remove);
 
             #if defined(__GNUC__) && !defined(__clang__)
             #  pragma GCC diagnostic pop
             #endif
 
             coeff_digits -= digits_to_remove;
-            exp += detail::fenv_round<decimal64_t>(coeff, sign) + digits_to_remove;
+            exp += detail::fenv_round<decimal64_t, Rounding>(coeff, sign) + digits_to_remove;
         }
         else
         {
-            exp += detail::fenv_round<decimal64_t>(coeff, sign);
+            exp += detail::fenv_round<decimal64_t, Rounding>(coeff, sign);
         }
     }
 
@@ -690,6 +735,11 @@ constexpr decimal64_t::decimal64_t(T1 coeff, T2 exp, bool sign) noexcept
         }
         else
         {
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            detail::raise_exception_flag(exp < 0 ? exception_flag::fe_dec_underflow | exception_flag::fe_dec_inexact :
+                                                   exception_flag::fe_dec_overflow | exception_flag::fe_dec_inexact);
+            #endif
+
             bits_ = exp < 0 ? UINT64_C(0) : detail::d64_inf_mask;
         }
     }
@@ -1084,11 +1134,30 @@ constexpr auto d64_div_impl(const decimal64_t lhs, const decimal64_t rhs, decima
 
     if (lhs_fp == FP_NAN || rhs_fp == FP_NAN)
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (issignaling(lhs) || issignaling(rhs))
+        {
+            detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        }
+        #endif
+
         q = nan;
         r = nan;
         return;
     }
 
+    // inf / inf and 0 / 0 are invalid operations
+    if (lhs_fp == rhs_fp && (lhs_fp == FP_INFINITE || lhs_fp == FP_ZERO))
+    {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        #endif
+
+        q = boost::decimal::from_bits(boost::decimal::detail::d64_nan_mask);
+        r = q;
+        return;
+    }
+
     switch (lhs_fp)
     {
         case FP_INFINITE:
@@ -1106,6 +1175,10 @@ constexpr auto d64_div_impl(const decimal64_t lhs, const decimal64_t rhs, decima
     switch (rhs_fp)
     {
         case FP_ZERO:
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            detail::raise_exception_flag(exception_flag::fe_dec_divbyzero);
+            #endif
+
             q = inf;
             r = zero;
             return;
@@ -1143,21 +1216,28 @@ constexpr auto d64_mod_impl(const decimal64_t lhs, const decimal64_t rhs, const
     r = lhs - (decimal64_t(q_trunc) * rhs);
 }
 
+// Arithmetic that assumes both operands are finite.
+// The checks for infinities and NaNs are skipped as with BOOST_DECIMAL_FAST_MATH, but only for these calls
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_add(const decimal64_t lhs, const decimal64_t rhs) noexcept -> decimal64_t
+{
+    auto lhs_components {lhs.to_components()};
+    detail::normalize<decimal64_t>(lhs_components.sig, lhs_components.exp);
+    auto rhs_components {rhs.to_components()};
+    detail::normalize<decimal64_t>(rhs_components.sig, rhs_components.exp);
+
+    return detail::d64_add_impl<decimal64_t>(lhs_components, rhs_components);
+}
+
 constexpr auto operator+(const decimal64_t lhs, const decimal64_t rhs) noexcept -> decimal64_t
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (not_finite(lhs) || not_finite(rhs))
     {
-        return detail::check_non_finite(lhs, rhs);
+        return detail::check_non_finite_add(lhs, rhs);
     }
     #endif
 
-    auto lhs_components {lhs.to_components()};
-    detail::normalize<decimal64_t>(lhs_components.sig, lhs_components.exp);
-    auto rhs_components {rhs.to_components()};
-    detail::normalize<decimal64_t>(rhs_components.sig, rhs_components.exp);
-
-    return detail::d64_add_impl<decimal64_t>(lhs_components, rhs_components);
+    return unchecked_add(lhs, rhs);
 }
 
 template <typename Integer>
@@ -1197,23 +1277,28 @@ constexpr auto operator+(const Integer lhs, const decimal64_t rhs) noexcept
     return rhs + lhs;
 }
 
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_sub(const decimal64_t lhs, const decimal64_t rhs) noexcept -> decimal64_t
+{
+    auto lhs_components {lhs.to_components()};
+    detail::normalize<decimal64_t>(lhs_components.sig, lhs_components.exp);
+    auto rhs_components {rhs.to_components()};
+    detail::normalize<decimal64_t>(rhs_components.sig, rhs_components.exp);
+    rhs_components.sign = !rhs_components.sign;
+
+    return detail::d64_add_impl<decimal64_t>(lhs_components, rhs_components);
+}
+
 // NOLINTNEXTLINE: If subtraction is actually addition than use operator+ and vice versa
 constexpr auto operator-(const decimal64_t lhs, const decimal64_t rhs) noexcept -> decimal64_t
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (not_finite(lhs) || not_finite(rhs))
     {
-        return detail::check_non_finite(lhs, rhs);
+        return detail::check_non_finite_add(lhs, rhs, true);
     }
     #endif
 
-    auto lhs_components {lhs.to_components()};
-    detail::normalize<decimal64_t>(lhs_components.sig, lhs_components.exp);
-    auto rhs_components {rhs.to_components()};
-    detail::normalize<decimal64_t>(rhs_components.sig, rhs_components.exp);
-    rhs_components.sign = !rhs_components.sign;
-
-    return detail::d64_add_impl<decimal64_t>(lhs_components, rhs_components);
+    return unchecked_sub(lhs, rhs);
 }
 
 template <typename Integer>
@@ -1276,21 +1361,26 @@ constexpr auto operator-(const Integer lhs, const decimal64_t rhs) noexcept
                                            abs_lhs_bigger);
 }
 
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_mul(const decimal64_t lhs, const decimal64_t rhs) noexcept -> decimal64_t
+{
+    auto lhs_components {lhs.to_components()};
+    detail::normalize<decimal64_t>(lhs_components.sig, lhs_components.exp);
+    auto rhs_components {rhs.to_components()};
+    detail::normalize<decimal64_t>(rhs_components.sig, rhs_components.exp);
+
+    return detail::d64_mul_impl<decimal64_t>(lhs_components, rhs_components);
+}
+
 constexpr auto operator*(const decimal64_t lhs, const decimal64_t rhs) noexcept -> decimal64_t
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (not_finite(lhs) || not_finite(rhs))
     {
-        return detail::check_non_finite(lhs, rhs);
+        return detail::check_non_finite_mul(lhs, rhs);
     }
     #endif
 
-    auto lhs_components {lhs.to_components()};
-    detail::normalize<decimal64_t>(lhs_components.sig, lhs_components.exp);
-    auto rhs_components {rhs.to_components()};
-    detail::normalize<decimal64_t>(rhs_components.sig, rhs_components.exp);
-
-    return detail::d64_mul_impl<decimal64_t>(lhs_components, rhs_components);
+    return unchecked_mul(lhs, rhs);
 }
 
 template <typename Integer>
@@ -1336,6 +1426,87 @@ constexpr auto operator/(const decimal64_t lhs, const decimal64_t rhs) noexcept
     return q;
 }
 
+// Arithmetic with the rounding mode fixed at compile time.
+// The results are identical to the operators evaluated with fesetround(Mode) in effect
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode>
+constexpr auto add(const decimal64_t lhs, const decimal64_t rhs) noexcept -> decimal64_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (not_finite(lhs) || not_finite(rhs))
+    {
+        return detail::check_non_finite_add(lhs, rhs);
+    }
+    #endif
+
+    auto lhs_components {lhs.to_components()};
+    detail::normalize<decimal64_t>(lhs_components.sig, lhs_components.exp);
+    auto rhs_components {rhs.to_components()};
+    detail::normalize<decimal64_t>(rhs_components.sig, rhs_components.exp);
+
+    using result_type = detail::rounded_result<decimal64_t, detail::fixed_rounding<Mode>>;
+    return detail::d64_add_impl<result_type>(lhs_components, rhs_components).value;
+}
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode>
+constexpr auto sub(const decimal64_t lhs, const decimal64_t rhs) noexcept -> decimal64_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (not_finite(lhs) || not_finite(rhs))
+    {
+        return detail::check_non_finite_add(lhs, rhs, true);
+    }
+    #endif
+
+    auto lhs_components {lhs.to_components()};
+    detail::normalize<decimal64_t>(lhs_components.sig, lhs_components.exp);
+    auto rhs_components {rhs.to_components()};
+    detail::normalize<decimal64_t>(rhs_components.sig, rhs_components.exp);
+    rhs_components.sign = !rhs_components.sign;
+
+    using result_type = detail::rounded_result<decimal64_t, detail::fixed_rounding<Mode>>;
+    return detail::d64_add_impl<result_type>(lhs_components, rhs_components).value;
+}
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode>
+constexpr auto mul(const decimal64_t lhs, const decimal64_t rhs) noexcept -> decimal64_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (not_finite(lhs) || not_finite(rhs))
+    {
+        return detail::check_non_finite_mul(lhs, rhs);
+    }
+    #endif
+
+    auto lhs_components {lhs.to_components()};
+    detail::normalize<decimal64_t>(lhs_components.sig, lhs_components.exp);
+    auto rhs_components {rhs.to_components()};
+    detail::normalize<decimal64_t>(rhs_components.sig, rhs_components.exp);
+
+    using result_type = detail::rounded_result<decimal64_t, detail::fixed_rounding<Mode>>;
+    return detail::d64_mul_impl<result_type>(lhs_components, rhs_components).value;
+}
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode>
+constexpr auto div(const decimal64_t lhs, const decimal64_t rhs) noexcept -> decimal64_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    // Non-finite and zero operands have exact results which do not depend on the rounding mode
+    if (not_finite(lhs) || not_finite(rhs) || lhs.full_significand() == 0U || rhs.full_significand() == 0U)
+    {
+        return lhs / rhs;
+    }
+    #endif
+
+    const bool sign {lhs.isneg() != rhs.isneg()};
+
+    auto lhs_components {lhs.to_components()};
+    detail::normalize<decimal64_t>(lhs_components.sig, lhs_components.exp);
+
+    using result_type = detail::rounded_result<decimal64_t, detail::fixed_rounding<Mode>>;
+    return detail::d64_generic_div_impl<result_type>(lhs_components, rhs.to_components(), sign).value;
+}
+
 template <typename Integer>
 constexpr auto operator/(const decimal64_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal64_t)
@@ -1970,6 +2141,10 @@ constexpr auto quantized64(const decimal64_t lhs, const decimal64_t rhs) noexcep
     // If one is infinity then return a signaling NAN
     if (isinf(lhs) != isinf(rhs))
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        #endif
+
         return boost::decimal::from_bits(boost::decimal::detail::d64_snan_mask);
     }
     if (isinf(lhs) && isinf(rhs))
@@ -0,0 +1,459 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECIMAL_ACCUMULATOR_HPP
+#define BOOST_DECIMAL_DECIMAL_ACCUMULATOR_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal128_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// Each limb holds 9 decimal digits in a signed 64-bit integer.
+// Adding a value changes every limb by less than 1.1 * 10^9, so billions of values
+// can be added or subtracted before the carries have to be propagated
+BOOST_DECIMAL_CONSTEXPR_VARIABLE int accumulator_limb_digits {9};
+
+BOOST_DECIMAL_CONSTEXPR_VARIABLE std::int64_t accumulator_limb_base {1'000'000'000};
+
+BOOST_DECIMAL_CONSTEXPR_VARIABLE std::uint32_t accumulator_max_pending {UINT32_C(1) << 31U};
+
+template <typename DecimalType>
+struct accumulator_traits
+{
+    static constexpr int precision {precision_v<DecimalType>};
+
+    // Digit 0 of limb 0 has the exponent of the normalized denorm_min,
+    // and the digits of the normalized max end below the last limb
+    static constexpr int min_exp {etiny_v<DecimalType> - (precision - 1)};
+    static constexpr int max_exp {max_biased_exp_v<DecimalType> - bias_v<DecimalType>};
+
+    // The last limb only receives carries, so sums beyond max do not wrap around
+    static constexpr std::size_t limbs {static_cast<std::size_t>((max_exp - min_exp + precision + accumulator_limb_digits - 1) / accumulator_limb_digits + 2)};
+};
+
+// Floor division by the limb base, so that the remainder is in [0, base)
+BOOST_DECIMAL_FORCE_INLINE constexpr auto accumulator_carry(std::int64_t& limb) noexcept -> std::int64_t
+{
+    auto carry {limb / accumulator_limb_base};
+    limb %= accumulator_limb_base;
+
+    if (limb < 0)
+    {
+        limb += accumulator_limb_base;
+        --carry;
+    }
+
+    return carry;
+}
+
+// Adds sig * 10^pos to limbs, where pos counts digits from the start of limb 0 and sig has at most 18 digits.
+// [lowest, highest] is widened to include the limbs that changed
+constexpr auto accumulator_add(std::int64_t* limbs, std::size_t& lowest, std::size_t& highest,
+                               const std::uint64_t sig, const std::size_t pos, const bool is_neg) noexcept -> void
+{
+    constexpr auto limb_base {static_cast<std::uint64_t>(accumulator_limb_base)};
+
+    const auto index {pos / accumulator_limb_digits};
+    const auto shift {pow10(static_cast<std::uint64_t>(pos % accumulator_limb_digits))};
+
+    // Each 9 digit chunk times the shift has at most 17 digits, which are split between two limbs
+    const auto low {(sig % limb_base) * shift};
+    const auto high {(sig / limb_base) * shift};
+
+    const std::int64_t parts[3] {static_cast<std::int64_t>(low % limb_base),
+                                 static_cast<std::int64_t>(low / limb_base + high % limb_base),
+                                 static_cast<std::int64_t>(high / limb_base)};
+
+    const auto used {parts[2] != 0 ? 3U : 2U};
+    for (std::size_t i {}; i < used; ++i)
+    {
+        limbs[index + i] += is_neg ? -parts[i] : parts[i];
+    }
+
+    lowest = index < lowest ? index : lowest;
+    highest = index + used - 1U > highest ? index + used - 1U : highest;
+}
+
+// Leaves every limb of limbs[0, count) but the last in [0, 10^9), which does not change the value.
+// A negative value ends up with a negative last limb, so this is only used to make room for more additions
+constexpr auto accumulator_propagate(std::int64_t* limbs, const std::size_t count, const std::size_t lowest, std::size_t& highest) noexcept -> void
+{
+    for (auto i {lowest}; i + 1U < count && i <= highest; ++i)
+    {
+        const auto carry {accumulator_carry(limbs[i])};
+        limbs[i + 1U] += carry;
+
+        if (carry != 0 && i + 1U > highest)
+        {
+            highest = i + 1U;
+        }
+    }
+}
+
+// Keeps the N most significant nonzero limbs passed in order of increasing position,
+// with window[N - 1] at position top, and records in below whether a nonzero limb was shifted out
+template <std::size_t N>
+constexpr auto accumulator_window_push(std::int64_t (&window)[N], std::size_t& top, bool& below,
+                                       const std::size_t pos, const std::int64_t limb) noexcept -> void
+{
+    const auto shift {pos - top};
+    for (std::size_t k {}; k < N; ++k)
+    {
+        if (k < shift)
+        {
+            below = below || window[k] != 0;
+        }
+
+        window[k] = k + shift < N ? window[k + shift] : 0;
+    }
+
+    window[N - 1U] = limb;
+    top = pos;
+}
+
+// Rounds the magnitude held by limbs[0, count) once to DecimalType in the current rounding mode,
+// where limb k has the weight 10^(9 * k + exp) and limbs[count - 1] is nonzero.
+// sticky tells whether nonzero digits were dropped below limbs[0].
+// The limbs must hold at least precision + 2 digits, so that the digit below the kept ones is among them
+template <typename DecimalType>
+constexpr auto accumulator_round(const std::int64_t* limbs, const std::size_t count, const int exp, bool sticky, const bool is_neg) noexcept -> DecimalType
+{
+    using significand_type = typename DecimalType::significand_type;
+    constexpr int target_digits {precision_v<DecimalType>};
+
+    // Keep at most precision digits, and never an exponent below etiny.
+    // One digit more than that is extracted here and rounded off by fenv_round
+    const auto total_digits {num_digits(static_cast<std::uint64_t>(limbs[count - 1U])) + static_cast<int>(count - 1U) * accumulator_limb_digits};
+    const auto max_drop {total_digits - target_digits};
+    const auto min_drop {etiny_v<DecimalType> - exp};
+    const auto removed {(max_drop > min_drop ? max_drop : min_drop) - 1};
+    BOOST_DECIMAL_ASSERT(removed >= 0);
+
+    significand_type sig {};
+
+    if (removed >= total_digits)
+    {
+        sticky = true;
+    }
+    else
+    {
+        const auto last {static_cast<std::size_t>(removed / accumulator_limb_digits)};
+        const auto last_shift {removed % accumulator_limb_digits};
+
+        for (auto i {count - 1U}; i > last; --i)
+        {
+            sig = static_cast<significand_type>(sig * static_cast<significand_type>(accumulator_limb_base) + static_cast<significand_type>(limbs[i]));
+        }
+
+        const auto last_divisor {pow10(static_cast<std::int64_t>(last_shift))};
+        sig = static_cast<significand_type>(sig * static_cast<significand_type>(accumulator_limb_base / last_divisor) + static_cast<significand_type>(limbs[last] / last_divisor));
+        sticky = sticky || limbs[last] % last_divisor != 0;
+
+        for (std::size_t i {}; i < last && !sticky; ++i)
+        {
+            sticky = limbs[i] != 0;
+        }
+    }
+
+    // The target only sets the limit beyond which fenv_round would divide a second time,
+    // and the significand of decimal_fast128_t is wider than any that reaches here.
+    // Rounding up e.g. 9'999'999 instead gives one digit too many, which is removed below
+    auto sig_exp {exp + removed};
+    sig_exp += fenv_round<decimal_fast128_t>(sig, is_neg, sticky);
+
+    if (sig == pow10(static_cast<significand_type>(target_digits)))
+    {
+        sig /= 10U;
+        ++sig_exp;
+    }
+
+    return DecimalType{sig, sig_exp, is_neg};
+}
+
+template <typename DecimalType>
+class square_accumulator;
+
+} // namespace detail
+
+// Holds the exact sum of any number of decimal values, which is rounded only once by value().
+// The result is therefore the same for every order of the additions,
+// and accumulators of parts of a range can be combined into the sum of the whole range
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+class decimal_accumulator
+{
+public:
+    static_assert(detail::is_decimal_floating_point_v<DecimalType>, "decimal_accumulator requires a decimal floating point type");
+
+    using value_type = DecimalType;
+
+private:
+    using traits = detail::accumulator_traits<DecimalType>;
+    using significand_type = typename DecimalType::significand_type;
+
+    // The value is the sum of limbs_[i] * 10^(9 * i + min_exp).
+    // Only the limbs in [lowest_, highest_] can be nonzero
+    std::int64_t limbs_[traits::limbs] {};
+    std::size_t lowest_ {traits::limbs};
+    std::size_t highest_ {};
+
+    // Number of additions since the carries were last propagated
+    std::uint32_t pending_ {};
+
+    bool all_positive_zero_ {true};
+    bool all_negative_zero_ {true};
+    bool nan_ {};
+    bool positive_infinity_ {};
+    bool negative_infinity_ {};
+
+    constexpr auto add_significand(const std::uint64_t sig, const int exp, const bool is_neg) noexcept -> void;
+    constexpr auto add_value(DecimalType val, bool subtract) noexcept -> void;
+    constexpr auto propagate_carries() noexcept -> void;
+
+    // Forms the variance from the exact sum
+    friend class detail::square_accumulator<DecimalType>;
+
+public:
+    constexpr decimal_accumulator() noexcept = default;
+
+    constexpr auto operator+=(const DecimalType val) noexcept -> decimal_accumulator&
+    {
+        add_value(val, false);
+        return *this;
+    }
+
+    constexpr auto operator-=(const DecimalType val) noexcept -> decimal_accumulator&
+    {
+        add_value(val, true);
+        return *this;
+    }
+
+    // Adds the exact sum held by other
+    constexpr auto operator+=(const decimal_accumulator& other) noexcept -> decimal_accumulator&;
+
+    // The sum rounded once in the current rounding mode
+    constexpr auto value() const noexcept -> DecimalType;
+};
+
+// Adds sig * 10^exp to the limbs, where sig has at most 18 digits
+template <typename DecimalType>
+constexpr auto decimal_accumulator<DecimalType>::add_significand(const std::uint64_t sig, const int exp, const bool is_neg) noexcept -> void
+{
+    detail::accumulator_add(limbs_, lowest_, highest_, sig, static_cast<std::size_t>(exp - traits::min_exp), is_neg);
+}
+
+template <typename DecimalType>
+constexpr auto decimal_accumulator<DecimalType>::add_value(const DecimalType val, const bool subtract) noexcept -> void
+{
+    const bool is_neg {signbit(val) != subtract};
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(val))
+    {
+        all_positive_zero_ = false;
+        all_negative_zero_ = false;
+
+        if (isnan(val))
+        {
+            nan_ = true;
+        }
+        else if (is_neg)
+        {
+            negative_infinity_ = true;
+        }
+        else
+        {
+            positive_infinity_ = true;
+        }
+
+        return;
+    }
+    #endif
+
+    int exp {};
+    auto sig {frexp10(val, &exp)};
+
+    all_positive_zero_ = all_positive_zero_ && sig == 0U && !is_neg;
+    all_negative_zero_ = all_negative_zero_ && sig == 0U && is_neg;
+
+    if (sig == 0U)
+    {
+        return;
+    }
+
+    if (BOOST_DECIMAL_UNLIKELY(pending_ >= detail::accumulator_max_pending))
+    {
+        propagate_carries();
+    }
+
+    ++pending_;
+
+    BOOST_DECIMAL_IF_CONSTEXPR (traits::precision > 18)
+    {
+        // The low 18 digits and then the remaining 16
+        constexpr auto chunk {detail::pow10(static_cast<significand_type>(18))};
+        add_significand(static_cast<std::uint64_t>(sig % chunk), exp, is_neg);
+
+        sig /= chunk;
+        if (sig != 0U)
+        {
+            add_significand(static_cast<std::uint64_t>(sig), exp + 18, is_neg);
+        }
+    }
+    else
+    {
+        add_significand(static_cast<std::uint64_t>(sig), exp, is_neg);
+    }
+}
+
+template <typename DecimalType>
+constexpr auto decimal_accumulator<DecimalType>::propagate_carries() noexcept -> void
+{
+    detail::accumulator_propagate(limbs_, traits::limbs, lowest_, highest_);
+    pending_ = 1U;
+}
+
+template <typename DecimalType>
+constexpr auto decimal_accumulator<DecimalType>::operator+=(const decimal_accumulator& other) noexcept -> decimal_accumulator&
+{
+    all_positive_zero_ = all_positive_zero_ && other.all_positive_zero_;
+    all_negative_zero_ = all_negative_zero_ && other.all_negative_zero_;
+    nan_ = nan_ || other.nan_;
+    positive_infinity_ = positive_infinity_ || other.positive_infinity_;
+    negative_infinity_ = negative_infinity_ || other.negative_infinity_;
+
+    if (other.lowest_ > other.highest_)
+    {
+        return *this;
+    }
+
+    if (BOOST_DECIMAL_UNLIKELY(static_cast<std::uint64_t>(pending_) + other.pending_ >= detail::accumulator_max_pending))
+    {
+        auto normalized_other {other};
+        normalized_other.propagate_carries();
+        propagate_carries();
+
+        return *this += normalized_other;
+    }
+
+    for (auto i {other.lowest_}; i <= other.highest_; ++i)
+    {
+        limbs_[i] += other.limbs_[i];
+    }
+
+    lowest_ = other.lowest_ < lowest_ ? other.lowest_ : lowest_;
+    highest_ = other.highest_ > highest_ ? other.highest_ : highest_;
+    pending_ += other.pending_;
+
+    return *this;
+}
+
+template <typename DecimalType>
+constexpr auto decimal_accumulator<DecimalType>::value() const noexcept -> DecimalType
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (nan_ || (positive_infinity_ && negative_infinity_))
+    {
+        return std::numeric_limits<DecimalType>::quiet_NaN();
+    }
+    if (positive_infinity_)
+    {
+        return std::numeric_limits<DecimalType>::infinity();
+    }
+    if (negative_infinity_)
+    {
+        return -std::numeric_limits<DecimalType>::infinity();
+    }
+    #endif
+
+    // An exact zero is only negative when every addend was -0
+    const DecimalType zero {0U, 0, all_negative_zero_ && !all_positive_zero_};
+
+    if (lowest_ > highest_)
+    {
+        return zero;
+    }
+
+    // The limbs are normalized in two passes that both start again from lowest_, so nothing proportional
+    // to the number of limbs is copied. The first carries towards zero, leaving every limb in (-10^9, 10^9),
+    // so the sign of the sum is the sign of the most significant nonzero limb
+    std::size_t top {lowest_};
+    std::int64_t top_limb {};
+    std::int64_t carry {};
+
+    for (auto i {lowest_}; i < traits::limbs && (i <= highest_ || carry != 0); ++i)
+    {
+        auto limb {limbs_[i] + carry};
+        carry = i + 1U < traits::limbs ? limb / detail::accumulator_limb_base : 0;
+        limb -= carry * detail::accumulator_limb_base;
+
+        if (limb != 0)
+        {
+            top = i;
+            top_limb = limb;
+        }
+    }
+
+    if (top_limb == 0)
+    {
+        return zero;
+    }
+
+    const bool is_neg {top_limb < 0};
+
+    // The second pass repeats the first, takes the magnitude and then borrows, which only reaches up to the top limb.
+    // At most precision + 1 digits are kept below, which span fewer limbs than the window,
+    // so only the window ending at the most significant nonzero limb is stored and the limbs below it decide the sticky bit
+    constexpr auto window_limbs {static_cast<std::size_t>(traits::precision / detail::accumulator_limb_digits + 3)};
+    std::int64_t window[window_limbs] {};
+    auto window_top {lowest_};
+    bool below_window {};
+
+    carry = 0;
+    std::int64_t borrow {};
+
+    for (auto i {lowest_}; i <= top; ++i)
+    {
+        auto limb {limbs_[i] + carry};
+        carry = i + 1U < traits::limbs ? limb / detail::accumulator_limb_base : 0;
+        limb -= carry * detail::accumulator_limb_base;
+
+        limb = (is_neg ? -limb : limb) + borrow;
+        borrow = i < top ? detail::accumulator_carry(limb) : 0;
+
+        if (limb != 0)
+        {
+            detail::accumulator_window_push(window, window_top, below_window, i, limb);
+        }
+    }
+
+    const auto window_exp {traits::min_exp + (static_cast<int>(window_top) - static_cast<int>(window_limbs - 1U)) * detail::accumulator_limb_digits};
+    return detail::accumulator_round<DecimalType>(window, window_limbs, window_exp, below_window, is_neg);
+}
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECIMAL_ACCUMULATOR_HPP
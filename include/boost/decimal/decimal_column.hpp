@@ -0,0 +1,599 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECIMAL_COLUMN_HPP
+#define BOOST_DECIMAL_DECIMAL_COLUMN_HPP
+
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/iostream.hpp>
+#include <boost/decimal/detail/add_impl.hpp>
+#include <boost/decimal/detail/mul_impl.hpp>
+#include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/config.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#if !defined(BOOST_DECIMAL_DISABLE_IOSTREAM)
+#include <ostream>
+#endif
+
+#endif
+
+namespace boost {
+namespace decimal {
+
+// A column of decimal values stored as a structure of arrays.
+// Only decimal_fast64_t is supported, since its members are padded out to 16 bytes per value
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+class decimal_column;
+
+namespace detail {
+
+// The exponent is stored biased, exactly as decimal_fast64_t holds it
+BOOST_DECIMAL_FORCE_INLINE constexpr auto d64_fast_column_load(const std::uint64_t* significands, const std::uint16_t* exponents,
+                                                               const std::uint8_t* signs, const std::size_t i) noexcept -> decimal_fast64_t
+{
+    return direct_init_d64(significands[i], exponents[i], signs[i] != 0U);
+}
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto d64_fast_column_store(std::uint64_t* significands, std::uint16_t* exponents,
+                                                                std::uint8_t* signs, const std::size_t i, const decimal_fast64_t val) noexcept -> void
+{
+    const auto components {d64_fast_components(val)};
+
+    significands[i] = components.sig;
+    exponents[i] = static_cast<std::uint16_t>(components.exp + bias_v<decimal64_t>);
+    signs[i] = static_cast<std::uint8_t>(components.sign);
+}
+
+} // namespace detail
+
+// 11 bytes per value instead of 16, and scans that only need one member only touch that array
+template <>
+class decimal_column<decimal_fast64_t>
+{
+public:
+    using value_type = decimal_fast64_t;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using significand_type = decimal_fast64_t::significand_type;
+    using exponent_type = decimal_fast64_t::exponent_type;
+    using sign_type = std::uint8_t;
+
+    // Proxy for a single element, which converts to and is assignable from decimal_fast64_t
+    class element_reference
+    {
+    private:
+        decimal_column* column_;
+        size_type index_;
+
+        friend class decimal_column;
+
+        element_reference(decimal_column* owner, const size_type index) noexcept : column_ {owner}, index_ {index} {}
+
+    public:
+        element_reference(const element_reference&) noexcept = default;
+
+        // Assigns the value, not the binding
+        auto operator=(const element_reference& other) noexcept -> element_reference&
+        {
+            return *this = static_cast<value_type>(other);
+        }
+
+        auto operator=(const value_type val) noexcept -> element_reference&
+        {
+            column_->store(index_, val);
+            return *this;
+        }
+
+        operator value_type() const noexcept
+        {
+            return column_->load(index_);
+        }
+
+        auto operator+=(const value_type val) noexcept -> element_reference&
+        {
+            return *this = static_cast<value_type>(*this) + val;
+        }
+
+        auto operator-=(const value_type val) noexcept -> element_reference&
+        {
+            return *this = static_cast<value_type>(*this) - val;
+        }
+
+        auto operator*=(const value_type val) noexcept -> element_reference&
+        {
+            return *this = static_cast<value_type>(*this) * val;
+        }
+
+        auto operator/=(const value_type val) noexcept -> element_reference&
+        {
+            return *this = static_cast<value_type>(*this) / val;
+        }
+
+        #if !defined(BOOST_DECIMAL_DISABLE_IOSTREAM)
+        template <typename charT, typename traits>
+        friend auto operator<<(std::basic_ostream<charT, traits>& os, const element_reference& ref) -> std::basic_ostream<charT, traits>&
+        {
+            return os << static_cast<value_type>(ref);
+        }
+        #endif
+
+        friend auto swap(element_reference lhs, element_reference rhs) noexcept -> void
+        {
+            const value_type temp {lhs};
+            lhs = static_cast<value_type>(rhs);
+            rhs = temp;
+        }
+    };
+
+    using reference = element_reference;
+    using const_reference = value_type;
+
+    template <bool IsConst>
+    class basic_iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = decimal_fast64_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, decimal_fast64_t, element_reference>;
+        using pointer = void;
+
+    private:
+        using column_pointer = std::conditional_t<IsConst, const decimal_column*, decimal_column*>;
+
+        column_pointer column_ {};
+        size_type index_ {};
+
+        friend class decimal_column;
+
+        basic_iterator(column_pointer owner, const size_type index) noexcept : column_ {owner}, index_ {index} {}
+
+    public:
+        basic_iterator() noexcept = default;
+
+        // iterator converts to const_iterator
+        template <bool OtherConst, std::enable_if_t<IsConst && !OtherConst, bool> = true>
+        basic_iterator(const basic_iterator<OtherConst>& other) noexcept : column_ {other.column_}, index_ {other.index_} {}
+
+        auto operator*() const noexcept -> reference
+        {
+            return (*column_)[index_];
+        }
+
+        auto operator[](const difference_type n) const noexcept -> reference
+        {
+            return (*column_)[static_cast<size_type>(static_cast<difference_type>(index_) + n)];
+        }
+
+        auto operator++() noexcept -> basic_iterator&
+        {
+            ++index_;
+            return *this;
+        }
+
+        auto operator++(int) noexcept -> basic_iterator
+        {
+            auto temp {*this};
+            ++index_;
+            return temp;
+        }
+
+        auto operator--() noexcept -> basic_iterator&
+        {
+            --index_;
+            return *this;
+        }
+
+        auto operator--(int) noexcept -> basic_iterator
+        {
+            auto temp {*this};
+            --index_;
+            return temp;
+        }
+
+        auto operator+=(const difference_type n) noexcept -> basic_iterator&
+        {
+            index_ = static_cast<size_type>(static_cast<difference_type>(index_) + n);
+            return *this;
+        }
+
+        auto operator-=(const difference_type n) noexcept -> basic_iterator&
+        {
+            index_ = static_cast<size_type>(static_cast<difference_type>(index_) - n);
+            return *this;
+        }
+
+        friend auto operator+(basic_iterator it, const difference_type n) noexcept -> basic_iterator
+        {
+            return it += n;
+        }
+
+        friend auto operator+(const difference_type n, basic_iterator it) noexcept -> basic_iterator
+        {
+            return it += n;
+        }
+
+        friend auto operator-(basic_iterator it, const difference_type n) noexcept -> basic_iterator
+        {
+            return it -= n;
+        }
+
+        friend auto operator-(const basic_iterator& lhs, const basic_iterator& rhs) noexcept -> difference_type
+        {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend auto operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept -> bool
+        {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend auto operator!=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept -> bool
+        {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend auto operator<(const basic_iterator& lhs, const basic_iterator& rhs) noexcept -> bool
+        {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend auto operator<=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept -> bool
+        {
+            return lhs.index_ <= rhs.index_;
+        }
+
+        friend auto operator>(const basic_iterator& lhs, const basic_iterator& rhs) noexcept -> bool
+        {
+            return lhs.index_ > rhs.index_;
+        }
+
+        friend auto operator>=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept -> bool
+        {
+            return lhs.index_ >= rhs.index_;
+        }
+
+        friend class basic_iterator<!IsConst>;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+private:
+    std::vector<significand_type> significands_;
+    std::vector<exponent_type> exponents_;
+    std::vector<sign_type> signs_;
+
+    auto load(const size_type i) const noexcept -> value_type
+    {
+        return detail::d64_fast_column_load(significands_.data(), exponents_.data(), signs_.data(), i);
+    }
+
+    auto store(const size_type i, const value_type val) noexcept -> void
+    {
+        detail::d64_fast_column_store(significands_.data(), exponents_.data(), signs_.data(), i, val);
+    }
+
+public:
+    decimal_column() = default;
+
+    // value_type{} is all zero bits in each array
+    explicit decimal_column(const size_type n) : significands_(n), exponents_(n), signs_(n) {}
+
+    decimal_column(const size_type n, const value_type val) : decimal_column(n)
+    {
+        for (size_type i {}; i < n; ++i)
+        {
+            store(i, val);
+        }
+    }
+
+    decimal_column(std::initializer_list<value_type> values) : decimal_column(values.begin(), values.end()) {}
+
+    template <typename InputIt, std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
+    decimal_column(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            push_back(*first);
+        }
+    }
+
+    auto size() const noexcept -> size_type { return significands_.size(); }
+    auto empty() const noexcept -> bool { return significands_.empty(); }
+    auto capacity() const noexcept -> size_type { return significands_.capacity(); }
+
+    auto reserve(const size_type n) -> void
+    {
+        significands_.reserve(n);
+        exponents_.reserve(n);
+        signs_.reserve(n);
+    }
+
+    auto resize(const size_type n) -> void
+    {
+        significands_.resize(n);
+        exponents_.resize(n);
+        signs_.resize(n);
+    }
+
+    auto resize(const size_type n, const value_type val) -> void
+    {
+        const auto old_size {size()};
+        resize(n);
+
+        for (size_type i {old_size}; i < n; ++i)
+        {
+            store(i, val);
+        }
+    }
+
+    auto clear() noexcept -> void
+    {
+        significands_.clear();
+        exponents_.clear();
+        signs_.clear();
+    }
+
+    auto push_back(const value_type val) -> void
+    {
+        const auto components {detail::d64_fast_components(val)};
+
+        significands_.push_back(components.sig);
+        exponents_.push_back(static_cast<exponent_type>(components.exp + detail::bias_v<decimal64_t>));
+        signs_.push_back(static_cast<sign_type>(components.sign));
+    }
+
+    auto pop_back() noexcept -> void
+    {
+        BOOST_DECIMAL_ASSERT(!empty());
+
+        significands_.pop_back();
+        exponents_.pop_back();
+        signs_.pop_back();
+    }
+
+    auto swap(decimal_column& other) noexcept -> void
+    {
+        significands_.swap(other.significands_);
+        exponents_.swap(other.exponents_);
+        signs_.swap(other.signs_);
+    }
+
+    friend auto swap(decimal_column& lhs, decimal_column& rhs) noexcept -> void
+    {
+        lhs.swap(rhs);
+    }
+
+    auto operator[](const size_type i) noexcept -> reference
+    {
+        BOOST_DECIMAL_ASSERT(i < size());
+        return {this, i};
+    }
+
+    auto operator[](const size_type i) const noexcept -> const_reference
+    {
+        BOOST_DECIMAL_ASSERT(i < size());
+        return load(i);
+    }
+
+    auto front() noexcept -> reference { return (*this)[0]; }
+    auto front() const noexcept -> const_reference { return (*this)[0]; }
+    auto back() noexcept -> reference { return (*this)[size() - 1U]; }
+    auto back() const noexcept -> const_reference { return (*this)[size() - 1U]; }
+
+    auto begin() noexcept -> iterator { return {this, 0U}; }
+    auto end() noexcept -> iterator { return {this, size()}; }
+    auto begin() const noexcept -> const_iterator { return {this, 0U}; }
+    auto end() const noexcept -> const_iterator { return {this, size()}; }
+    auto cbegin() const noexcept -> const_iterator { return begin(); }
+    auto cend() const noexcept -> const_iterator { return end(); }
+
+    // Direct access to the arrays for kernels that only need some of the members.
+    // The exponents are biased, and every sign is 0 or 1
+    auto significand_data() noexcept -> significand_type* { return significands_.data(); }
+    auto significand_data() const noexcept -> const significand_type* { return significands_.data(); }
+    auto exponent_data() noexcept -> exponent_type* { return exponents_.data(); }
+    auto exponent_data() const noexcept -> const exponent_type* { return exponents_.data(); }
+    auto sign_data() noexcept -> sign_type* { return signs_.data(); }
+    auto sign_data() const noexcept -> const sign_type* { return signs_.data(); }
+};
+
+namespace detail {
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto d64_fast_column_exp(const std::uint16_t exp) noexcept -> std::int32_t
+{
+    return static_cast<std::int32_t>(exp) - bias_v<decimal64_t>;
+}
+
+// Each kernel is the body of the matching decimal_fast64_t operator once both operands are known to be finite,
+// with the operands taken straight from the arrays.
+// admits rejects the finite operands the kernel can not handle, which then go through the operator
+
+struct column_add_op
+{
+    static constexpr auto scalar(const decimal_fast64_t lhs, const decimal_fast64_t rhs) noexcept -> decimal_fast64_t
+    {
+        return lhs + rhs;
+    }
+
+    static constexpr auto admits(std::uint64_t, std::uint64_t) noexcept -> bool
+    {
+        return true;
+    }
+
+    static constexpr auto kernel(const std::uint64_t lhs_sig, const std::uint16_t lhs_exp, const bool lhs_sign,
+                                 const std::uint64_t rhs_sig, const std::uint16_t rhs_exp, const bool rhs_sign) noexcept -> decimal_fast64_t
+    {
+        return d64_add_impl<decimal_fast64_t>(lhs_sig, d64_fast_column_exp(lhs_exp), lhs_sign,
+                                              rhs_sig, d64_fast_column_exp(rhs_exp), rhs_sign,
+                                              abs_greater_parts_impl(lhs_sig, lhs_exp, rhs_sig, rhs_exp));
+    }
+};
+
+struct column_sub_op
+{
+    static constexpr auto scalar(const decimal_fast64_t lhs, const decimal_fast64_t rhs) noexcept -> decimal_fast64_t
+    {
+        return lhs - rhs;
+    }
+
+    static constexpr auto admits(std::uint64_t, std::uint64_t) noexcept -> bool
+    {
+        return true;
+    }
+
+    static constexpr auto kernel(const std::uint64_t lhs_sig, const std::uint16_t lhs_exp, const bool lhs_sign,
+                                 const std::uint64_t rhs_sig, const std::uint16_t rhs_exp, const bool rhs_sign) noexcept -> decimal_fast64_t
+    {
+        return d64_add_impl<decimal_fast64_t>(lhs_sig, d64_fast_column_exp(lhs_exp), lhs_sign,
+                                              rhs_sig, d64_fast_column_exp(rhs_exp), !rhs_sign,
+                                              abs_greater_parts_impl(lhs_sig, lhs_exp, rhs_sig, rhs_exp));
+    }
+};
+
+struct column_mul_op
+{
+    static constexpr auto scalar(const decimal_fast64_t lhs, const decimal_fast64_t rhs) noexcept -> decimal_fast64_t
+    {
+        return lhs * rhs;
+    }
+
+    static constexpr auto admits(std::uint64_t, std::uint64_t) noexcept -> bool
+    {
+        return true;
+    }
+
+    static constexpr auto kernel(const std::uint64_t lhs_sig, const std::uint16_t lhs_exp, const bool lhs_sign,
+                                 const std::uint64_t rhs_sig, const std::uint16_t rhs_exp, const bool rhs_sign) noexcept -> decimal_fast64_t
+    {
+        const decimal_fast64_t_components lhs {lhs_sig, d64_fast_column_exp(lhs_exp), lhs_sign};
+        const decimal_fast64_t_components rhs {rhs_sig, d64_fast_column_exp(rhs_exp), rhs_sign};
+
+        return d64_mul_impl<decimal_fast64_t>(lhs, rhs);
+    }
+};
+
+struct column_div_op
+{
+    static constexpr auto scalar(const decimal_fast64_t lhs, const decimal_fast64_t rhs) noexcept -> decimal_fast64_t
+    {
+        return lhs / rhs;
+    }
+
+    // Zero operands have their own signed results and flags, so leave them to the operator
+    static constexpr auto admits(const std::uint64_t lhs_sig, const std::uint64_t rhs_sig) noexcept -> bool
+    {
+        return lhs_sig != 0U && rhs_sig != 0U;
+    }
+
+    // Same arithmetic as d64_fast_div_impl
+    static constexpr auto kernel(const std::uint64_t lhs_sig, const std::uint16_t lhs_exp, const bool lhs_sign,
+                                 const std::uint64_t rhs_sig, const std::uint16_t rhs_exp, const bool rhs_sign) noexcept -> decimal_fast64_t
+    {
+        using unsigned_int128_type = boost::int128::uint128_t;
+
+        constexpr auto tens_needed {pow10(static_cast<unsigned_int128_type>(precision_v<decimal64_t>))};
+        const auto big_sig_lhs {static_cast<unsigned_int128_type>(lhs_sig) * tens_needed};
+
+        const auto res_sig {big_sig_lhs / static_cast<unsigned_int128_type>(rhs_sig)};
+        const auto res_exp {(d64_fast_column_exp(lhs_exp) - precision_v<decimal64_t>) - d64_fast_column_exp(rhs_exp)};
+
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (big_sig_lhs % static_cast<unsigned_int128_type>(rhs_sig) != 0U)
+        {
+            raise_exception_flag(exception_flag::fe_dec_inexact);
+        }
+        #endif
+
+        return decimal_fast64_t{static_cast<std::uint64_t>(res_sig), res_exp, lhs_sign != rhs_sign};
+    }
+};
+
+// Operands are read from the arrays and results written back to them one element at a time,
+// so nothing is copied through an intermediate array of structs.
+// Element i is completely read before it is written, so result may alias lhs or rhs
+template <typename Op>
+auto column_binary_impl(const decimal_column<decimal_fast64_t>& lhs, const decimal_column<decimal_fast64_t>& rhs,
+                        decimal_column<decimal_fast64_t>& result) -> void
+{
+    BOOST_DECIMAL_ASSERT(lhs.size() == rhs.size());
+
+    const auto n {lhs.size()};
+    result.resize(n);
+
+    const auto lhs_sig {lhs.significand_data()};
+    const auto lhs_exp {lhs.exponent_data()};
+    const auto lhs_sign {lhs.sign_data()};
+    const auto rhs_sig {rhs.significand_data()};
+    const auto rhs_exp {rhs.exponent_data()};
+    const auto rhs_sign {rhs.sign_data()};
+    const auto res_sig {result.significand_data()};
+    const auto res_exp {result.exponent_data()};
+    const auto res_sign {result.sign_data()};
+
+    for (std::size_t i {}; i < n; ++i)
+    {
+        #ifndef BOOST_DECIMAL_FAST_MATH
+        const bool finite {lhs_sig[i] < d64_fast_inf && rhs_sig[i] < d64_fast_inf};
+        #else
+        constexpr bool finite {true};
+        #endif
+
+        if (BOOST_DECIMAL_LIKELY(finite && Op::admits(lhs_sig[i], rhs_sig[i])))
+        {
+            d64_fast_column_store(res_sig, res_exp, res_sign, i,
+                                  Op::kernel(lhs_sig[i], lhs_exp[i], lhs_sign[i] != 0U,
+                                             rhs_sig[i], rhs_exp[i], rhs_sign[i] != 0U));
+        }
+        else
+        {
+            d64_fast_column_store(res_sig, res_exp, res_sign, i,
+                                  Op::scalar(d64_fast_column_load(lhs_sig, lhs_exp, lhs_sign, i),
+                                             d64_fast_column_load(rhs_sig, rhs_exp, rhs_sign, i)));
+        }
+    }
+}
+
+} // namespace detail
+
+// Element-wise operations over columns of the same size: result[i] = lhs[i] op rhs[i]
+// result is resized to match, and may be the same column as lhs or rhs
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto add(const decimal_column<DecimalType>& lhs, const decimal_column<DecimalType>& rhs, decimal_column<DecimalType>& result) -> void
+{
+    detail::column_binary_impl<detail::column_add_op>(lhs, rhs, result);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto sub(const decimal_column<DecimalType>& lhs, const decimal_column<DecimalType>& rhs, decimal_column<DecimalType>& result) -> void
+{
+    detail::column_binary_impl<detail::column_sub_op>(lhs, rhs, result);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto mul(const decimal_column<DecimalType>& lhs, const decimal_column<DecimalType>& rhs, decimal_column<DecimalType>& result) -> void
+{
+    detail::column_binary_impl<detail::column_mul_op>(lhs, rhs, result);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto div(const decimal_column<DecimalType>& lhs, const decimal_column<DecimalType>& rhs, decimal_column<DecimalType>& result) -> void
+{
+    detail::column_binary_impl<detail::column_div_op>(lhs, rhs, result);
+}
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECIMAL_COLUMN_HPP
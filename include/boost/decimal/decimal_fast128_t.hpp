@@ -17,6 +17,7 @@
 #include <boost/decimal/detail/div_impl.hpp>
 #include <boost/decimal/detail/ryu/ryu_generic_128.hpp>
 #include <boost/decimal/detail/cmath/next.hpp>
+#include <boost/decimal/detail/hash_impl.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 
@@ -139,12 +140,18 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
     friend constexpr auto detail::nextafter_impl(DecimalType val, bool direction) noexcept -> DecimalType;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
+    friend constexpr auto detail::canonical_hash(const DecimalType& val) noexcept -> std::size_t;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_scientific_impl(char* first, char* last, const TargetDecimalType& value, chars_format fmt) noexcept -> to_chars_result;
 
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+    friend constexpr auto detail::to_chars_bulk_finite(char* first, char* last, const TargetDecimalType& value, const chars_format fmt, const char separator) noexcept -> char*;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_hex_impl(char* first, char* last, const TargetDecimalType& value) noexcept -> to_chars_result;
 
@@ -264,6 +271,11 @@ public:
     friend constexpr auto operator+(const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t;
     friend constexpr auto operator-(decimal_fast128_t rhs) noexcept -> decimal_fast128_t;
 
+    // Arithmetic without the checks for non-finite operands
+    friend constexpr auto unchecked_add(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t;
+    friend constexpr auto unchecked_sub(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t;
+    friend constexpr auto unchecked_mul(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t;
+
     // Binary arithmetic operators
     friend constexpr auto operator+(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t;
     friend constexpr auto operator-(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t;
@@ -406,6 +418,10 @@ constexpr decimal_fast128_t::decimal_fast128_t(T1 coeff, T2 exp, bool sign) noex
 
     if (biased_exp > detail::max_biased_exp_v<decimal128_t>)
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_overflow | exception_flag::fe_dec_inexact);
+        #endif
+
         significand_ = detail::d128_fast_inf;
     }
     else if (biased_exp >= 0)
@@ -414,6 +430,10 @@ constexpr decimal_fast128_t::decimal_fast128_t(T1 coeff, T2 exp, bool sign) noex
     }
     else
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_underflow | exception_flag::fe_dec_inexact);
+        #endif
+
         // Flush denorms to zero
         significand_ = static_cast<significand_type>(0);
         exponent_ = static_cast<exponent_type>(detail::bias_v<decimal128_t>);
@@ -792,19 +812,14 @@ constexpr auto operator-(decimal_fast128_t rhs) noexcept -> decimal_fast128_t
     return rhs;
 }
 
-constexpr auto operator+(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t
+// Arithmetic that assumes both operands are finite.
+// The checks for infinities and NaNs are skipped as with BOOST_DECIMAL_FAST_MATH, but only for these calls
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_add(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t
 {
-    #ifndef BOOST_DECIMAL_FAST_MATH
-    if (not_finite(lhs) || not_finite(rhs))
-    {
-        return detail::check_non_finite(lhs, rhs);
-    }
-    #endif
-
     return detail::d128_add_impl<decimal_fast128_t>(
             lhs.significand_, lhs.biased_exponent(), lhs.sign_,
             rhs.significand_, rhs.biased_exponent(), rhs.sign_,
-            (abs(lhs) > abs(rhs)));
+            abs_greater_parts_impl(lhs.significand_, lhs.exponent_, rhs.significand_, rhs.exponent_));
 };
 
 template <typename Integer>
@@ -831,6 +846,18 @@ constexpr auto operator+(const decimal_fast128_t& lhs, const Integer rhs) noexce
                                                   abs_lhs_bigger);
 }
 
+constexpr auto operator+(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (not_finite(lhs) || not_finite(rhs))
+    {
+        return detail::check_non_finite_add(lhs, rhs);
+    }
+    #endif
+
+    return unchecked_add(lhs, rhs);
+}
+
 template <typename Integer>
 constexpr auto operator+(const Integer lhs, const decimal_fast128_t& rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal_fast128_t)
@@ -838,19 +865,24 @@ constexpr auto operator+(const Integer lhs, const decimal_fast128_t& rhs) noexce
     return rhs + lhs;
 }
 
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_sub(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t
+{
+    return detail::d128_sub_impl<decimal_fast128_t>(
+            lhs.significand_, lhs.biased_exponent(), lhs.sign_,
+            rhs.significand_, rhs.biased_exponent(), rhs.sign_,
+            abs_greater_parts_impl(lhs.significand_, lhs.exponent_, rhs.significand_, rhs.exponent_));
+}
+
 constexpr auto operator-(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (not_finite(lhs) || not_finite(rhs))
     {
-        return detail::check_non_finite(lhs, rhs);
+        return detail::check_non_finite_add(lhs, rhs, true);
     }
     #endif
 
-    return detail::d128_sub_impl<decimal_fast128_t>(
-            lhs.significand_, lhs.biased_exponent(), lhs.sign_,
-            rhs.significand_, rhs.biased_exponent(), rhs.sign_,
-            abs(lhs) > abs(rhs));
+    return unchecked_sub(lhs, rhs);
 }
 
 template <typename Integer>
@@ -903,17 +935,22 @@ constexpr auto operator-(const Integer lhs, const decimal_fast128_t& rhs) noexce
             abs_lhs_bigger);
 }
 
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_mul(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t
+{
+    return detail::d128_mul_impl<decimal_fast128_t>(lhs.significand_, lhs.biased_exponent(), lhs.sign_,
+                                                 rhs.significand_, rhs.biased_exponent(), rhs.sign_);
+}
+
 constexpr auto operator*(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (not_finite(lhs) || not_finite(rhs))
     {
-        return detail::check_non_finite(lhs, rhs);
+        return detail::check_non_finite_mul(lhs, rhs);
     }
     #endif
 
-    return detail::d128_mul_impl<decimal_fast128_t>(lhs.significand_, lhs.biased_exponent(), lhs.sign_,
-                                                 rhs.significand_, rhs.biased_exponent(), rhs.sign_);
+    return unchecked_mul(lhs, rhs);
 }
 
 template <typename Integer>
@@ -961,11 +998,30 @@ constexpr auto d128f_div_impl(const decimal_fast128_t& lhs, const decimal_fast12
     // NAN has to come first
     if (lhs_fp == FP_NAN || rhs_fp == FP_NAN)
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (issignaling(lhs) || issignaling(rhs))
+        {
+            detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        }
+        #endif
+
         q = nan;
         r = nan;
         return;
     }
 
+    // inf / inf and 0 / 0 are invalid operations
+    if (lhs_fp == rhs_fp && (lhs_fp == FP_INFINITE || lhs_fp == FP_ZERO))
+    {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        #endif
+
+        q = nan;
+        r = q;
+        return;
+    }
+
     switch (lhs_fp)
     {
         case FP_INFINITE:
@@ -983,6 +1039,10 @@ constexpr auto d128f_div_impl(const decimal_fast128_t& lhs, const decimal_fast12
     switch (rhs_fp)
     {
         case FP_ZERO:
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            detail::raise_exception_flag(exception_flag::fe_dec_divbyzero);
+            #endif
+
             q = inf;
             r = zero;
             return;
@@ -1007,9 +1067,19 @@ constexpr auto d128f_div_impl(const decimal_fast128_t& lhs, const decimal_fast12
     constexpr auto ten_pow_precision {detail::pow10(int128::uint128_t(detail::precision_v<decimal128_t>))};
     const auto big_sig_lhs {detail::umul256(lhs.significand_, ten_pow_precision)};
 
-    const auto res_sig {big_sig_lhs / rhs.significand_};
+    int128::uint128_t remainder {};
+    const auto res_sig {detail::impl::div_rem(big_sig_lhs, rhs.significand_, remainder)};
     const auto res_exp {lhs.biased_exponent() - rhs.biased_exponent() - detail::precision_v<decimal128_t>};
 
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    if (remainder != 0U)
+    {
+        detail::raise_exception_flag(exception_flag::fe_dec_inexact);
+    }
+    #else
+    static_cast<void>(remainder);
+    #endif
+
     q = decimal_fast128_t(static_cast<int128::uint128_t>(res_sig), res_exp, sign);
 }
 
@@ -1367,6 +1437,10 @@ constexpr auto quantized128f(const decimal_fast128_t& lhs, const decimal_fast128
     // If one is infinity then return a signaling NAN
     if (isinf(lhs) != isinf(rhs))
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        #endif
+
         return boost::decimal::direct_init_d128(boost::decimal::detail::d128_fast_qnan, 0, false);
     }
     else if (isinf(lhs) && isinf(rhs))
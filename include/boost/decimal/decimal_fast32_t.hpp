@@ -18,6 +18,7 @@
 #include <boost/decimal/detail/promotion.hpp>
 #include <boost/decimal/detail/comparison.hpp>
 #include <boost/decimal/detail/cmath/next.hpp>
+#include <boost/decimal/detail/hash_impl.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <limits>
@@ -33,6 +34,8 @@ BOOST_DECIMAL_CONSTEXPR_VARIABLE auto d32_fast_inf = std::numeric_limits<std::ui
 BOOST_DECIMAL_CONSTEXPR_VARIABLE auto d32_fast_qnan = std::numeric_limits<std::uint32_t>::max() - 2;
 BOOST_DECIMAL_CONSTEXPR_VARIABLE auto d32_fast_snan = std::numeric_limits<std::uint32_t>::max() - 1;
 
+constexpr auto d32_fast_components(const decimal_fast32_t& val) noexcept -> decimal_fast32_t_components;
+
 }
 
 BOOST_DECIMAL_EXPORT class decimal_fast32_t final
@@ -124,6 +127,8 @@ private:
     template <typename ReturnType, typename T>
     friend constexpr auto detail::d32_fast_add_only_impl(const T& lhs, const T& rhs) noexcept -> ReturnType;
 
+    friend constexpr auto detail::d32_fast_components(const decimal_fast32_t& val) noexcept -> detail::decimal_fast32_t_components;
+
     template <BOOST_DECIMAL_FAST_DECIMAL_FLOATING_TYPE DecimalType>
     BOOST_DECIMAL_FORCE_INLINE friend constexpr auto fast_equality_impl(const DecimalType& lhs, const DecimalType& rhs) noexcept -> bool;
 
@@ -138,12 +143,18 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
     friend constexpr auto detail::nextafter_impl(DecimalType val, bool direction) noexcept -> DecimalType;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
+    friend constexpr auto detail::canonical_hash(const DecimalType& val) noexcept -> std::size_t;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_scientific_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+    friend constexpr auto detail::to_chars_bulk_finite(char* first, char* last, const TargetDecimalType& value, const chars_format fmt, const char separator) noexcept -> char*;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_hex_impl(char* first, char* last, const TargetDecimalType& value) noexcept -> to_chars_result;
 
@@ -252,6 +263,11 @@ public:
     friend constexpr auto operator+(decimal_fast32_t rhs) noexcept -> decimal_fast32_t;
     friend constexpr auto operator-(decimal_fast32_t lhs) noexcept -> decimal_fast32_t;
 
+    // Arithmetic without the checks for non-finite operands
+    friend constexpr auto unchecked_add(decimal_fast32_t lhs, decimal_fast32_t rhs) noexcept -> decimal_fast32_t;
+    friend constexpr auto unchecked_sub(decimal_fast32_t lhs, decimal_fast32_t rhs) noexcept -> decimal_fast32_t;
+    friend constexpr auto unchecked_mul(decimal_fast32_t lhs, decimal_fast32_t rhs) noexcept -> decimal_fast32_t;
+
     // Binary arithmetic
     friend constexpr auto operator+(decimal_fast32_t lhs, decimal_fast32_t rhs) noexcept -> decimal_fast32_t;
     friend constexpr auto operator-(decimal_fast32_t lhs, decimal_fast32_t rhs) noexcept -> decimal_fast32_t;
@@ -407,6 +423,10 @@ constexpr decimal_fast32_t::decimal_fast32_t(T1 coeff, T2 exp, bool sign) noexce
     // decimal32_t exponent holds 8 bits
     if (biased_exp > detail::max_biased_exp_v<decimal_fast32_t>)
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_overflow | exception_flag::fe_dec_inexact);
+        #endif
+
         significand_ = detail::d32_fast_inf;
     }
     else if (biased_exp >= 0)
@@ -415,6 +435,10 @@ constexpr decimal_fast32_t::decimal_fast32_t(T1 coeff, T2 exp, bool sign) noexce
     }
     else
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_underflow | exception_flag::fe_dec_inexact);
+        #endif
+
         // Flush denorms to zero
         significand_ = static_cast<significand_type>(0);
         exponent_ = static_cast<exponent_type>(detail::bias);
@@ -538,6 +562,15 @@ BOOST_DECIMAL_FORCE_INLINE constexpr auto not_finite(const decimal_fast32_t& val
     return val.significand_ >= detail::d32_fast_inf;
 }
 
+namespace detail {
+
+constexpr auto d32_fast_components(const decimal_fast32_t& val) noexcept -> decimal_fast32_t_components
+{
+    return val.to_components();
+}
+
+} // namespace detail
+
 constexpr auto operator==(const decimal_fast32_t lhs, const decimal_fast32_t rhs) noexcept -> bool
 {
     return fast_equality_impl(lhs, rhs);
@@ -767,15 +800,10 @@ constexpr auto operator-(decimal_fast32_t lhs) noexcept -> decimal_fast32_t
     return lhs;
 }
 
-constexpr auto operator+(const decimal_fast32_t lhs, const decimal_fast32_t rhs) noexcept -> decimal_fast32_t
+// Arithmetic that assumes both operands are finite.
+// The checks for infinities and NaNs are skipped as with BOOST_DECIMAL_FAST_MATH, but only for these calls
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_add(const decimal_fast32_t lhs, const decimal_fast32_t rhs) noexcept -> decimal_fast32_t
 {
-    #ifndef BOOST_DECIMAL_FAST_MATH
-    if (!isfinite(lhs) || !isfinite(rhs))
-    {
-        return detail::check_non_finite(lhs, rhs);
-    }
-    #endif
-
     if (lhs.isneg() || rhs.isneg())
     {
         return detail::d32_add_impl<decimal_fast32_t>(lhs, rhs);
@@ -787,6 +815,18 @@ constexpr auto operator+(const decimal_fast32_t lhs, const decimal_fast32_t rhs)
     }
 }
 
+constexpr auto operator+(const decimal_fast32_t lhs, const decimal_fast32_t rhs) noexcept -> decimal_fast32_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(lhs) || !isfinite(rhs))
+    {
+        return detail::check_non_finite_add(lhs, rhs);
+    }
+    #endif
+
+    return unchecked_add(lhs, rhs);
+}
+
 template <typename Integer>
 constexpr auto operator+(const decimal_fast32_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal_fast32_t)
@@ -818,15 +858,8 @@ constexpr auto operator+(const Integer lhs, const decimal_fast32_t rhs) noexcept
     return rhs + lhs;
 }
 
-constexpr auto operator-(const decimal_fast32_t lhs, decimal_fast32_t rhs) noexcept -> decimal_fast32_t
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_sub(const decimal_fast32_t lhs, decimal_fast32_t rhs) noexcept -> decimal_fast32_t
 {
-    #ifndef BOOST_DECIMAL_FAST_MATH
-    if (!isfinite(lhs) || !isfinite(rhs))
-    {
-        return detail::check_non_finite(lhs, rhs);
-    }
-    #endif
-
     rhs.sign_ = !rhs.sign_;
 
     if (lhs.sign_ || rhs.sign_)
@@ -840,6 +873,18 @@ constexpr auto operator-(const decimal_fast32_t lhs, decimal_fast32_t rhs) noexc
     }
 }
 
+constexpr auto operator-(const decimal_fast32_t lhs, decimal_fast32_t rhs) noexcept -> decimal_fast32_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(lhs) || !isfinite(rhs))
+    {
+        return detail::check_non_finite_add(lhs, rhs, true);
+    }
+    #endif
+
+    return unchecked_sub(lhs, rhs);
+}
+
 template <typename Integer>
 constexpr auto operator-(const decimal_fast32_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal_fast32_t)
@@ -891,15 +936,8 @@ constexpr auto operator-(const Integer lhs, const decimal_fast32_t rhs) noexcept
     );
 }
 
-constexpr auto operator*(const decimal_fast32_t lhs, const decimal_fast32_t rhs) noexcept -> decimal_fast32_t
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_mul(const decimal_fast32_t lhs, const decimal_fast32_t rhs) noexcept -> decimal_fast32_t
 {
-    #ifndef BOOST_DECIMAL_FAST_MATH
-    if (!isfinite(lhs) || !isfinite(rhs))
-    {
-        return detail::check_non_finite(lhs, rhs);
-    }
-    #endif
-
     using mul_type = std::uint_fast64_t;
 
     const auto isneg {lhs.sign_ != rhs.sign_};
@@ -919,9 +957,27 @@ constexpr auto operator*(const decimal_fast32_t lhs, const decimal_fast32_t rhs)
     BOOST_DECIMAL_ASSERT(res_sig >= 1'000'000 || res_sig == 0U);
     BOOST_DECIMAL_ASSERT(res_exp <= 9'999'999 || res_sig == 0U);
 
+    // Out of range results go through the constructor to overflow to inf or flush to zero
+    if (BOOST_DECIMAL_UNLIKELY(res_exp < 0 || res_exp > detail::max_biased_exp_v<decimal_fast32_t>))
+    {
+        return decimal_fast32_t{res_sig, res_exp - detail::bias, isneg};
+    }
+
     return direct_init(static_cast<decimal_fast32_t::significand_type>(res_sig), static_cast<decimal_fast32_t::exponent_type>(res_exp) , isneg);
 }
 
+constexpr auto operator*(const decimal_fast32_t lhs, const decimal_fast32_t rhs) noexcept -> decimal_fast32_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(lhs) || !isfinite(rhs))
+    {
+        return detail::check_non_finite_mul(lhs, rhs);
+    }
+    #endif
+
+    return unchecked_mul(lhs, rhs);
+}
+
 template <typename Integer>
 constexpr auto operator*(const decimal_fast32_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal_fast32_t)
@@ -969,11 +1025,30 @@ constexpr auto div_impl(const decimal_fast32_t lhs, const decimal_fast32_t rhs,
 
     if (lhs_fp == FP_NAN || rhs_fp == FP_NAN)
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (issignaling(lhs) || issignaling(rhs))
+        {
+            detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        }
+        #endif
+
         q = nan;
         r = nan;
         return;
     }
 
+    // inf / inf and 0 / 0 are invalid operations
+    if (lhs_fp == rhs_fp && (lhs_fp == FP_INFINITE || lhs_fp == FP_ZERO))
+    {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        #endif
+
+        q = nan;
+        r = q;
+        return;
+    }
+
     switch (lhs_fp)
     {
         case FP_INFINITE:
@@ -991,6 +1066,10 @@ constexpr auto div_impl(const decimal_fast32_t lhs, const decimal_fast32_t rhs,
     switch (rhs_fp)
     {
         case FP_ZERO:
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            detail::raise_exception_flag(exception_flag::fe_dec_divbyzero);
+            #endif
+
             q = inf;
             r = zero;
             return;
@@ -1021,6 +1100,14 @@ constexpr auto div_impl(const decimal_fast32_t lhs, const decimal_fast32_t rhs,
     constexpr auto ten_pow_precision {detail::pow10(static_cast<std::uint_fast64_t>(detail::precision_v<decimal32_t>))};
     const auto big_sig_lhs {static_cast<std::uint_fast64_t>(lhs.significand_) * ten_pow_precision};
     auto res_sig {big_sig_lhs / static_cast<std::uint_fast64_t>(rhs.significand_)};
+
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    if (big_sig_lhs % static_cast<std::uint_fast64_t>(rhs.significand_) != 0U)
+    {
+        detail::raise_exception_flag(exception_flag::fe_dec_inexact);
+    }
+    #endif
+
     local_signed_exponent_type res_exp {static_cast<local_signed_exponent_type>(lhs.exponent_) - static_cast<local_signed_exponent_type>(rhs.exponent_) + 94};
     const auto isneg {lhs.sign_ != rhs.sign_};
 
@@ -1033,14 +1120,14 @@ constexpr auto div_impl(const decimal_fast32_t lhs, const decimal_fast32_t rhs,
     BOOST_DECIMAL_ASSERT(res_sig >= 1'000'000 || res_sig == 0U);
     BOOST_DECIMAL_ASSERT(res_exp <= 9'999'999 || res_sig == 0U);
 
-    if (BOOST_DECIMAL_LIKELY(res_exp >= 0))
+    if (BOOST_DECIMAL_LIKELY(res_exp >= 0 && res_exp <= detail::max_biased_exp_v<decimal_fast32_t>))
     {
         q = direct_init(static_cast<decimal_fast32_t::significand_type>(res_sig), static_cast<decimal_fast32_t::exponent_type>(res_exp), isneg);
     }
     else
     {
-        // Flush to zero
-        q = zero;
+        // The constructor overflows to inf or flushes to zero
+        q = decimal_fast32_t{res_sig, res_exp - detail::bias, isneg};
     }
 }
 
@@ -1432,6 +1519,10 @@ constexpr auto quantized32f(const decimal_fast32_t lhs, const decimal_fast32_t r
     // If one is infinity then return a signaling NAN
     if (isinf(lhs) != isinf(rhs))
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        #endif
+
         return direct_init(detail::d32_fast_snan, UINT8_C(0));
     }
     else if (isinf(lhs) && isinf(rhs))
@@ -19,6 +19,7 @@
 #include <boost/decimal/detail/ryu/ryu_generic_128.hpp>
 #include <boost/decimal/detail/promotion.hpp>
 #include <boost/decimal/detail/cmath/next.hpp>
+#include <boost/decimal/detail/hash_impl.hpp>
 #include <boost/decimal/detail/components.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
@@ -37,6 +38,8 @@ BOOST_DECIMAL_CONSTEXPR_VARIABLE auto d64_fast_inf = std::numeric_limits<std::ui
 BOOST_DECIMAL_CONSTEXPR_VARIABLE auto d64_fast_qnan = std::numeric_limits<std::uint64_t>::max() - 2;
 BOOST_DECIMAL_CONSTEXPR_VARIABLE auto d64_fast_snan = std::numeric_limits<std::uint64_t>::max() - 1;
 
+constexpr auto d64_fast_components(const decimal_fast64_t& val) noexcept -> decimal_fast64_t_components;
+
 } // namespace detail
 
 BOOST_DECIMAL_EXPORT class decimal_fast64_t final
@@ -129,6 +132,8 @@ private:
     template <typename ReturnType, typename T>
     friend constexpr auto detail::d64_mul_impl(const T& lhs, const T& rhs) noexcept -> ReturnType;
 
+    friend constexpr auto detail::d64_fast_components(const decimal_fast64_t& val) noexcept -> detail::decimal_fast64_t_components;
+
     template <BOOST_DECIMAL_FAST_DECIMAL_FLOATING_TYPE DecimalType>
     BOOST_DECIMAL_FORCE_INLINE friend constexpr auto fast_equality_impl(const DecimalType& lhs, const DecimalType& rhs) noexcept -> bool;
 
@@ -144,12 +149,18 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
     friend constexpr auto detail::nextafter_impl(DecimalType val, bool direction) noexcept -> DecimalType;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
+    friend constexpr auto detail::canonical_hash(const DecimalType& val) noexcept -> std::size_t;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_scientific_impl(char* first, char* last, const TargetDecimalType& value, chars_format fmt) noexcept -> to_chars_result;
 
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
+    friend constexpr auto detail::to_chars_bulk_finite(char* first, char* last, const TargetDecimalType& value, const chars_format fmt, const char separator) noexcept -> char*;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_hex_impl(char* first, char* last, const TargetDecimalType& value) noexcept -> to_chars_result;
 
@@ -308,6 +319,11 @@ public:
     friend constexpr auto operator+(decimal_fast64_t val) noexcept -> decimal_fast64_t;
     friend constexpr auto operator-(decimal_fast64_t val) noexcept -> decimal_fast64_t;
 
+    // Arithmetic without the checks for non-finite operands
+    friend constexpr auto unchecked_add(decimal_fast64_t lhs, decimal_fast64_t rhs) noexcept -> decimal_fast64_t;
+    friend constexpr auto unchecked_sub(decimal_fast64_t lhs, decimal_fast64_t rhs) noexcept -> decimal_fast64_t;
+    friend constexpr auto unchecked_mul(decimal_fast64_t lhs, decimal_fast64_t rhs) noexcept -> decimal_fast64_t;
+
     // Basic arithmetic operators
     friend constexpr auto operator+(decimal_fast64_t lhs, decimal_fast64_t rhs) noexcept -> decimal_fast64_t;
     friend constexpr auto operator-(decimal_fast64_t lhs, decimal_fast64_t rhs) noexcept -> decimal_fast64_t;
@@ -409,6 +425,10 @@ constexpr decimal_fast64_t::decimal_fast64_t(T1 coeff, T2 exp, bool sign) noexce
 
     if (biased_exp > detail::max_biased_exp_v<decimal64_t>)
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_overflow | exception_flag::fe_dec_inexact);
+        #endif
+
         significand_ = detail::d64_fast_inf;
     }
     else if (biased_exp >= 0)
@@ -417,6 +437,10 @@ constexpr decimal_fast64_t::decimal_fast64_t(T1 coeff, T2 exp, bool sign) noexce
     }
     else
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_underflow | exception_flag::fe_dec_inexact);
+        #endif
+
         // Flush denorms to zero
         significand_ = static_cast<significand_type>(0);
         exponent_ = static_cast<exponent_type>(detail::bias_v<decimal64_t>);
@@ -549,6 +573,15 @@ BOOST_DECIMAL_FORCE_INLINE constexpr auto not_finite(const decimal_fast64_t val)
     return val.significand_ >= detail::d64_fast_inf;
 }
 
+namespace detail {
+
+constexpr auto d64_fast_components(const decimal_fast64_t& val) noexcept -> decimal_fast64_t_components
+{
+    return val.to_components();
+}
+
+} // namespace detail
+
 constexpr auto operator==(const decimal_fast64_t lhs, const decimal_fast64_t rhs) noexcept -> bool
 {
     return fast_equality_impl(lhs, rhs);
@@ -887,19 +920,26 @@ constexpr decimal_fast64_t::operator Decimal() const noexcept
     return to_decimal<Decimal>(*this);
 }
 
+// Arithmetic that assumes both operands are finite.
+// The checks for infinities and NaNs are skipped as with BOOST_DECIMAL_FAST_MATH, but only for these calls
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_add(const decimal_fast64_t lhs, const decimal_fast64_t rhs) noexcept -> decimal_fast64_t
+{
+    return detail::d64_add_impl<decimal_fast64_t>(
+            lhs.significand_, lhs.biased_exponent(), lhs.sign_,
+            rhs.significand_, rhs.biased_exponent(), rhs.sign_,
+            abs_greater_parts_impl(lhs.significand_, lhs.exponent_, rhs.significand_, rhs.exponent_));
+}
+
 constexpr auto operator+(const decimal_fast64_t lhs, const decimal_fast64_t rhs) noexcept -> decimal_fast64_t
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (not_finite(lhs) || not_finite(rhs))
     {
-        return detail::check_non_finite(lhs, rhs);
+        return detail::check_non_finite_add(lhs, rhs);
     }
     #endif
 
-    return detail::d64_add_impl<decimal_fast64_t>(
-            lhs.significand_, lhs.biased_exponent(), lhs.sign_,
-            rhs.significand_, rhs.biased_exponent(), rhs.sign_,
-            (abs(lhs) > abs(rhs)));
+    return unchecked_add(lhs, rhs);
 }
 
 template <typename Integer>
@@ -935,20 +975,25 @@ constexpr auto operator+(const Integer lhs, const decimal_fast64_t rhs) noexcept
     return rhs + lhs;
 }
 
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_sub(const decimal_fast64_t lhs, const decimal_fast64_t rhs) noexcept -> decimal_fast64_t
+{
+    return detail::d64_add_impl<decimal_fast64_t>(
+            lhs.significand_, lhs.biased_exponent(), lhs.sign_,
+            rhs.significand_, rhs.biased_exponent(), !rhs.sign_,
+            abs_greater_parts_impl(lhs.significand_, lhs.exponent_, rhs.significand_, rhs.exponent_)
+    );
+}
+
 constexpr auto operator-(const decimal_fast64_t lhs, const decimal_fast64_t rhs) noexcept -> decimal_fast64_t
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (not_finite(lhs) || not_finite(rhs))
     {
-        return detail::check_non_finite(lhs, rhs);
+        return detail::check_non_finite_add(lhs, rhs, true);
     }
     #endif
 
-    return detail::d64_add_impl<decimal_fast64_t>(
-            lhs.significand_, lhs.biased_exponent(), lhs.sign_,
-            rhs.significand_, rhs.biased_exponent(), !rhs.sign_,
-            abs(lhs) > abs(rhs)
-    );
+    return unchecked_sub(lhs, rhs);
 }
 
 template <typename Integer>
@@ -1003,16 +1048,21 @@ constexpr auto operator-(const Integer lhs, const decimal_fast64_t rhs) noexcept
                                                 abs_lhs_bigger);
 }
 
+BOOST_DECIMAL_EXPORT constexpr auto unchecked_mul(const decimal_fast64_t lhs, const decimal_fast64_t rhs) noexcept -> decimal_fast64_t
+{
+    return detail::d64_mul_impl<decimal_fast64_t>(lhs, rhs);
+}
+
 constexpr auto operator*(const decimal_fast64_t lhs, const decimal_fast64_t rhs) noexcept -> decimal_fast64_t
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (not_finite(lhs) || not_finite(rhs))
     {
-        return detail::check_non_finite(lhs, rhs);
+        return detail::check_non_finite_mul(lhs, rhs);
     }
     #endif
 
-    return detail::d64_mul_impl<decimal_fast64_t>(lhs, rhs);
+    return unchecked_mul(lhs, rhs);
 }
 
 template <typename Integer>
@@ -1062,11 +1112,30 @@ constexpr auto d64_fast_div_impl(const decimal_fast64_t& lhs, const decimal_fast
 
     if (lhs_fp == FP_NAN || rhs_fp == FP_NAN)
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (issignaling(lhs) || issignaling(rhs))
+        {
+            detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        }
+        #endif
+
         q = nan;
         r = nan;
         return;
     }
 
+    // inf / inf and 0 / 0 are invalid operations
+    if (lhs_fp == rhs_fp && (lhs_fp == FP_INFINITE || lhs_fp == FP_ZERO))
+    {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        detail::raise_exception_flag(exception_flag::fe_dec_invalid);
+        #endif
+
+        q = boost::decimal::direct_init_d64(boost::decimal::detail::d64_fast_qnan, 0, false);
+        r = q;
+        return;
+    }
+
     switch (lhs_fp)
     {
         case FP_INFINITE:
@@ -1084,6 +1153,10 @@ constexpr auto d64_fast_div_impl(const decimal_fast64_t& lhs, const decimal_fast
     switch (rhs_fp)
     {
         case FP_ZERO:
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            detail::raise_exception_flag(exception_flag::fe_dec_divbyzero);
+            #endif
+
             q = inf;
             r = zero;
             return;
@@ -1115,6 +1188,13 @@ constexpr auto d64_fast_div_impl(const decimal_fast64_t& lhs, const decimal_fast
     const auto res_sig {big_sig_lhs / static_cast<unsigned_int128_type>(rhs.significand_)};
     const auto res_exp {(lhs.biased_exponent() - detail::precision_v<decimal64_t>) - rhs.biased_exponent()};
 
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    if (big_sig_lhs % static_cast<unsigned_int128_type>(rhs.significand_) != 0U)
+    {
+        detail::raise_exception_flag(exception_flag::fe_dec_inexact);
+    }
+    #endif
+
     BOOST_DECIMAL_ASSERT(res_sig <= std::numeric_limits<std::uint64_t>::max());
 
     q = decimal_fast64_t{static_cast<std::uint64_t>(res_sig), res_exp, sign};
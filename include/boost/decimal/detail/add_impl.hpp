@@ -10,6 +10,7 @@
 #include <boost/decimal/detail/fenv_rounding.hpp>
 #include <boost/decimal/detail/components.hpp>
 #include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
 #include "int128.hpp"
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
@@ -42,6 +43,13 @@ constexpr auto d32_add_impl(const T& lhs, const T& rhs) noexcept -> ReturnType
 
         if (shift > max_shift)
         {
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            if (big_lhs != 0U && big_rhs != 0U)
+            {
+                raise_exception_flag(exception_flag::fe_dec_inexact);
+            }
+            #endif
+
             return big_lhs != 0U && (lhs_exp > rhs_exp) ?
                 ReturnType{lhs.full_significand(), lhs.biased_exponent(), lhs.isneg()} :
                 ReturnType{rhs.full_significand(), rhs.biased_exponent(), rhs.isneg()};
@@ -67,6 +75,42 @@ constexpr auto d32_add_impl(const T& lhs, const T& rhs) noexcept -> ReturnType
     return ReturnType{new_sig, lhs_exp};
 }
 
+// Rounds the sum of two aligned non-negative significands back to 7 digits.
+// max_result_digits_overage is the alignment shift, or 1 if the exponents were equal
+template <typename ReturnType, typename U>
+constexpr auto d32_fast_add_only_round(std::uint_fast64_t res_sig, U lhs_exp, const int max_result_digits_overage) noexcept -> ReturnType
+{
+    using promoted_sig_type = std::uint_fast64_t;
+
+    constexpr promoted_sig_type max_non_normalized_value {9'999'999U};
+    if (res_sig > max_non_normalized_value)
+    {
+        constexpr promoted_sig_type max_non_compensated_value {99'999'999U};
+        if (res_sig > max_non_compensated_value)
+        {
+            const auto offset_power {max_result_digits_overage == 1 ? 1 : max_result_digits_overage - 1};
+            const auto offset {detail::pow10(static_cast<promoted_sig_type>(offset_power))};
+
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            if (res_sig % offset != 0U)
+            {
+                raise_exception_flag(exception_flag::fe_dec_inexact);
+            }
+            #endif
+
+            res_sig /= offset;
+            lhs_exp += offset_power;
+        }
+
+        lhs_exp += detail::fenv_round<decimal32_t, rounding_policy_t<ReturnType>>(res_sig, false);
+    }
+
+    BOOST_DECIMAL_ASSERT(res_sig >= 1'000'000U || res_sig == 0U);
+    BOOST_DECIMAL_ASSERT(res_sig <= max_non_normalized_value || res_sig == 0U);
+
+    return ReturnType{static_cast<typename ReturnType::significand_type>(res_sig), lhs_exp, false};
+}
+
 template <typename ReturnType, typename T>
 constexpr auto d32_fast_add_only_impl(const T& lhs, const T& rhs) noexcept -> ReturnType
 {
@@ -90,6 +134,13 @@ constexpr auto d32_fast_add_only_impl(const T& lhs, const T& rhs) noexcept -> Re
 
         if (shift > max_shift)
         {
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            if (big_lhs != 0U && big_rhs != 0U)
+            {
+                raise_exception_flag(exception_flag::fe_dec_inexact);
+            }
+            #endif
+
             return big_lhs != 0U && (lhs_exp > rhs_exp) ?
                 ReturnType{lhs.full_significand(), lhs.biased_exponent(), lhs.isneg()} :
                 ReturnType{rhs.full_significand(), rhs.biased_exponent(), rhs.isneg()};
@@ -109,27 +160,7 @@ constexpr auto d32_fast_add_only_impl(const T& lhs, const T& rhs) noexcept -> Re
         max_result_digits_overage = static_cast<int>(shift);
     }
 
-    auto res_sig {big_lhs + big_rhs};
-
-    constexpr promoted_sig_type max_non_normalized_value {9'999'999U};
-    if (res_sig > max_non_normalized_value)
-    {
-        constexpr promoted_sig_type max_non_compensated_value {99'999'999U};
-        if (res_sig > max_non_compensated_value)
-        {
-            const auto offset_power {max_result_digits_overage == 1 ? 1 : max_result_digits_overage - 1};
-            const auto offset {detail::pow10(static_cast<promoted_sig_type>(offset_power))};
-            res_sig /= offset;
-            lhs_exp += offset_power;
-        }
-
-        lhs_exp += detail::fenv_round(res_sig, false);
-    }
-
-    BOOST_DECIMAL_ASSERT(res_sig >= 1'000'000U || res_sig == 0U);
-    BOOST_DECIMAL_ASSERT(res_sig <= max_non_normalized_value || res_sig == 0U);
-
-    return ReturnType{static_cast<typename ReturnType::significand_type>(res_sig), lhs_exp, false};
+    return d32_fast_add_only_round<ReturnType>(big_lhs + big_rhs, lhs_exp, max_result_digits_overage);
 }
 
 template <typename ReturnType, typename T, typename U>
@@ -153,6 +184,13 @@ constexpr auto d32_add_impl(T lhs_sig, U lhs_exp, bool lhs_sign,
 
         if (shift > max_shift)
         {
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            if (lhs_sig != 0U && rhs_sig != 0U)
+            {
+                raise_exception_flag(exception_flag::fe_dec_inexact);
+            }
+            #endif
+
             return lhs_sig != 0U && (lhs_exp > rhs_exp) ? ReturnType{lhs_sig, lhs_exp, lhs_sign} : ReturnType{rhs_sig, rhs_exp, rhs_sign};
         }
 
@@ -199,6 +237,13 @@ constexpr auto d64_add_impl(const T& lhs, const T& rhs) noexcept -> ReturnType
 
         if (shift > max_shift)
         {
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            if (big_lhs != 0U && big_rhs != 0U)
+            {
+                raise_exception_flag(exception_flag::fe_dec_inexact);
+            }
+            #endif
+
             return lhs.full_significand() != 0U && (lhs_exp > rhs_exp) ?
                 ReturnType{lhs.full_significand(), lhs.biased_exponent(), lhs.isneg()} :
                 ReturnType{rhs.full_significand(), rhs.biased_exponent(), rhs.isneg()};
@@ -250,6 +295,13 @@ constexpr auto d64_add_impl(T lhs_sig, U lhs_exp, bool lhs_sign,
         //
         // e.g. 1e20 + 1e-20 = 1e20
 
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (lhs_sig != 0U && rhs_sig != 0U)
+        {
+            raise_exception_flag(exception_flag::fe_dec_inexact);
+        }
+        #endif
+
         return abs_lhs_bigger ? ReturnType{lhs_sig, lhs_exp, lhs_sign} :
                                 ReturnType{rhs_sig, rhs_exp, rhs_sign};
     }
@@ -278,13 +330,20 @@ constexpr auto d64_add_impl(T lhs_sig, U lhs_exp, bool lhs_sign,
 
         if (delta_exp > 1)
         {
-            sig_smaller /= pow10(static_cast<add_type>(delta_exp - 1));
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            if (sig_smaller % pow10(static_cast<add_type>(delta_exp - 1)) != 0)
+            {
+                raise_exception_flag(exception_flag::fe_dec_inexact);
+            }
+            #endif
+
+            sig_smaller = div_pow10(sig_smaller, delta_exp - 1);
             delta_exp = 1;
         }
 
         if (delta_exp == 1)
         {
-            detail::fenv_round<decimal64_t>(sig_smaller, sign_smaller);
+            detail::fenv_round<decimal64_t, rounding_policy_t<ReturnType>>(sig_smaller, sign_smaller);
         }
     }
 
@@ -325,6 +384,13 @@ constexpr auto d128_add_impl(T1 lhs_sig, U1 lhs_exp, bool lhs_sign,
         //
         // e.g. 1e20 + 1e-20 = 1e20
 
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (rhs_sig != 0U)
+        {
+            raise_exception_flag(exception_flag::fe_dec_inexact);
+        }
+        #endif
+
         return {lhs_sig, lhs_exp, lhs_sign};
     }
 
@@ -335,6 +401,13 @@ constexpr auto d128_add_impl(T1 lhs_sig, U1 lhs_exp, bool lhs_sign,
         //
         // e.g. 1.234567e5 + 9.876543e-2 = 1.234568e5
 
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (rhs_sig != 0U)
+        {
+            raise_exception_flag(exception_flag::fe_dec_inexact);
+        }
+        #endif
+
         BOOST_DECIMAL_IF_CONSTEXPR (std::numeric_limits<T2>::digits10 > std::numeric_limits<std::uint64_t>::digits10)
         {
             constexpr boost::int128::uint128_t max_value {UINT64_C(0xF684DF56C3E0), UINT64_C(0x1BC6C73200000000)};
@@ -369,13 +442,20 @@ constexpr auto d128_add_impl(T1 lhs_sig, U1 lhs_exp, bool lhs_sign,
 
         if (delta_exp > 1)
         {
-            rhs_sig /= pow10(static_cast<boost::int128::uint128_t>(delta_exp - 1));
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            if (rhs_sig % pow10(static_cast<boost::int128::uint128_t>(delta_exp - 1)) != 0U)
+            {
+                raise_exception_flag(exception_flag::fe_dec_inexact);
+            }
+            #endif
+
+            rhs_sig = div_pow10(rhs_sig, delta_exp - 1);
             delta_exp = 1;
         }
 
         if (delta_exp == 1)
         {
-            detail::fenv_round<decimal128_t>(rhs_sig, rhs_sign);
+            detail::fenv_round<decimal128_t, rounding_policy_t<ReturnType>>(rhs_sig, rhs_sign);
         }
     }
 
@@ -413,6 +493,13 @@ constexpr auto d128_add_impl(T lhs_sig, U lhs_exp, bool lhs_sign,
         //
         // e.g. 1e20 + 1e-20 = 1e20
 
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (lhs_sig != 0U && rhs_sig != 0U)
+        {
+            raise_exception_flag(exception_flag::fe_dec_inexact);
+        }
+        #endif
+
         return abs_lhs_bigger ? ReturnType{lhs_sig, lhs_exp, lhs_sign} :
                                 ReturnType{rhs_sig, rhs_exp, rhs_sign};
     }
@@ -442,13 +529,20 @@ constexpr auto d128_add_impl(T lhs_sig, U lhs_exp, bool lhs_sign,
 
         if (delta_exp > 1)
         {
-            sig_smaller /= pow10(static_cast<boost::int128::uint128_t>(delta_exp - 1));
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            if (sig_smaller % pow10(static_cast<boost::int128::uint128_t>(delta_exp - 1)) != 0U)
+            {
+                raise_exception_flag(exception_flag::fe_dec_inexact);
+            }
+            #endif
+
+            sig_smaller = div_pow10(sig_smaller, delta_exp - 1);
             delta_exp = 1;
         }
 
         if (delta_exp == 1)
         {
-            detail::fenv_round<decimal128_t>(sig_smaller, sign_smaller);
+            detail::fenv_round<decimal128_t, rounding_policy_t<ReturnType>>(sig_smaller, sign_smaller);
         }
     }
 
@@ -0,0 +1,548 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_BATCH_D32_IMPL_HPP
+#define BOOST_DECIMAL_DETAIL_BATCH_D32_IMPL_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/detail/add_impl.hpp>
+#include <boost/decimal/detail/apply_sign.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/cfenv.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <cstdint>
+#endif
+
+namespace boost {
+namespace decimal {
+namespace detail {
+
+// Number of elements that are decoded together before any arithmetic is performed.
+// Eight 64-bit lanes fill one 512-bit register, or two 256-bit registers
+BOOST_DECIMAL_CONSTEXPR_VARIABLE std::size_t batch_block_size {8U};
+
+// The 32-bit types are processed in blocks of eight lanes.
+// For decimal32_t everything up to and including the encoding of the result is done in SIMD registers:
+// decoding, normalizing, aligning the exponents, forming the 64-bit significands,
+// and rounding back to 7 digits with the current rounding mode.
+// For decimal_fast32_t the lanes stop after the alignment, and each sum is rounded
+// by the same function as the scalar operator.
+//
+// Lanes that are not simple (non-finite operands, non-canonical significands, exponents too far
+// apart to align, or results that underflow or overflow) are computed with the scalar operator instead,
+// so the results are always bit-identical to the scalar operators.
+
+struct d32_batch_encoded_lanes
+{
+    std::uint32_t bits[batch_block_size];
+    std::uint32_t simple[batch_block_size];
+};
+
+struct d32_batch_sum_lanes
+{
+    std::uint64_t lhs_sig[batch_block_size];
+    std::uint64_t rhs_sig[batch_block_size];
+    std::int32_t exp[batch_block_size];
+    std::int32_t shift[batch_block_size];
+    std::uint32_t lhs_sign[batch_block_size];
+    std::uint32_t rhs_sign[batch_block_size];
+    std::uint32_t simple[batch_block_size];
+};
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto d32_batch_finish(const d32_batch_encoded_lanes& lanes, const std::size_t j, decimal32_t& result) noexcept -> void
+{
+    result = from_bits(lanes.bits[j]);
+}
+
+// The tail of decimal_fast32_t::operator+ after the significands have been aligned,
+// which takes a different path when both operands are non-negative
+BOOST_DECIMAL_FORCE_INLINE constexpr auto d32_batch_finish(const d32_batch_sum_lanes& lanes, const std::size_t j, decimal_fast32_t& result) noexcept -> void
+{
+    using add_type = std::int_fast64_t;
+
+    const auto new_exp {static_cast<decimal_fast32_t::biased_exponent_type>(lanes.exp[j])};
+
+    if (lanes.lhs_sign[j] != 0U || lanes.rhs_sign[j] != 0U)
+    {
+        const auto signed_lhs {make_signed_value<add_type>(static_cast<add_type>(lanes.lhs_sig[j]), lanes.lhs_sign[j] != 0U)};
+        const auto signed_rhs {make_signed_value<add_type>(static_cast<add_type>(lanes.rhs_sig[j]), lanes.rhs_sign[j] != 0U)};
+        const auto new_sig {signed_lhs + signed_rhs};
+
+        result = decimal_fast32_t{new_sig, new_exp};
+    }
+    else
+    {
+        const auto max_result_digits_overage {lanes.shift[j] == 0 ? 1 : static_cast<int>(lanes.shift[j])};
+        const auto res {d32_fast_add_only_round<decimal_fast32_t_components>(lanes.lhs_sig[j] + lanes.rhs_sig[j], new_exp, max_result_digits_overage)};
+
+        result = direct_init(res);
+    }
+}
+
+#ifdef BOOST_DECIMAL_HAS_AVX2_DISPATCH
+
+#define BOOST_DECIMAL_AVX2_TARGET __attribute__((target("avx2")))
+
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_set1(const std::uint32_t val) noexcept -> __m256i
+{
+    return _mm256_set1_epi32(static_cast<int>(val));
+}
+
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_set1_64(const std::uint64_t val) noexcept -> __m256i
+{
+    return _mm256_set1_epi64x(static_cast<long long>(val));
+}
+
+// 10^k for k in [0, 8] in each 32-bit lane
+// Gathers are slow on many CPUs, so look the powers up with a permutation instead
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_pow10(const __m256i exponents) noexcept -> __m256i
+{
+    const __m256i powers {_mm256_setr_epi32(1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000)};
+    const __m256i small_powers {_mm256_permutevar8x32_epi32(powers, exponents)};
+
+    return _mm256_blendv_epi8(small_powers, _mm256_set1_epi32(100'000'000), _mm256_cmpgt_epi32(exponents, _mm256_set1_epi32(7)));
+}
+
+// Zero extends (or sign extends) the lower or upper four 32-bit lanes to 64 bits
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_lo64(const __m256i val) noexcept -> __m256i
+{
+    return _mm256_cvtepu32_epi64(_mm256_castsi256_si128(val));
+}
+
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_hi64(const __m256i val) noexcept -> __m256i
+{
+    return _mm256_cvtepu32_epi64(_mm256_extracti128_si256(val, 1));
+}
+
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_signed_lo64(const __m256i val) noexcept -> __m256i
+{
+    return _mm256_cvtepi32_epi64(_mm256_castsi256_si128(val));
+}
+
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_signed_hi64(const __m256i val) noexcept -> __m256i
+{
+    return _mm256_cvtepi32_epi64(_mm256_extracti128_si256(val, 1));
+}
+
+// Truncates two sets of four 64-bit lanes into eight 32-bit lanes
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_narrow(const __m256i lo, const __m256i hi) noexcept -> __m256i
+{
+    const __m256i even_first {_mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7)};
+
+    return _mm256_permute2x128_si256(_mm256_permutevar8x32_epi32(lo, even_first),
+                                     _mm256_permutevar8x32_epi32(hi, even_first), 0x20);
+}
+
+// Exact conversions between integers in [0, 2^52) and doubles
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_to_double(const __m256i val) noexcept -> __m256d
+{
+    const __m256d two_52 {_mm256_set1_pd(4503599627370496.0)};
+    return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(val, _mm256_castpd_si256(two_52))), two_52);
+}
+
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_to_int(const __m256d val) noexcept -> __m256i
+{
+    const __m256d two_52 {_mm256_set1_pd(4503599627370496.0)};
+    return _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(val, two_52)), _mm256_castpd_si256(two_52));
+}
+
+// 32 x 32 -> 64-bit multiplication of all eight lanes, stored in lane order
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_widening_mul(const __m256i lhs, const __m256i rhs, std::uint64_t* result) noexcept -> void
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(result), _mm256_mul_epu32(d32_avx2_lo64(lhs), d32_avx2_lo64(rhs)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + 4), _mm256_mul_epu32(d32_avx2_hi64(lhs), d32_avx2_hi64(rhs)));
+}
+
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_store(const __m256i val, void* result) noexcept -> void
+{
+    _mm256_storeu_si256(static_cast<__m256i*>(result), val);
+}
+
+// Vector version of decimal32_t::to_components
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_decode(const decimal32_t* values, __m256i& sig, __m256i& exp, __m256i& sign, __m256i& finite) noexcept -> void
+{
+    std::uint32_t bits_block[batch_block_size];
+    for (std::size_t j {}; j < batch_block_size; ++j)
+    {
+        bits_block[j] = to_bits(values[j]);
+    }
+
+    const __m256i bits {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits_block))};
+
+    const __m256i comb_11_mask {d32_avx2_set1(d32_comb_11_mask)};
+    const __m256i comb_11 {_mm256_cmpeq_epi32(_mm256_and_si256(bits, comb_11_mask), comb_11_mask)};
+
+    constexpr std::uint32_t implied_bit {UINT32_C(0b100000000000000000000000)};
+    const __m256i sig_11 {_mm256_or_si256(d32_avx2_set1(implied_bit), _mm256_and_si256(bits, d32_avx2_set1(d32_11_significand_mask)))};
+    const __m256i sig_not_11 {_mm256_and_si256(bits, d32_avx2_set1(d32_not_11_significand_mask))};
+    sig = _mm256_blendv_epi8(sig_not_11, sig_11, comb_11);
+
+    const __m256i exp_11 {_mm256_srli_epi32(_mm256_and_si256(bits, d32_avx2_set1(d32_11_exp_mask)), static_cast<int>(d32_11_exp_shift))};
+    const __m256i exp_not_11 {_mm256_srli_epi32(_mm256_and_si256(bits, d32_avx2_set1(d32_not_11_exp_mask)), static_cast<int>(d32_not_11_exp_shift))};
+    exp = _mm256_sub_epi32(_mm256_blendv_epi8(exp_not_11, exp_11, comb_11), _mm256_set1_epi32(bias_v<decimal32_t>));
+
+    // All ones for negative values
+    sign = _mm256_srai_epi32(bits, 31);
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    const __m256i inf_mask {d32_avx2_set1(d32_inf_mask)};
+    finite = _mm256_xor_si256(_mm256_cmpeq_epi32(_mm256_and_si256(bits, inf_mask), inf_mask), _mm256_set1_epi32(-1));
+    #else
+    finite = _mm256_set1_epi32(-1);
+    #endif
+}
+
+// decimal_fast32_t is already decoded, so only transpose into lanes
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_decode(const decimal_fast32_t* values, __m256i& sig, __m256i& exp, __m256i& sign, __m256i& finite) noexcept -> void
+{
+    std::uint32_t sig_block[batch_block_size];
+    std::int32_t exp_block[batch_block_size];
+    std::int32_t sign_block[batch_block_size];
+
+    for (std::size_t j {}; j < batch_block_size; ++j)
+    {
+        const auto components {d32_fast_components(values[j])};
+        sig_block[j] = components.sig;
+        exp_block[j] = components.exp;
+        sign_block[j] = components.sign ? -1 : 0;
+    }
+
+    sig = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(sig_block));
+    exp = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(exp_block));
+    sign = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(sign_block));
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    // Unsigned sig < d32_fast_inf
+    const __m256i flip {d32_avx2_set1(UINT32_C(0x80000000))};
+    finite = _mm256_cmpgt_epi32(_mm256_xor_si256(d32_avx2_set1(d32_fast_inf), flip), _mm256_xor_si256(sig, flip));
+    #else
+    finite = _mm256_set1_epi32(-1);
+    #endif
+}
+
+// Vector version of normalize<decimal32_t>
+// Significands with more than 7 digits are non-canonical and need rounding, so they are not simple
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_normalize(__m256i& sig, __m256i& exp, __m256i& simple) noexcept -> void
+{
+    // A decoded significand has at most 24 bits, so at most 8 digits
+    __m256i digits {_mm256_set1_epi32(1)};
+    for (std::size_t k {1}; k <= 7U; ++k)
+    {
+        const __m256i threshold {d32_avx2_set1(impl::powers_of_10_u32[k] - 1U)};
+        digits = _mm256_sub_epi32(digits, _mm256_cmpgt_epi32(sig, threshold));
+    }
+
+    const __m256i target_precision {_mm256_set1_epi32(precision_v<decimal32_t>)};
+    simple = _mm256_andnot_si256(_mm256_cmpgt_epi32(digits, target_precision), simple);
+
+    const __m256i zeros_needed {_mm256_max_epi32(_mm256_sub_epi32(target_precision, digits), _mm256_setzero_si256())};
+    sig = _mm256_mullo_epi32(sig, d32_avx2_pow10(zeros_needed));
+    exp = _mm256_sub_epi32(exp, zeros_needed);
+}
+
+// Vector version of the alignment in d32_add_impl:
+// the operand with the larger exponent is scaled up to the smaller exponent
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_align(const __m256i lhs_exp, const __m256i rhs_exp, __m256i& simple,
+                                                     __m256i& lhs_pow, __m256i& rhs_pow, __m256i& shift) noexcept -> void
+{
+    const __m256i diff {_mm256_sub_epi32(lhs_exp, rhs_exp)};
+    shift = _mm256_abs_epi32(diff);
+
+    const __m256i max_shift {_mm256_set1_epi32(precision_v<decimal32_t> + 1)};
+    simple = _mm256_andnot_si256(_mm256_cmpgt_epi32(shift, max_shift), simple);
+
+    const __m256i clamped_shift {_mm256_min_epi32(shift, max_shift)};
+    const __m256i zero {_mm256_setzero_si256()};
+    lhs_pow = d32_avx2_pow10(_mm256_and_si256(clamped_shift, _mm256_cmpgt_epi32(diff, zero)));
+    rhs_pow = d32_avx2_pow10(_mm256_and_si256(clamped_shift, _mm256_cmpgt_epi32(zero, diff)));
+}
+
+// Vector version of the decimal32_t constructor for four 64-bit lanes.
+// The coefficients must be less than 2^52 so that they are exact as doubles.
+// Lanes that are out of range before or after rounding are cleared in simple
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_round_encode(const __m256i coeff, const __m256i exp, const __m256i sign,
+                                                            const rounding_mode round, __m256i& simple) noexcept -> __m256i
+{
+    const __m256i zero {_mm256_setzero_si256()};
+    const __m256i one {_mm256_set1_epi64x(1)};
+    const __m256i max_canonical {d32_avx2_set1_64(d32_max_significand_value)};
+
+    // coefficient_rounding keeps 8 digits, and then fenv_round removes the last one
+    __m256i shift {zero};
+    for (std::size_t k {8}; k < 16U; ++k)
+    {
+        shift = _mm256_sub_epi64(shift, _mm256_cmpgt_epi64(coeff, d32_avx2_set1_64(impl::powers_of_10[k] - 1U)));
+    }
+
+    const __m256i need_round {_mm256_cmpgt_epi64(coeff, max_canonical)};
+
+    const __m256d coeff_d {d32_avx2_to_double(coeff)};
+    const __m256d shift_pow {d32_avx2_to_double(_mm256_and_si256(d32_avx2_pow10(shift), _mm256_set1_epi64x(0xFFFFFFFF)))};
+    __m256d kept {_mm256_floor_pd(_mm256_div_pd(coeff_d, shift_pow))};
+    __m256d removed {_mm256_sub_pd(coeff_d, _mm256_mul_pd(kept, shift_pow))};
+
+    // The quotient is correctly rounded, so its floor can only ever be one too large
+    const __m256d too_large {_mm256_cmp_pd(removed, _mm256_setzero_pd(), _CMP_LT_OQ)};
+    kept = _mm256_sub_pd(kept, _mm256_and_pd(too_large, _mm256_set1_pd(1.0)));
+    removed = _mm256_add_pd(removed, _mm256_and_pd(too_large, shift_pow));
+
+    const __m256i sticky {_mm256_castpd_si256(_mm256_cmp_pd(removed, _mm256_setzero_pd(), _CMP_NEQ_OQ))};
+
+    const __m256d ten {_mm256_set1_pd(10.0)};
+    const __m256d res_d {_mm256_floor_pd(_mm256_div_pd(kept, ten))};
+    const __m256i trailing {d32_avx2_to_int(_mm256_sub_pd(kept, _mm256_mul_pd(res_d, ten)))};
+    __m256i res {d32_avx2_to_int(res_d)};
+
+    // Same decisions as fenv_round
+    const __m256i five {_mm256_set1_epi64x(5)};
+    const __m256i inexact {_mm256_or_si256(_mm256_xor_si256(_mm256_cmpeq_epi64(trailing, zero), _mm256_set1_epi64x(-1)), sticky)};
+    __m256i round_up {zero};
+
+    switch (round)
+    {
+        case rounding_mode::fe_dec_to_nearest_from_zero:
+            round_up = _mm256_cmpgt_epi64(trailing, _mm256_set1_epi64x(4));
+            break;
+        case rounding_mode::fe_dec_downward:
+            round_up = _mm256_and_si256(sign, inexact);
+            break;
+        case rounding_mode::fe_dec_to_nearest:
+        {
+            const __m256i odd {_mm256_cmpeq_epi64(_mm256_and_si256(res, one), one)};
+            const __m256i tie_up {_mm256_and_si256(_mm256_cmpeq_epi64(trailing, five), _mm256_or_si256(sticky, odd))};
+            round_up = _mm256_or_si256(_mm256_cmpgt_epi64(trailing, five), tie_up);
+            break;
+        }
+        case rounding_mode::fe_dec_toward_zero:
+            break;
+        case rounding_mode::fe_dec_upward:
+            round_up = _mm256_andnot_si256(sign, inexact);
+            break;
+        // LCOV_EXCL_START
+        default:
+            BOOST_DECIMAL_UNREACHABLE;
+        // LCOV_EXCL_STOP
+    }
+
+    res = _mm256_sub_epi64(res, round_up);
+
+    // Rounding 9'999'999.5 up gives 10'000'000
+    const __m256i overflow {_mm256_cmpgt_epi64(res, max_canonical)};
+    res = _mm256_blendv_epi8(res, _mm256_set1_epi64x(1'000'000), overflow);
+
+    const __m256i removed_digits {_mm256_sub_epi64(_mm256_add_epi64(shift, one), overflow)};
+    const __m256i biased_exp {_mm256_add_epi64(exp, _mm256_set1_epi64x(bias_v<decimal32_t>))};
+    const __m256i final_coeff {_mm256_blendv_epi8(coeff, res, need_round)};
+    const __m256i final_exp {_mm256_add_epi64(biased_exp, _mm256_and_si256(removed_digits, need_round))};
+
+    // Zeros only keep their sign, anything else has to fit the exponent field as is
+    const __m256i is_zero {_mm256_cmpeq_epi64(coeff, zero)};
+    const __m256i out_of_range {_mm256_or_si256(_mm256_cmpgt_epi64(zero, biased_exp),
+                                                _mm256_cmpgt_epi64(final_exp, d32_avx2_set1_64(d32_max_biased_exponent)))};
+    simple = _mm256_and_si256(simple, _mm256_or_si256(is_zero, _mm256_xor_si256(out_of_range, _mm256_set1_epi64x(-1))));
+
+    const __m256i big_combination {_mm256_cmpgt_epi64(final_coeff, d32_avx2_set1_64(d32_biggest_no_combination_significand))};
+
+    const __m256i not_11_bits {_mm256_or_si256(final_coeff,
+        _mm256_and_si256(_mm256_slli_epi64(final_exp, static_cast<int>(d32_not_11_exp_shift)), d32_avx2_set1_64(d32_not_11_exp_mask)))};
+
+    const __m256i bits_11 {_mm256_or_si256(_mm256_or_si256(d32_avx2_set1_64(d32_comb_11_mask), _mm256_and_si256(final_coeff, d32_avx2_set1_64(d32_11_significand_mask))),
+        _mm256_and_si256(_mm256_slli_epi64(final_exp, static_cast<int>(d32_11_exp_shift)), d32_avx2_set1_64(d32_11_exp_mask)))};
+
+    const __m256i sign_bits {_mm256_and_si256(sign, d32_avx2_set1_64(d32_sign_mask))};
+
+    return _mm256_or_si256(_mm256_andnot_si256(is_zero, _mm256_blendv_epi8(not_11_bits, bits_11, big_combination)), sign_bits);
+}
+
+// Signed addition of the aligned significands, with all ones in the sign lanes of negative values
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_signed_sum(const __m256i lhs, const __m256i lhs_sign, const __m256i rhs, const __m256i rhs_sign) noexcept -> __m256i
+{
+    return _mm256_add_epi64(_mm256_sub_epi64(_mm256_xor_si256(lhs, lhs_sign), lhs_sign),
+                            _mm256_sub_epi64(_mm256_xor_si256(rhs, rhs_sign), rhs_sign));
+}
+
+// decimal32_t::operator+ for a full block
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_sum_lanes(const decimal32_t* lhs, const decimal32_t* rhs, const rounding_mode round, d32_batch_encoded_lanes& lanes) noexcept -> void
+{
+    __m256i lhs_sig, lhs_exp, lhs_sign, lhs_finite;
+    __m256i rhs_sig, rhs_exp, rhs_sign, rhs_finite;
+
+    d32_avx2_decode(lhs, lhs_sig, lhs_exp, lhs_sign, lhs_finite);
+    d32_avx2_decode(rhs, rhs_sig, rhs_exp, rhs_sign, rhs_finite);
+
+    __m256i simple {_mm256_and_si256(lhs_finite, rhs_finite)};
+    d32_avx2_normalize(lhs_sig, lhs_exp, simple);
+    d32_avx2_normalize(rhs_sig, rhs_exp, simple);
+
+    __m256i lhs_pow, rhs_pow, shift;
+    d32_avx2_align(lhs_exp, rhs_exp, simple, lhs_pow, rhs_pow, shift);
+    const __m256i exp {_mm256_min_epi32(lhs_exp, rhs_exp)};
+
+    // The aligned significands are less than 10^15
+    const __m256i zero {_mm256_setzero_si256()};
+
+    const __m256i sum_lo {d32_avx2_signed_sum(_mm256_mul_epu32(d32_avx2_lo64(lhs_sig), d32_avx2_lo64(lhs_pow)), d32_avx2_signed_lo64(lhs_sign),
+                                     _mm256_mul_epu32(d32_avx2_lo64(rhs_sig), d32_avx2_lo64(rhs_pow)), d32_avx2_signed_lo64(rhs_sign))};
+    const __m256i neg_lo {_mm256_cmpgt_epi64(zero, sum_lo)};
+    __m256i simple_lo {d32_avx2_signed_lo64(simple)};
+    const __m256i bits_lo {d32_avx2_round_encode(_mm256_sub_epi64(_mm256_xor_si256(sum_lo, neg_lo), neg_lo), d32_avx2_signed_lo64(exp), neg_lo, round, simple_lo)};
+
+    const __m256i sum_hi {d32_avx2_signed_sum(_mm256_mul_epu32(d32_avx2_hi64(lhs_sig), d32_avx2_hi64(lhs_pow)), d32_avx2_signed_hi64(lhs_sign),
+                                     _mm256_mul_epu32(d32_avx2_hi64(rhs_sig), d32_avx2_hi64(rhs_pow)), d32_avx2_signed_hi64(rhs_sign))};
+    const __m256i neg_hi {_mm256_cmpgt_epi64(zero, sum_hi)};
+    __m256i simple_hi {d32_avx2_signed_hi64(simple)};
+    const __m256i bits_hi {d32_avx2_round_encode(_mm256_sub_epi64(_mm256_xor_si256(sum_hi, neg_hi), neg_hi), d32_avx2_signed_hi64(exp), neg_hi, round, simple_hi)};
+
+    d32_avx2_store(d32_avx2_narrow(bits_lo, bits_hi), lanes.bits);
+    d32_avx2_store(d32_avx2_narrow(simple_lo, simple_hi), lanes.simple);
+}
+
+// decimal32_t::operator* for a full block
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_product_lanes(const decimal32_t* lhs, const decimal32_t* rhs, const rounding_mode round, d32_batch_encoded_lanes& lanes) noexcept -> void
+{
+    __m256i lhs_sig, lhs_exp, lhs_sign, lhs_finite;
+    __m256i rhs_sig, rhs_exp, rhs_sign, rhs_finite;
+
+    d32_avx2_decode(lhs, lhs_sig, lhs_exp, lhs_sign, lhs_finite);
+    d32_avx2_decode(rhs, rhs_sig, rhs_exp, rhs_sign, rhs_finite);
+
+    const __m256i simple {_mm256_and_si256(lhs_finite, rhs_finite)};
+    const __m256i exp {_mm256_add_epi32(lhs_exp, rhs_exp)};
+    const __m256i sign {_mm256_xor_si256(lhs_sign, rhs_sign)};
+
+    // Products of the significands are less than 2^48
+    __m256i simple_lo {d32_avx2_signed_lo64(simple)};
+    const __m256i bits_lo {d32_avx2_round_encode(_mm256_mul_epu32(d32_avx2_lo64(lhs_sig), d32_avx2_lo64(rhs_sig)),
+                                                 d32_avx2_signed_lo64(exp), d32_avx2_signed_lo64(sign), round, simple_lo)};
+
+    __m256i simple_hi {d32_avx2_signed_hi64(simple)};
+    const __m256i bits_hi {d32_avx2_round_encode(_mm256_mul_epu32(d32_avx2_hi64(lhs_sig), d32_avx2_hi64(rhs_sig)),
+                                                 d32_avx2_signed_hi64(exp), d32_avx2_signed_hi64(sign), round, simple_hi)};
+
+    d32_avx2_store(d32_avx2_narrow(bits_lo, bits_hi), lanes.bits);
+    d32_avx2_store(d32_avx2_narrow(simple_lo, simple_hi), lanes.simple);
+}
+
+// decimal_fast32_t::operator+ up to the rounding
+// decimal_fast32_t significands are always normalized
+BOOST_DECIMAL_AVX2_TARGET inline auto d32_avx2_sum_lanes(const decimal_fast32_t* lhs, const decimal_fast32_t* rhs, rounding_mode, d32_batch_sum_lanes& lanes) noexcept -> void
+{
+    __m256i lhs_sig, lhs_exp, lhs_sign, lhs_finite;
+    __m256i rhs_sig, rhs_exp, rhs_sign, rhs_finite;
+
+    d32_avx2_decode(lhs, lhs_sig, lhs_exp, lhs_sign, lhs_finite);
+    d32_avx2_decode(rhs, rhs_sig, rhs_exp, rhs_sign, rhs_finite);
+
+    __m256i simple {_mm256_and_si256(lhs_finite, rhs_finite)};
+    __m256i lhs_pow, rhs_pow, shift;
+    d32_avx2_align(lhs_exp, rhs_exp, simple, lhs_pow, rhs_pow, shift);
+
+    d32_avx2_widening_mul(lhs_sig, lhs_pow, lanes.lhs_sig);
+    d32_avx2_widening_mul(rhs_sig, rhs_pow, lanes.rhs_sig);
+
+    d32_avx2_store(_mm256_min_epi32(lhs_exp, rhs_exp), lanes.exp);
+    d32_avx2_store(shift, lanes.shift);
+    d32_avx2_store(lhs_sign, lanes.lhs_sign);
+    d32_avx2_store(rhs_sign, lanes.rhs_sign);
+    d32_avx2_store(simple, lanes.simple);
+}
+
+#undef BOOST_DECIMAL_AVX2_TARGET
+
+inline auto d32_avx2_supported() noexcept -> bool
+{
+    return __builtin_cpu_supports("avx2");
+}
+
+// Returns the number of leading elements that have been computed, which is a multiple of the block size
+template <typename Lanes, typename DecimalType, typename LaneFunc, typename ScalarFunc>
+inline auto d32_avx2_batch(const DecimalType* lhs, const DecimalType* rhs, DecimalType* result, const std::size_t n,
+                           LaneFunc lane_func, ScalarFunc scalar_func) noexcept -> std::size_t
+{
+    if (!d32_avx2_supported())
+    {
+        return 0U;
+    }
+
+    // The rounding mode can not change during the call
+    const auto round {fegetround()};
+    Lanes lanes;
+
+    std::size_t i {};
+    for (; n - i >= batch_block_size; i += batch_block_size)
+    {
+        lane_func(lhs + i, rhs + i, round, lanes);
+
+        for (std::size_t j {}; j < batch_block_size; ++j)
+        {
+            if (BOOST_DECIMAL_LIKELY(lanes.simple[j] != 0U))
+            {
+                d32_batch_finish(lanes, j, result[i + j]);
+            }
+            else
+            {
+                result[i + j] = scalar_func(lhs[i + j], rhs[i + j]);
+            }
+        }
+    }
+
+    return i;
+}
+
+inline auto d32_batch_add_simd(const decimal32_t* lhs, const decimal32_t* rhs, decimal32_t* result, const std::size_t n) noexcept -> std::size_t
+{
+    return d32_avx2_batch<d32_batch_encoded_lanes>(lhs, rhs, result, n,
+        [](const decimal32_t* lhs_block, const decimal32_t* rhs_block, const rounding_mode round, d32_batch_encoded_lanes& lanes) { d32_avx2_sum_lanes(lhs_block, rhs_block, round, lanes); },
+        [](const decimal32_t lhs_val, const decimal32_t rhs_val) { return lhs_val + rhs_val; });
+}
+
+inline auto d32_batch_add_simd(const decimal_fast32_t* lhs, const decimal_fast32_t* rhs, decimal_fast32_t* result, const std::size_t n) noexcept -> std::size_t
+{
+    return d32_avx2_batch<d32_batch_sum_lanes>(lhs, rhs, result, n,
+        [](const decimal_fast32_t* lhs_block, const decimal_fast32_t* rhs_block, const rounding_mode round, d32_batch_sum_lanes& lanes) { d32_avx2_sum_lanes(lhs_block, rhs_block, round, lanes); },
+        [](const decimal_fast32_t lhs_val, const decimal_fast32_t rhs_val) { return lhs_val + rhs_val; });
+}
+
+inline auto d32_batch_mul_simd(const decimal32_t* lhs, const decimal32_t* rhs, decimal32_t* result, const std::size_t n) noexcept -> std::size_t
+{
+    return d32_avx2_batch<d32_batch_encoded_lanes>(lhs, rhs, result, n,
+        [](const decimal32_t* lhs_block, const decimal32_t* rhs_block, const rounding_mode round, d32_batch_encoded_lanes& lanes) { d32_avx2_product_lanes(lhs_block, rhs_block, round, lanes); },
+        [](const decimal32_t lhs_val, const decimal32_t rhs_val) { return lhs_val * rhs_val; });
+}
+
+// decimal_fast32_t needs no decoding, and its product is a single multiplication,
+// so all the time is spent rounding and there is nothing to gain from the lanes
+constexpr auto d32_batch_mul_simd(const decimal_fast32_t*, const decimal_fast32_t*, decimal_fast32_t*, std::size_t) noexcept -> std::size_t
+{
+    return 0U;
+}
+
+#else
+
+// Without SIMD every element is computed by the scalar operator
+
+template <typename DecimalType>
+constexpr auto d32_batch_add_simd(const DecimalType*, const DecimalType*, DecimalType*, std::size_t) noexcept -> std::size_t
+{
+    return 0U;
+}
+
+template <typename DecimalType>
+constexpr auto d32_batch_mul_simd(const DecimalType*, const DecimalType*, DecimalType*, std::size_t) noexcept -> std::size_t
+{
+    return 0U;
+}
+
+#endif // BOOST_DECIMAL_HAS_AVX2_DISPATCH
+
+} // namespace detail
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_BATCH_D32_IMPL_HPP
@@ -7,9 +7,11 @@
 
 #include <boost/decimal/fwd.hpp>
 #include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/cfenv.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <type_traits>
+#include <limits>
 #endif
 
 namespace boost {
@@ -23,6 +25,13 @@ constexpr auto check_non_finite(Decimal lhs, Decimal rhs) noexcept
 {
     constexpr Decimal zero {0, 0};
 
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    if (issignaling(lhs) || issignaling(rhs))
+    {
+        raise_exception_flag(exception_flag::fe_dec_invalid);
+    }
+    #endif
+
     if (isnan(lhs))
     {
         return lhs;
@@ -44,6 +53,42 @@ constexpr auto check_non_finite(Decimal lhs, Decimal rhs) noexcept
     return zero;
 }
 
+// inf - inf (or inf + -inf when subtract is false) is an invalid operation and returns qNaN,
+// everything else is the same as check_non_finite
+template <typename Decimal>
+constexpr auto check_non_finite_add(Decimal lhs, Decimal rhs, bool subtract = false) noexcept
+    -> std::enable_if_t<is_decimal_floating_point_v<Decimal>, Decimal>
+{
+    if (isinf(lhs) && isinf(rhs) && (signbit(lhs) != signbit(rhs)) != subtract)
+    {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        raise_exception_flag(exception_flag::fe_dec_invalid);
+        #endif
+
+        return std::numeric_limits<Decimal>::quiet_NaN();
+    }
+
+    return check_non_finite(lhs, rhs);
+}
+
+// inf * 0 is an invalid operation and returns qNaN,
+// everything else is the same as check_non_finite
+template <typename Decimal>
+constexpr auto check_non_finite_mul(Decimal lhs, Decimal rhs) noexcept
+    -> std::enable_if_t<is_decimal_floating_point_v<Decimal>, Decimal>
+{
+    if ((isinf(lhs) && fpclassify(rhs) == FP_ZERO) || (isinf(rhs) && fpclassify(lhs) == FP_ZERO))
+    {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        raise_exception_flag(exception_flag::fe_dec_invalid);
+        #endif
+
+        return std::numeric_limits<Decimal>::quiet_NaN();
+    }
+
+    return check_non_finite(lhs, rhs);
+}
+
 } //namespace detail
 } //namespace decimal
 } //namespace boost
@@ -42,7 +42,7 @@ constexpr auto d32_fma_impl(T x, T y, T z) noexcept -> T
     {
         if (!isfinite(x) || !isfinite(y))
         {
-            return detail::check_non_finite(x, y);
+            return detail::check_non_finite_add(detail::check_non_finite_mul(x, y), z);
         }
     }
     #endif
@@ -67,7 +67,7 @@ constexpr auto d32_fma_impl(T x, T y, T z) noexcept -> T
 
         if (!isfinite(complete_lhs) || !isfinite(z))
         {
-            return detail::check_non_finite(complete_lhs, z);
+            return detail::check_non_finite_add(complete_lhs, z);
         }
     }
     #endif
@@ -92,7 +92,7 @@ constexpr auto d64_fma_impl(T x, T y, T z) noexcept -> T
     {
         if (!isfinite(x) || !isfinite(y))
         {
-            return detail::check_non_finite(x, y);
+            return detail::check_non_finite_add(detail::check_non_finite_mul(x, y), z);
         }
     }
     #endif
@@ -116,7 +116,7 @@ constexpr auto d64_fma_impl(T x, T y, T z) noexcept -> T
     {
         if (!isfinite(complete_lhs) || !isfinite(z))
         {
-            return detail::check_non_finite(complete_lhs, z);
+            return detail::check_non_finite_add(complete_lhs, z);
         }
     }
     #endif
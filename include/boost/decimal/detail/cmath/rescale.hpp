@@ -10,6 +10,7 @@
 #include <boost/decimal/detail/concepts.hpp>
 #include <boost/decimal/detail/config.hpp>
 #include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
 #include <boost/decimal/detail/cmath/floor.hpp>
 #include <boost/decimal/detail/cmath/ceil.hpp>
 #include <boost/decimal/detail/cmath/frexp10.hpp>
@@ -51,7 +52,7 @@ constexpr auto rescale(const T val, const int precision = 0) noexcept
     if (sig_dig > precision + 1)
     {
         const auto digits_to_remove {sig_dig - (precision + 1)};
-        sig /= detail::pow10(static_cast<typename T::significand_type>(digits_to_remove));
+        sig = detail::div_pow10(sig, digits_to_remove);
         exp += digits_to_remove;
         sig_dig -= digits_to_remove;
     }
@@ -445,6 +445,14 @@ BOOST_DECIMAL_FORCE_INLINE constexpr auto fast_type_less_parts_impl(T lhs_sig, U
     return lhs_sign ? lhs_sig > rhs_sig : lhs_sig < rhs_sig;
 }
 
+// |lhs| > |rhs| for finite values whose significands are normalized or zero.
+// Unlike abs(lhs) > abs(rhs) nothing is classified, so the unchecked arithmetic can use it
+template <BOOST_DECIMAL_INTEGRAL T, BOOST_DECIMAL_INTEGRAL U>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto abs_greater_parts_impl(T lhs_sig, U lhs_exp, T rhs_sig, U rhs_exp) noexcept -> bool
+{
+    return fast_type_less_parts_impl(rhs_sig, rhs_exp, false, lhs_sig, lhs_exp, false);
+}
+
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
 constexpr auto sequential_less_impl(DecimalType lhs, DecimalType rhs) noexcept -> bool
 {
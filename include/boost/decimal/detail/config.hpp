@@ -258,6 +258,18 @@ typedef unsigned __int128 builtin_uint128_t;
 #  define BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
 #endif
 
+// Status flags can only be recorded when runtime evaluation can be told apart from constant evaluation
+#if defined(BOOST_DECIMAL_ENABLE_EXCEPTION_FLAGS) && !defined(BOOST_DECIMAL_NO_CONSTEVAL_DETECTION)
+#  define BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+#endif
+
+// The batch kernels for x86-64 are compiled for AVX2 with function attributes,
+// and selected at runtime when the CPU supports it.
+// They do not record status flags, so the scalar path is used when flags are enabled
+#if defined(BOOST_DECIMAL_HAS_X64_INTRINSICS) && defined(__GNUC__) && !defined(BOOST_DECIMAL_NO_CONSTEVAL_DETECTION) && !defined(BOOST_DECIMAL_DISABLE_SIMD) && !defined(BOOST_DECIMAL_HAS_EXCEPTION_FLAGS)
+#  define BOOST_DECIMAL_HAS_AVX2_DISPATCH
+#endif
+
 #if defined(__clang__)
 #  if defined __has_feature
 #    if __has_feature(thread_sanitizer) || __has_feature(address_sanitizer) || __has_feature(thread_sanitizer)
@@ -343,6 +355,17 @@ typedef unsigned __int128 builtin_uint128_t;
 
 #endif
 
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#  if __has_include(<span>)
+#    ifndef BOOST_DECIMAL_BUILD_MODULE
+#      include <span>
+#    endif
+#    if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+#      define BOOST_DECIMAL_HAS_STD_SPAN
+#    endif
+#  endif
+#endif
+
 // Since we should not be able to pull these in from the STL in module mode define them ourselves
 // This is also low risk since they are not supposed to be exported
 #ifdef BOOST_DECIMAL_BUILD_MODULE
@@ -7,6 +7,8 @@
 
 #include <boost/decimal/detail/config.hpp>
 #include <boost/decimal/detail/u256.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
+#include <boost/decimal/cfenv.hpp>
 #include "int128.hpp"
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
@@ -37,6 +39,13 @@ BOOST_DECIMAL_FORCE_INLINE constexpr auto generic_div_impl(const T& lhs, const T
     const auto res_sig {big_sig_lhs / rhs.sig};
     const auto res_exp {(lhs.exp - precision_offset) - rhs.exp};
 
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    if (big_sig_lhs % rhs.sig != 0U)
+    {
+        raise_exception_flag(exception_flag::fe_dec_inexact);
+    }
+    #endif
+
     // Normalizes sign handling
     bool sign {lhs.sign != rhs.sign};
     if (BOOST_DECIMAL_UNLIKELY(res_sig == 0U))
@@ -61,6 +70,13 @@ BOOST_DECIMAL_FORCE_INLINE constexpr auto d64_generic_div_impl(const T& lhs, con
     const auto res_sig {big_sig_lhs / rhs.sig};
     const auto res_exp {(lhs.exp - detail::precision_v<decimal64_t>) - rhs.exp};
 
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    if (big_sig_lhs % rhs.sig != 0U)
+    {
+        raise_exception_flag(exception_flag::fe_dec_inexact);
+    }
+    #endif
+
     // Let the constructor handle shrinking it back down and rounding correctly
     if (res_sig < std::numeric_limits<std::uint64_t>::max())
     {
@@ -80,14 +96,30 @@ constexpr auto d128_generic_div_impl(const T& lhs, const T& rhs, T& q) noexcept
     constexpr auto ten_pow_precision {pow10(int128::uint128_t(detail::precision_v<decimal128_t>))};
     const auto big_sig_lhs {detail::umul256(lhs.sig, ten_pow_precision)};
 
-    auto res_sig {big_sig_lhs / rhs.sig};
+    int128::uint128_t remainder {};
+    auto res_sig {impl::div_rem(big_sig_lhs, rhs.sig, remainder)};
     auto res_exp {lhs.exp - rhs.exp - detail::precision_v<decimal128_t>};
 
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    if (remainder != 0U)
+    {
+        raise_exception_flag(exception_flag::fe_dec_inexact);
+    }
+    #endif
+
     if (res_sig[3] != 0 || res_sig[2] != 0)
     {
         const auto sig_dig {detail::num_digits(res_sig)};
         const auto digit_delta {sig_dig - std::numeric_limits<int128::uint128_t>::digits10};
-        res_sig /= pow10(int128::uint128_t(digit_delta));
+
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (res_sig % u256{int128::uint128_t{}, pow10(int128::uint128_t(digit_delta))} != u256{})
+        {
+            raise_exception_flag(exception_flag::fe_dec_inexact);
+        }
+        #endif
+
+        res_sig = div_pow10(res_sig, digit_delta);
         res_exp += digit_delta;
     }
     else if (res_sig[1] == 0 && res_sig[0] == 0)
@@ -0,0 +1,336 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_DIV_POW10_HPP
+#define BOOST_DECIMAL_DETAIL_DIV_POW10_HPP
+
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/u256.hpp>
+#include "int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#endif
+
+// Division by 10^k without a hardware divide
+//
+// Integers of up to 128 bits use the method of Granlund and Montgomery, "Division by Invariant Integers using Multiplication".
+// Since 10^k = 2^k * 5^k the k low bits are shifted out first, which leaves N = width - k significant bits.
+// With l = ceil(log2(5^k)) and m = ceil(2^(N + l) / 5^k) we have floor(n / 5^k) = floor(n * m / 2^(N + l)) for all n < 2^N,
+// and since m has at most N + 1 bits the product fits into an integer of twice the width.
+//
+// 256-bit integers are divided one 64-bit word at a time from the most significant down,
+// using the 2-by-1 division with a precomputed reciprocal of Moller and Granlund, "Improved division by invariant integers".
+//
+// All the multipliers, shifts and reciprocals are computed at compile time from the powers of 10
+
+namespace boost {
+namespace decimal {
+namespace detail {
+
+namespace impl {
+
+struct pow10_multipliers_u32
+{
+    std::uint64_t multiplier[10] {};
+    int shift[10] {};
+};
+
+struct pow10_multipliers_u64
+{
+    std::uint64_t multiplier[20] {};
+    int shift[20] {};
+};
+
+struct pow10_multipliers_u128
+{
+    int128::uint128_t multiplier[39] {};
+    int shift[39] {};
+};
+
+struct pow10_reciprocals_u64
+{
+    std::uint64_t divisor[20] {};    // 10^k shifted left until the high bit is set
+    std::uint64_t reciprocal[20] {}; // floor((2^128 - 1) / divisor) - 2^64
+    int shift[20] {};
+};
+
+// Smallest l such that 2^l >= x
+constexpr auto ceil_log2(const std::uint64_t x) noexcept -> int
+{
+    int l {};
+    while ((UINT64_C(1) << l) < x)
+    {
+        ++l;
+    }
+
+    return l;
+}
+
+constexpr auto make_pow10_multipliers_u32() noexcept -> pow10_multipliers_u32
+{
+    pow10_multipliers_u32 table {};
+    std::uint64_t five_pow {1};
+
+    // For k = 0 this gives m = 2^32 which is the identity after the shift
+    for (int k {}; k < 10; ++k)
+    {
+        const auto total_shift {32 - k + ceil_log2(five_pow)};
+        table.multiplier[k] = ((UINT64_C(1) << total_shift) + five_pow - 1U) / five_pow;
+        table.shift[k] = total_shift;
+        five_pow *= 5U;
+    }
+
+    return table;
+}
+
+constexpr auto make_pow10_multipliers_u64() noexcept -> pow10_multipliers_u64
+{
+    pow10_multipliers_u64 table {};
+    std::uint64_t five_pow {5};
+
+    // k = 0 would need a 65-bit multiplier, so it is handled by the caller instead.
+    // The shift is stored relative to the high word of the product
+    for (int k {1}; k < 20; ++k)
+    {
+        const auto total_shift {64 - k + ceil_log2(five_pow)};
+        const auto multiplier {((int128::uint128_t{1} << total_shift) + five_pow - 1U) / five_pow};
+        table.multiplier[k] = multiplier.low;
+        table.shift[k] = total_shift - 64;
+        five_pow *= 5U;
+    }
+
+    return table;
+}
+
+// ceil(2^e / d) by long division, since 2^e can be wider than 128 bits
+constexpr auto ceil_pow2_div(const int e, const int128::uint128_t d) noexcept -> int128::uint128_t
+{
+    int128::uint128_t q {};
+    int128::uint128_t r {1U};
+
+    for (int i {}; i < e; ++i)
+    {
+        r <<= 1U;
+        q <<= 1U;
+        if (r >= d)
+        {
+            r -= d;
+            q |= 1U;
+        }
+    }
+
+    return r != 0U ? q + 1U : q;
+}
+
+constexpr auto make_pow10_multipliers_u128() noexcept -> pow10_multipliers_u128
+{
+    pow10_multipliers_u128 table {};
+    int128::uint128_t five_pow {5U};
+
+    // As for 64 bits k = 0 is handled by the caller,
+    // and the shift is relative to the high half of the 256-bit product
+    for (int k {1}; k < 39; ++k)
+    {
+        int l {};
+        while ((int128::uint128_t{1U} << l) < five_pow)
+        {
+            ++l;
+        }
+
+        const auto total_shift {128 - k + l};
+        table.multiplier[k] = ceil_pow2_div(total_shift, five_pow);
+        table.shift[k] = total_shift - 128;
+        five_pow *= 5U;
+    }
+
+    return table;
+}
+
+constexpr auto make_pow10_reciprocals_u64() noexcept -> pow10_reciprocals_u64
+{
+    pow10_reciprocals_u64 table {};
+
+    for (int k {}; k < 20; ++k)
+    {
+        auto divisor {powers_of_10[k]};
+        int shift {};
+        while ((divisor & (UINT64_C(1) << 63U)) == 0U)
+        {
+            divisor <<= 1U;
+            ++shift;
+        }
+
+        table.divisor[k] = divisor;
+        table.reciprocal[k] = ((std::numeric_limits<int128::uint128_t>::max)() / divisor).low;
+        table.shift[k] = shift;
+    }
+
+    return table;
+}
+
+BOOST_DECIMAL_CONSTEXPR_VARIABLE pow10_multipliers_u32 pow10_multipliers_32 {make_pow10_multipliers_u32()};
+BOOST_DECIMAL_CONSTEXPR_VARIABLE pow10_multipliers_u64 pow10_multipliers_64 {make_pow10_multipliers_u64()};
+BOOST_DECIMAL_CONSTEXPR_VARIABLE pow10_multipliers_u128 pow10_multipliers_128 {make_pow10_multipliers_u128()};
+BOOST_DECIMAL_CONSTEXPR_VARIABLE pow10_reciprocals_u64 pow10_reciprocals {make_pow10_reciprocals_u64()};
+
+// High 128 bits of the product of two 128-bit integers.
+// Unlike umul256 this keeps the carries of the middle terms which full width operands need
+BOOST_DECIMAL_FORCE_INLINE constexpr auto umul256_high(const int128::uint128_t& a, const int128::uint128_t& b) noexcept -> int128::uint128_t
+{
+    const auto p0 {static_cast<int128::uint128_t>(a.low) * b.low};
+    const auto p1 {static_cast<int128::uint128_t>(a.low) * b.high};
+    const auto p2 {static_cast<int128::uint128_t>(a.high) * b.low};
+    const auto p3 {static_cast<int128::uint128_t>(a.high) * b.high};
+
+    // The carries are spelled out on 64-bit words so that they compile to add with carry rather than branches
+    auto middle {p0.high + p1.low};
+    auto middle_carry {static_cast<std::uint64_t>(middle < p1.low)};
+    middle += p2.low;
+    middle_carry += static_cast<std::uint64_t>(middle < p2.low);
+
+    auto low {p3.low + p1.high};
+    auto high {p3.high + static_cast<std::uint64_t>(low < p1.high)};
+    low += p2.high;
+    high += static_cast<std::uint64_t>(low < p2.high);
+    low += middle_carry;
+    high += static_cast<std::uint64_t>(low < middle_carry);
+
+    return int128::uint128_t {high, low};
+}
+
+// Divides remainder:word by 10^k for k in [0, 19], where remainder < 10^k is what was left by the previous word
+BOOST_DECIMAL_FORCE_INLINE constexpr auto div_word_pow10(const std::uint64_t word, const int k, std::uint64_t& remainder) noexcept -> std::uint64_t
+{
+    const auto index {static_cast<std::size_t>(k)};
+    const auto shift {pow10_reciprocals.shift[index]};
+
+    // (word >> 1) >> (63 - shift) is word >> (64 - shift) but remains defined for shift == 0
+    const auto high {(remainder << shift) | ((word >> 1U) >> (63 - shift))};
+    const auto q {div_2by1(high, word << shift, pow10_reciprocals.divisor[index], pow10_reciprocals.reciprocal[index], remainder)};
+    remainder >>= shift;
+
+    return q;
+}
+
+// Divides by 10^k for any k in [0, 77], using steps of 10^19 for the larger powers.
+// Returns whether any of the steps had a non-zero remainder
+BOOST_DECIMAL_FORCE_INLINE constexpr auto div_pow10_words(u256& n, int k) noexcept -> bool
+{
+    bool inexact {false};
+
+    do
+    {
+        const auto step {k > 19 ? 19 : k};
+
+        // Leading words that are smaller than the divisor are all remainder
+        std::uint64_t remainder {};
+        std::size_t i {4U};
+        while (i > 1U && remainder == 0U && n[i - 1U] < powers_of_10[step])
+        {
+            remainder = n[i - 1U];
+            n[i - 1U] = 0U;
+            --i;
+        }
+
+        for (; i > 0U; --i)
+        {
+            n[i - 1U] = div_word_pow10(n[i - 1U], step, remainder);
+        }
+        inexact = inexact || remainder != 0U;
+        k -= step;
+    } while (k > 0);
+
+    return inexact;
+}
+
+} // namespace impl
+
+// Returns n / 10^k
+// Every type without an overload below uses the built-in division
+template <typename T>
+constexpr auto div_pow10(const T n, const int k) noexcept -> T
+{
+    return n / pow10(static_cast<T>(k));
+}
+
+constexpr auto div_pow10(const std::uint32_t n, const int k) noexcept -> std::uint32_t
+{
+    const auto index {static_cast<std::size_t>(k)};
+    const auto product {static_cast<std::uint64_t>(n >> k) * impl::pow10_multipliers_32.multiplier[index]};
+    return static_cast<std::uint32_t>(product >> impl::pow10_multipliers_32.shift[index]);
+}
+
+constexpr auto div_pow10(const std::uint64_t n, const int k) noexcept -> std::uint64_t
+{
+    if (k == 0)
+    {
+        return n;
+    }
+
+    const auto index {static_cast<std::size_t>(k)};
+    const auto product {static_cast<int128::uint128_t>(n >> k) * impl::pow10_multipliers_64.multiplier[index]};
+    return product.high >> impl::pow10_multipliers_64.shift[index];
+}
+
+constexpr auto div_pow10(int128::uint128_t n, const int k) noexcept -> int128::uint128_t
+{
+    if (k == 0)
+    {
+        return n;
+    }
+
+    const auto index {static_cast<std::size_t>(k)};
+    return impl::umul256_high(n >> k, impl::pow10_multipliers_128.multiplier[index]) >> impl::pow10_multipliers_128.shift[index];
+}
+
+#ifdef BOOST_DECIMAL_HAS_INT128
+
+constexpr auto div_pow10(const builtin_uint128_t n, const int k) noexcept -> builtin_uint128_t
+{
+    return static_cast<builtin_uint128_t>(div_pow10(static_cast<int128::uint128_t>(n), k));
+}
+
+#endif
+
+constexpr auto div_pow10(const u256& n, const int k) noexcept -> u256
+{
+    auto q {n};
+    impl::div_pow10_words(q, k);
+    return q;
+}
+
+// Returns n / 10^k, and sets sticky if the remainder is non-zero.
+// Sticky is otherwise left as it was so that it can accumulate over several shifts
+template <typename T>
+constexpr auto div_pow10(const T n, const int k, bool& sticky) noexcept -> T
+{
+    const auto q {div_pow10(n, k)};
+
+    if (n != q * pow10(static_cast<T>(k)))
+    {
+        sticky = true;
+    }
+
+    return q;
+}
+
+constexpr auto div_pow10(const u256& n, const int k, bool& sticky) noexcept -> u256
+{
+    auto q {n};
+    if (impl::div_pow10_words(q, k))
+    {
+        sticky = true;
+    }
+
+    return q;
+}
+
+} // namespace detail
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_DIV_POW10_HPP
@@ -7,15 +7,38 @@
 
 #include <boost/decimal/cfenv.hpp>
 #include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/apply_sign.hpp>
 #include <boost/decimal/detail/type_traits.hpp>
 #include <boost/decimal/detail/config.hpp>
 #include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
 #include <boost/decimal/detail/integer_search_trees.hpp>
 
 namespace boost {
 namespace decimal {
 namespace detail {
 
+// Rounding policies select where the rounding mode comes from:
+// dynamic_rounding reads it from fegetround() on every inexact operation,
+// while fixed_rounding<Mode> fixes it at compile time
+struct dynamic_rounding {};
+
+template <rounding_mode Mode>
+struct fixed_rounding {};
+
+// Selects the constructor overload that rounds with the given policy
+template <typename Rounding>
+struct rounding_policy_tag {};
+
+template <typename T>
+struct rounding_policy
+{
+    using type = dynamic_rounding;
+};
+
+template <typename T>
+using rounding_policy_t = typename rounding_policy<T>::type;
+
 namespace impl {
 
 template <typename T, typename U>
@@ -42,66 +65,105 @@ constexpr auto fenv_round_constexpr_impl(T& val, const U max_sig, const bool, co
     return exp_delta;
 }
 
+// Applies the rule of a single rounding mode given the digit that was removed from val
+template <rounding_mode Mode, typename T>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto round_removed_digit(T& val, const std::uint32_t trailing_num, const bool is_neg, const bool sticky) noexcept -> void
+{
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    if (trailing_num != 0U || sticky)
+    {
+        detail::raise_exception_flag(exception_flag::fe_dec_inexact);
+    }
+    #endif
+
+    switch (Mode)
+    {
+        case rounding_mode::fe_dec_to_nearest_from_zero:
+            if (trailing_num >= 5U)
+            {
+                ++val;
+            }
+            break;
+        case rounding_mode::fe_dec_downward:
+            if (is_neg && (trailing_num != 0U || sticky))
+            {
+                ++val;
+            }
+            break;
+        case rounding_mode::fe_dec_to_nearest:
+            // Round to even or nearest
+            if (trailing_num > 5U || (trailing_num == 5U && sticky) || (trailing_num == 5U && !sticky && (static_cast<std::uint64_t>(val) & 1U) == 1U))
+            {
+                ++val;
+            }
+            break;
+        case rounding_mode::fe_dec_toward_zero:
+            // Do nothing
+            break;
+        case rounding_mode::fe_dec_upward:
+            if (!is_neg && (trailing_num != 0U || sticky))
+            {
+                ++val;
+            }
+            break;
+    }
+}
+
+// If the significand was e.g. 99'999'999 rounding up
+// would put it out of range again
+template <typename TargetType, typename T>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto fenv_round_overflow(T& val) noexcept -> int
+{
+    using significand_type = std::conditional_t<decimal_val_v<TargetType> >= 128, int128::uint128_t, std::int64_t>;
+
+    if (BOOST_DECIMAL_UNLIKELY(static_cast<significand_type>(val) > detail::max_significand_v<TargetType>))
+    {
+        val = div_pow10(val, 1);
+        return 2;
+    }
+
+    return 1;
 }
 
 #ifdef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
 
-// Rounds the value provided and returns an offset of exponent values as required
-template <typename TargetType = decimal32_t, typename T, std::enable_if_t<is_integral_v<T>, bool> = true>
-constexpr auto fenv_round(T& val, bool is_neg = false, bool sticky = false) noexcept -> int
+template <typename TargetType, typename T>
+constexpr auto fenv_round_impl(T& val, const bool is_neg, const bool sticky, dynamic_rounding) noexcept -> int
 {
-    return impl::fenv_round_constexpr_impl(val, max_significand_v<TargetType>, is_neg, sticky);
+    return fenv_round_constexpr_impl(val, detail::max_significand_v<TargetType>, is_neg, sticky);
 }
 
 #else
 
-template <typename TargetType = decimal32_t, typename T, std::enable_if_t<is_integral_v<T>, bool> = true>
-constexpr auto fenv_round(T& val, bool is_neg = false, bool sticky = false) noexcept -> int // NOLINT(readability-function-cognitive-complexity)
+template <typename TargetType, typename T>
+constexpr auto fenv_round_impl(T& val, const bool is_neg, const bool sticky, dynamic_rounding) noexcept -> int
 {
-    using significand_type = std::conditional_t<decimal_val_v<TargetType> >= 128, int128::uint128_t, std::int64_t>;
-
     if (BOOST_DECIMAL_IS_CONSTANT_EVALUATED(coeff))
     {
-        return impl::fenv_round_constexpr_impl(val, max_significand_v<TargetType>, is_neg, sticky);
+        return fenv_round_constexpr_impl(val, detail::max_significand_v<TargetType>, is_neg, sticky);
     }
     else
     {
-        const auto round {fegetround()};
-        int exp {1};
+        const auto shifted_val {div_pow10(val, 1)};
+        const auto trailing_num {static_cast<std::uint32_t>(val - shifted_val * 10U)};
+        val = shifted_val;
 
-        const auto trailing_num {static_cast<std::uint32_t>(val % 10U)};
-        val /= 10U;
-
-        // Default rounding mode
-        switch (round)
+        switch (fegetround())
         {
             case rounding_mode::fe_dec_to_nearest_from_zero:
-                if (trailing_num >= 5U)
-                {
-                    ++val;
-                }
+                round_removed_digit<rounding_mode::fe_dec_to_nearest_from_zero>(val, trailing_num, is_neg, sticky);
                 break;
             case rounding_mode::fe_dec_downward:
-                if (is_neg && (trailing_num != 0U || sticky))
-                {
-                    ++val;
-                }
+                round_removed_digit<rounding_mode::fe_dec_downward>(val, trailing_num, is_neg, sticky);
                 break;
             case rounding_mode::fe_dec_to_nearest:
-                // Round to even or nearest
-                if (trailing_num > 5U || (trailing_num == 5U && sticky) || (trailing_num == 5U && !sticky && (static_cast<std::uint64_t>(val) & 1U) == 1U))
-                {
-                    ++val;
-                }
+                round_removed_digit<rounding_mode::fe_dec_to_nearest>(val, trailing_num, is_neg, sticky);
                 break;
             case rounding_mode::fe_dec_toward_zero:
-                // Do nothing
+                round_removed_digit<rounding_mode::fe_dec_toward_zero>(val, trailing_num, is_neg, sticky);
                 break;
             case rounding_mode::fe_dec_upward:
-                if (!is_neg && (trailing_num != 0U || sticky))
-                {
-                    ++val;
-                }
+                round_removed_digit<rounding_mode::fe_dec_upward>(val, trailing_num, is_neg, sticky);
                 break;
             // LCOV_EXCL_START
             default:
@@ -109,22 +171,64 @@ constexpr auto fenv_round(T& val, bool is_neg = false, bool sticky = false) noex
             // LCOV_EXCL_STOP
         }
 
-        // If the significand was e.g. 99'999'999 rounding up
-        // would put it out of range again
-
-        if (BOOST_DECIMAL_UNLIKELY(static_cast<significand_type>(val) > max_significand_v<TargetType>))
-        {
-            val /= 10U;
-            ++exp;
-        }
-
-        return exp;
+        return fenv_round_overflow<TargetType>(val);
     }
 }
 
 #endif
 
-template <typename TargetDecimalType, typename T1, typename T2, typename T3>
+// The mode is a template parameter so there is nothing to look up or dispatch on,
+// and it is honored during constant evaluation as well
+template <typename TargetType, rounding_mode Mode, typename T>
+constexpr auto fenv_round_impl(T& val, const bool is_neg, const bool sticky, fixed_rounding<Mode>) noexcept -> int
+{
+    const auto shifted_val {div_pow10(val, 1)};
+    const auto trailing_num {static_cast<std::uint32_t>(val - shifted_val * 10U)};
+    val = shifted_val;
+
+    round_removed_digit<Mode>(val, trailing_num, is_neg, sticky);
+
+    return fenv_round_overflow<TargetType>(val);
+}
+
+} // namespace impl
+
+// Rounds the value provided and returns an offset of exponent values as required
+template <typename TargetType = decimal32_t, typename Rounding = dynamic_rounding, typename T, std::enable_if_t<is_integral_v<T>, bool> = true>
+constexpr auto fenv_round(T& val, bool is_neg = false, bool sticky = false) noexcept -> int
+{
+    return impl::fenv_round_impl<TargetType>(val, is_neg, sticky, Rounding{});
+}
+
+// Stands in for DecimalType as the ReturnType of the arithmetic impls.
+// Construction from (coefficient, exponent, sign) rounds with Rounding instead of the current mode,
+// and the policy is visible to the impls through rounding_policy_t
+template <typename DecimalType, typename Rounding>
+struct rounded_result
+{
+    using significand_type = typename DecimalType::significand_type;
+    using biased_exponent_type = typename DecimalType::biased_exponent_type;
+
+    DecimalType value;
+
+    constexpr rounded_result(const DecimalType val) noexcept : value {val} {}
+
+    template <typename T1, typename T2, std::enable_if_t<is_unsigned_v<T1> && is_integral_v<T2>, bool> = true>
+    constexpr rounded_result(const T1 coeff, const T2 exp, const bool sign = false) noexcept
+        : value {rounding_policy_tag<Rounding>{}, coeff, exp, sign} {}
+
+    template <typename T1, typename T2, std::enable_if_t<!is_unsigned_v<T1> && is_integral_v<T2>, bool> = true>
+    constexpr rounded_result(const T1 coeff, const T2 exp) noexcept
+        : rounded_result(make_positive_unsigned(coeff), exp, coeff < 0) {}
+};
+
+template <typename DecimalType, typename Rounding>
+struct rounding_policy<rounded_result<DecimalType, Rounding>>
+{
+    using type = Rounding;
+};
+
+template <typename TargetDecimalType, typename Rounding = dynamic_rounding, typename T1, typename T2, typename T3>
 BOOST_DECIMAL_FORCE_INLINE constexpr auto coefficient_rounding(T1& coeff, T2& exp, T3& biased_exp, const bool sign) noexcept
 {
     auto coeff_digits {detail::num_digits(coeff)};
@@ -136,24 +240,36 @@ BOOST_DECIMAL_FORCE_INLINE constexpr auto coefficient_rounding(T1& coeff, T2& ex
 
     if (BOOST_DECIMAL_UNLIKELY(shift > std::numeric_limits<T1>::digits10))
     {
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (coeff != 0U)
+        {
+            detail::raise_exception_flag(exception_flag::fe_dec_underflow | exception_flag::fe_dec_inexact);
+        }
+        #endif
+
         // Bounds check for our tables in pow10
         coeff = 0;
         return 1;
     }
 
-    // Do shifting
-    const auto shift_pow_ten {detail::pow10(static_cast<T1>(shift))};
-    const auto shifted_coeff {coeff / shift_pow_ten};
-    const auto trailing_digits {coeff % shift_pow_ten};
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    // A result that is too small for the normal range and has to be rounded underflows
+    if (shift_for_small_exp >= shift_for_large_coeff && shift < std::numeric_limits<T1>::digits10 &&
+        coeff % detail::pow10(static_cast<T1>(shift + 1)) != 0U)
+    {
+        detail::raise_exception_flag(exception_flag::fe_dec_underflow);
+    }
+    #endif
 
-    coeff = shifted_coeff;
-    const auto sticky {trailing_digits != 0u};
+    // Do shifting
+    bool sticky {false};
+    coeff = detail::div_pow10(coeff, shift, sticky);
     exp += shift;
     biased_exp += shift;
     coeff_digits -= shift;
 
     // Do rounding
-    const auto removed_digits {detail::fenv_round(coeff, sign, sticky)};
+    const auto removed_digits {detail::fenv_round<TargetDecimalType, Rounding>(coeff, sign, sticky)};
     exp += removed_digits;
     biased_exp += removed_digits;
     coeff_digits -= removed_digits;
@@ -11,6 +11,7 @@
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <system_error>
+#include <cstddef>
 #endif
 
 namespace boost {
@@ -41,6 +42,25 @@ BOOST_DECIMAL_EXPORT struct from_chars_result
     constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
 };
 
+// Result of parsing many delimiter-separated fields in one call
+
+BOOST_DECIMAL_EXPORT struct from_chars_bulk_result
+{
+    // One past the last character that was consumed
+    const char* ptr;
+
+    // Number of fields that were parsed and written
+    std::size_t count;
+
+    // Number of fields that had an error, the index of the first one, and its error.
+    // first_error is count if there were no errors
+    std::size_t error_count;
+    std::size_t first_error;
+    std::errc ec;
+
+    constexpr explicit operator bool() const noexcept { return error_count == 0U; }
+};
+
 } // namespace decimal
 } // namespace boost
 
@@ -0,0 +1,97 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_HASH_IMPL_HPP
+#define BOOST_DECIMAL_DETAIL_HASH_IMPL_HPP
+
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include "int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <cstddef>
+#endif
+
+namespace boost {
+namespace decimal {
+namespace detail {
+
+// Finalizer of splitmix64 so that every bit of the input affects the low bits used by the buckets
+constexpr auto hash_mix(std::uint64_t x) noexcept -> std::uint64_t
+{
+    x ^= x >> 30U;
+    x *= UINT64_C(0xBF58476D1CE4E5B9);
+    x ^= x >> 27U;
+    x *= UINT64_C(0x94D049BB133111EB);
+    x ^= x >> 31U;
+
+    return x;
+}
+
+constexpr auto hash_fold(const std::uint32_t x) noexcept -> std::uint64_t
+{
+    return x;
+}
+
+constexpr auto hash_fold(const std::uint64_t x) noexcept -> std::uint64_t
+{
+    return x;
+}
+
+constexpr auto hash_fold(const int128::uint128_t& x) noexcept -> std::uint64_t
+{
+    return hash_mix(x.high) ^ x.low;
+}
+
+// Hashes the value rather than the representation, so that every member of a cohort
+// (e.g. 1.0 and 1.00) gets the same hash, and the hash agrees with operator==.
+// Scaling the significand up to full precision picks one member of the cohort without re-encoding it.
+// This measured faster than stripping the trailing zeros, and the fast types are always stored that way
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
+constexpr auto canonical_hash(const DecimalType& val) noexcept -> std::size_t
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (isnan(val))
+    {
+        // NaNs never compare equal to anything so any value would do
+        return static_cast<std::size_t>(hash_mix(UINT64_C(0x7C00000000000000)));
+    }
+    if (isinf(val))
+    {
+        return static_cast<std::size_t>(hash_mix(val.isneg() ? UINT64_C(0xF800000000000000) : UINT64_C(0x7800000000000000)));
+    }
+    #endif
+
+    auto full_sig {val.full_significand()};
+
+    // +0 and -0 compare equal in every cohort
+    if (full_sig == 0U)
+    {
+        return 0U;
+    }
+
+    auto exp {static_cast<std::int64_t>(val.biased_exponent())};
+
+    BOOST_DECIMAL_IF_CONSTEXPR (!is_fast_type_v<DecimalType>)
+    {
+        const auto zeros_needed {precision_v<DecimalType> - num_digits(full_sig)};
+        full_sig *= pow10(static_cast<typename DecimalType::significand_type>(zeros_needed));
+        exp -= zeros_needed;
+    }
+
+    // Multiplying by the golden ratio spreads the exponent and sign over all the bits before they are combined
+    const auto exp_and_sign {(static_cast<std::uint64_t>(exp) << 1U) | static_cast<std::uint64_t>(val.isneg())};
+
+    return static_cast<std::size_t>(hash_mix(hash_fold(full_sig) ^ (exp_and_sign * UINT64_C(0x9E3779B97F4A7C15))));
+}
+
+} // namespace detail
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_HASH_IMPL_HPP
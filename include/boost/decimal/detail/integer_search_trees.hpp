@@ -15,6 +15,7 @@
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #endif
@@ -38,121 +39,162 @@ constexpr auto num_digits(T x) noexcept -> int
     return digits;
 }
 
-template <>
-constexpr auto num_digits(std::uint32_t x) noexcept -> int
+namespace impl {
+
+// Branch-free digit counting
+//
+// Every value with a given number of leading zeros lies in [2^p, 2^(p + 1)) with p = width - 1 - lz,
+// and that range spans at most one power of ten.
+// For each lz we store the number of digits d of 2^p and the threshold 10^d, so that
+// num_digits(x) = digits + (x >= threshold) with a single table entry and a single comparison.
+// When 10^d is not in the range we store d - 1 and a threshold of 0, which keeps the formula free of branches.
+// Zero is counted as one digit by looking it up as if it were 1.
+
+template <typename T>
+struct num_digits_entry
 {
-    // Use the most significant bit position to approximate log10
-    // log10(x) ~= log2(x) / log2(10) ~= log2(x) / 3.32
+    T threshold {};
+    int digits {};
+};
 
-    const auto msb {32 - int128::detail::impl::countl_impl(x)};
+template <typename T, std::size_t N>
+struct num_digits_table
+{
+    num_digits_entry<T> entry[N] {};
+};
 
-    // Approximate log10
-    const auto estimated_digits {(msb * 1000) / 3322 + 1}; // 1000/3322 ~= 1/log2(10)
+// u256 is 32-byte aligned which would pad each entry to 64 bytes, so the threshold is stored as plain words
+struct num_digits_entry_u256
+{
+    std::uint64_t threshold[4] {};
+    int digits {};
+};
 
-    if (estimated_digits < 10 && x >= impl::powers_of_10_u32[estimated_digits])
-    {
-        return estimated_digits + 1;
-    }
+struct num_digits_table_u256
+{
+    num_digits_entry_u256 entry[256] {};
+};
 
-    if (estimated_digits > 1 && x < impl::powers_of_10_u32[estimated_digits - 1])
+// pow10_table must hold 10^0 to 10^(max_digits - 1)
+template <typename T, std::size_t N>
+constexpr auto make_num_digits_table(const T* pow10_table, const std::size_t max_digits) noexcept -> num_digits_table<T, N>
+{
+    num_digits_table<T, N> table {};
+    T pow2 {1U};
+    std::size_t d {};
+
+    for (std::size_t p {}; p < N; ++p)
     {
-        return estimated_digits - 1;
+        while (d < max_digits && pow10_table[d] <= pow2)
+        {
+            ++d;
+        }
+
+        // 2^(p + 1) overflows for the top entry, where every representable power of ten is in range
+        const auto in_range {d < max_digits && (p == N - 1U || pow10_table[d] < pow2 + pow2)};
+
+        auto& current {table.entry[N - 1U - p]};
+        current.threshold = in_range ? pow10_table[d] : T{0U};
+        current.digits = in_range ? static_cast<int>(d) : static_cast<int>(d) - 1;
+
+        pow2 = pow2 + pow2;
     }
 
-    return estimated_digits;
+    return table;
 }
 
-template <>
-constexpr auto num_digits(std::uint64_t x) noexcept -> int
+constexpr auto make_num_digits_table_u256() noexcept -> num_digits_table_u256
 {
-    // Use the most significant bit position to approximate log10
-    // log10(x) ~= log2(x) / log2(10) ~= log2(x) / 3.32
-
-    const auto msb {63 - int128::detail::impl::countl_impl(x)};
+    constexpr std::size_t max_digits {78U};
 
-    // Approximate log10
-    const auto estimated_digits {(msb * 1000) / 3322 + 1}; // 1000/3322 ~= 1/log2(10)
+    num_digits_table_u256 table {};
+    u256 pow2 {1U};
+    std::size_t d {};
 
-    if (estimated_digits < 20 && x >= impl::powers_of_10[estimated_digits])
+    for (std::size_t p {}; p < 256U; ++p)
     {
-        return estimated_digits + 1;
-    }
+        while (d < max_digits && u256_pow_10[d] <= pow2)
+        {
+            ++d;
+        }
 
-    if (estimated_digits > 1 && x < impl::powers_of_10[estimated_digits - 1])
-    {
-        return estimated_digits - 1;
+        const auto in_range {d < max_digits && (p == 255U || u256_pow_10[d] < pow2 + pow2)};
+
+        auto& current {table.entry[255U - p]};
+        for (std::size_t i {}; i < 4U; ++i)
+        {
+            current.threshold[i] = in_range ? u256_pow_10[d][i] : UINT64_C(0);
+        }
+        current.digits = in_range ? static_cast<int>(d) : static_cast<int>(d) - 1;
+
+        pow2 = pow2 + pow2;
     }
 
-    return estimated_digits;
+    return table;
 }
 
-#ifdef _MSC_VER
-# pragma warning(push)
-# pragma warning(disable: 4307) // MSVC 14.1 warns of intergral constant overflow
-#endif
+BOOST_DECIMAL_CONSTEXPR_VARIABLE num_digits_table<std::uint32_t, 32U> num_digits_32 {make_num_digits_table<std::uint32_t, 32U>(powers_of_10_u32, 10U)};
+BOOST_DECIMAL_CONSTEXPR_VARIABLE num_digits_table<std::uint64_t, 64U> num_digits_64 {make_num_digits_table<std::uint64_t, 64U>(powers_of_10, 20U)};
+BOOST_DECIMAL_CONSTEXPR_VARIABLE num_digits_table<int128::uint128_t, 128U> num_digits_128 {make_num_digits_table<int128::uint128_t, 128U>(BOOST_DECIMAL_DETAIL_INT128_pow10, 39U)};
+BOOST_DECIMAL_CONSTEXPR_VARIABLE num_digits_table_u256 num_digits_256 {make_num_digits_table_u256()};
 
-constexpr int num_digits(const boost::int128::uint128_t& x) noexcept
+// x >= y computed as the absence of a borrow out of x - y
+BOOST_DECIMAL_FORCE_INLINE constexpr auto no_borrow(const u256& x, const std::uint64_t (&y)[4]) noexcept -> bool
 {
-    if (x.high == UINT64_C(0))
+    std::uint64_t borrow {};
+    for (std::size_t i {}; i < 4U; ++i)
     {
-        return num_digits(x.low);
+        borrow = static_cast<std::uint64_t>(x[i] < y[i]) | (static_cast<std::uint64_t>(x[i] == y[i]) & borrow);
     }
 
-    // Use the most significant bit position to approximate log10
-    // log10(x) ~= log2(x) / log2(10) ~= log2(x) / 3.32
-
-    const auto msb {64 + (63 - int128::detail::impl::countl_impl(x.high))};
-
-    // Approximate log10
-    const auto estimated_digits {(msb * 1000) / 3322 + 1}; // 1000/3322 ~= 1/log2(10)
+    return borrow == 0U;
+}
 
-    if (estimated_digits < 39 && x >= impl::BOOST_DECIMAL_DETAIL_INT128_pow10[estimated_digits])
-    {
-        return estimated_digits + 1;
-    }
+} // namespace impl
 
-    if (estimated_digits > 1 && x < impl::BOOST_DECIMAL_DETAIL_INT128_pow10[estimated_digits - 1])
-    {
-        return estimated_digits - 1;
-    }
-
-    return estimated_digits;
+template <>
+constexpr auto num_digits(std::uint32_t x) noexcept -> int
+{
+    const auto& entry {impl::num_digits_32.entry[int128::detail::impl::countl_impl(x | 1U)]};
+    return entry.digits + static_cast<int>(x >= entry.threshold);
 }
 
-constexpr int num_digits(const u256& x) noexcept
+template <>
+constexpr auto num_digits(std::uint64_t x) noexcept -> int
 {
-    if ((x[3] | x[2]) == 0)
-    {
-        return num_digits(int128::uint128_t{x[1], x[0]});
-    }
+    const auto& entry {impl::num_digits_64.entry[int128::detail::impl::countl_impl(x | 1U)]};
+    return entry.digits + static_cast<int>(x >= entry.threshold);
+}
 
-    // Use the most significant bit position to approximate log10
-    // log10(x) ~= log2(x) / log2(10) ~= log2(x) / 3.32
+#ifdef _MSC_VER
+# pragma warning(push)
+# pragma warning(disable: 4307) // MSVC 14.1 warns of intergral constant overflow
+#endif
 
-    int msb {};
-    if (x[3] != 0U)
-    {
-        msb = 192 + (63 - int128::detail::impl::countl_impl(x[3]));
-    }
-    else
-    {
-        msb = 128 + (63 - int128::detail::impl::countl_impl(x[2]));
-    }
+constexpr int num_digits(const boost::int128::uint128_t& x) noexcept
+{
+    // Both counts are taken unconditionally so that the selection compiles to a conditional move
+    const auto high_zeros {int128::detail::impl::countl_impl(x.high | 1U)};
+    const auto low_zeros {64 + int128::detail::impl::countl_impl(x.low | 1U)};
+    const auto leading_zeros {x.high != 0U ? high_zeros : low_zeros};
 
-    // Approximate log10
-    const auto estimated_digits {(msb * 1000) / 3322 + 1}; // 1000/3322 ~= 1/log2(10)
+    const auto& entry {impl::num_digits_128.entry[leading_zeros]};
+    return entry.digits + static_cast<int>(x >= entry.threshold);
+}
 
-    if (estimated_digits < 78 && x >= impl::u256_pow_10[estimated_digits])
-    {
-        return estimated_digits + 1;
-    }
+constexpr int num_digits(const u256& x) noexcept
+{
+    const auto zeros_3 {int128::detail::impl::countl_impl(x[3] | 1U)};
+    const auto zeros_2 {64 + int128::detail::impl::countl_impl(x[2] | 1U)};
+    const auto zeros_1 {128 + int128::detail::impl::countl_impl(x[1] | 1U)};
+    const auto zeros_0 {192 + int128::detail::impl::countl_impl(x[0] | 1U)};
 
-    if (estimated_digits > 1 && x < impl::u256_pow_10[estimated_digits - 1])
-    {
-        return estimated_digits - 1;
-    }
+    const auto low_zeros {x[1] != 0U ? zeros_1 : zeros_0};
+    const auto high_zeros {x[3] != 0U ? zeros_3 : zeros_2};
+    const auto leading_zeros {(x[3] | x[2]) != 0U ? high_zeros : low_zeros};
 
-    return estimated_digits;
+    const auto& entry {impl::num_digits_256.entry[leading_zeros]};
+    return entry.digits + static_cast<int>(impl::no_borrow(x, entry.threshold));
 }
 
 #ifdef _MSC_VER
@@ -163,30 +205,7 @@ constexpr int num_digits(const u256& x) noexcept
 
 constexpr auto num_digits(const builtin_uint128_t& x) noexcept -> int
 {
-    if (static_cast<std::uint64_t>(x >> 64) == UINT64_C(0))
-    {
-        return num_digits(static_cast<std::uint64_t>(x));
-    }
-
-    // We start left at 19 because we already eliminated the high word being 0
-    std::uint32_t left = 19U;
-    std::uint32_t right = 38U;
-
-    while (left < right)
-    {
-        std::uint32_t mid = (left + right + 1U) / 2U;
-
-        if (x >= impl::builtin_128_pow10[mid])
-        {
-            left = mid;
-        }
-        else
-        {
-            right = mid - 1;
-        }
-    }
-
-    return static_cast<int>(left + 1);
+    return num_digits(int128::uint128_t{static_cast<std::uint64_t>(x >> 64), static_cast<std::uint64_t>(x)});
 }
 
 #endif // Has int128
@@ -11,6 +11,7 @@
 #include "int128.hpp"
 #include <boost/decimal/detail/u256.hpp>
 #include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
 #include <boost/decimal/detail/components.hpp>
 #include "int128.hpp"
 
@@ -55,8 +56,16 @@ BOOST_DECIMAL_FORCE_INLINE constexpr auto mul_impl(T lhs_sig, U lhs_exp, bool lh
     // uint32_t instead. 14 - 5 = 9 or 13 - 5 = 8 which are both still greater than or equal to
     // digits10 + 1 for rounding which is 8 decimal digits
 
-    constexpr auto ten_pow_five {pow10(static_cast<mul_type>(5))};
-    auto res_sig {(static_cast<mul_type>(lhs_sig) * static_cast<mul_type>(rhs_sig)) / ten_pow_five};
+    const auto product {static_cast<mul_type>(lhs_sig) * static_cast<mul_type>(rhs_sig)};
+    auto res_sig {div_pow10(product, 5)};
+
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    if (product % pow10(static_cast<mul_type>(5)) != 0U)
+    {
+        raise_exception_flag(exception_flag::fe_dec_inexact);
+    }
+    #endif
+
     auto res_exp {lhs_exp + rhs_exp + static_cast<U>(5)};
 
     return {static_cast<std::uint32_t>(res_sig), res_exp, lhs_sign != rhs_sign};
@@ -77,8 +86,16 @@ constexpr auto d64_mul_impl(const T& lhs, const T& rhs) noexcept -> ReturnType
     // uint_fast64_t instead. 32 - 13 = 19 or 31 - 13 = 18 which are both still greater than
     // digits10 + 1 for rounding which is 17 decimal digits
 
-    constexpr auto ten_pow_13 {pow10(static_cast<unsigned_int128_type>(13))};
-    const auto res_sig {static_cast<std::uint64_t>((static_cast<unsigned_int128_type>(lhs.full_significand()) * static_cast<unsigned_int128_type>(rhs.full_significand())) / ten_pow_13)};
+    const auto product {static_cast<unsigned_int128_type>(lhs.full_significand()) * static_cast<unsigned_int128_type>(rhs.full_significand())};
+    const auto res_sig {static_cast<std::uint64_t>(div_pow10(product, 13))};
+
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    if (product % pow10(static_cast<unsigned_int128_type>(13)) != 0U)
+    {
+        raise_exception_flag(exception_flag::fe_dec_inexact);
+    }
+    #endif
+
     const auto res_exp {lhs.biased_exponent() + rhs.biased_exponent() + 13};
 
     return ReturnType{res_sig, res_exp, lhs.isneg() != rhs.isneg()};
@@ -100,8 +117,16 @@ BOOST_DECIMAL_FORCE_INLINE constexpr auto d64_mul_impl(T lhs_sig, U lhs_exp, boo
     // uint_fast64_t instead. 32 - 13 = 19 or 31 - 13 = 18 which are both still greater than
     // digits10 + 1 for rounding which is 17 decimal digits
 
-    constexpr auto ten_pow_13 {pow10(static_cast<unsigned_int128_type>(13))};
-    auto res_sig {(static_cast<unsigned_int128_type>(lhs_sig) * static_cast<unsigned_int128_type>(rhs_sig)) / ten_pow_13};
+    const auto product {static_cast<unsigned_int128_type>(lhs_sig) * static_cast<unsigned_int128_type>(rhs_sig)};
+    auto res_sig {div_pow10(product, 13)};
+
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    if (product % pow10(static_cast<unsigned_int128_type>(13)) != 0U)
+    {
+        raise_exception_flag(exception_flag::fe_dec_inexact);
+    }
+    #endif
+
     auto res_exp {lhs_exp + rhs_exp + static_cast<U>(13)};
 
     return {static_cast<std::uint64_t>(res_sig), res_exp, lhs_sign != rhs_sign};
@@ -132,7 +157,15 @@ BOOST_DECIMAL_FORCE_INLINE constexpr auto d64_mul_impl(T lhs_sig, U lhs_exp, boo
 
     const auto sig_dig {res_sig >= comp_value ? 32 : 31};
     constexpr auto max_dig {std::numeric_limits<typename ReturnType::significand_type>::digits10};
-    res_sig /= detail::pow10(static_cast<unsigned_int128_type>(sig_dig - max_dig));
+
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    if (res_sig % detail::pow10(static_cast<unsigned_int128_type>(sig_dig - max_dig)) != 0U)
+    {
+        raise_exception_flag(exception_flag::fe_dec_inexact);
+    }
+    #endif
+
+    res_sig = detail::div_pow10(res_sig, sig_dig - max_dig);
     res_exp += sig_dig - max_dig;
 
     const auto res_sig_64 {static_cast<typename ReturnType::significand_type>(res_sig)};
@@ -165,7 +198,14 @@ constexpr auto d128_mul_impl(const T1& lhs_sig, const U1 lhs_exp, const bool lhs
     const auto digit_delta {sig_dig - 34};
     if (BOOST_DECIMAL_LIKELY(digit_delta > 0))
     {
-        res_sig /= pow10<sig_type>(digit_delta);
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (res_sig % u256{sig_type{}, pow10<sig_type>(digit_delta)} != u256{})
+        {
+            raise_exception_flag(exception_flag::fe_dec_inexact);
+        }
+        #endif
+
+        res_sig = div_pow10(res_sig, digit_delta);
         res_exp += digit_delta;
     }
 
@@ -186,8 +226,14 @@ constexpr auto d128_fast_mul_impl(const T1& lhs_sig, const U1 lhs_exp, const boo
     auto res_sig {detail::umul256(lhs_sig, rhs_sig)};
     const auto res_exp {lhs_exp + rhs_exp + 30};
 
-    constexpr auto ten_pow_30 {detail::pow10(static_cast<int128::uint128_t>(30))};
-    res_sig /= ten_pow_30;
+    #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+    if (lhs_sig != 0U && rhs_sig != 0U && res_sig % u256{int128::uint128_t{}, detail::pow10(static_cast<int128::uint128_t>(30))} != u256{})
+    {
+        raise_exception_flag(exception_flag::fe_dec_inexact);
+    }
+    #endif
+
+    res_sig = div_pow10(res_sig, 30);
 
     BOOST_DECIMAL_ASSERT((res_sig[3] | res_sig[2]) == 0U); // LCOV_EXCL_LINE
     return {int128::uint128_t{res_sig[1], res_sig[0]}, res_exp, sign};
@@ -8,6 +8,7 @@
 #include <boost/decimal/fwd.hpp>
 #include <boost/decimal/detail/integer_search_trees.hpp>
 #include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
 #include <boost/decimal/detail/attributes.hpp>
 #include <boost/decimal/detail/remove_trailing_zeros.hpp>
 
@@ -31,7 +32,7 @@ constexpr auto normalize(T1& significand, T2& exp, bool sign = false) noexcept -
     else if (digits > target_precision)
     {
         const auto excess_digits {digits - (target_precision + 1)};
-        significand /= pow10(static_cast<T1>(excess_digits));
+        significand = div_pow10(significand, excess_digits);
         // Perform final rounding according to the fenv rounding mode
         exp += detail::fenv_round<TargetDecimalType>(significand, sign || significand < 0U) + excess_digits;
     }
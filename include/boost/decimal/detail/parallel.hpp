@@ -0,0 +1,108 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_PARALLEL_HPP
+#define BOOST_DECIMAL_DETAIL_PARALLEL_HPP
+
+#include <boost/decimal/detail/config.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <vector>
+
+#ifndef BOOST_DECIMAL_DISABLE_CLIB
+#include <thread>
+#endif
+
+#endif
+
+namespace boost {
+namespace decimal {
+namespace detail {
+
+// Fewer elements per thread than this are not worth the cost of starting the thread
+BOOST_DECIMAL_CONSTEXPR_VARIABLE std::size_t parallel_min_per_thread {std::size_t{1} << 16U};
+
+// The number of threads to split n elements between, given the number requested
+constexpr auto parallel_threads(const std::size_t n, const std::size_t requested) noexcept -> std::size_t
+{
+    const auto max_threads {n / parallel_min_per_thread > 1U ? n / parallel_min_per_thread : std::size_t{1}};
+
+    return requested < 1U ? std::size_t{1} : (requested < max_threads ? requested : max_threads);
+}
+
+// Start of chunk t when n elements are split into chunks that differ in size by at most one element
+constexpr auto parallel_chunk_begin(const std::size_t n, const std::size_t chunks, const std::size_t t) noexcept -> std::size_t
+{
+    return n / chunks * t + (t < n % chunks ? t : n % chunks);
+}
+
+// Runs f(0) ... f(threads - 1) concurrently, with f(0) on the calling thread.
+// If a thread cannot be started, the chunks that have no thread yet run on the calling thread instead,
+// so the chunks must not wait on each other
+template <typename Function>
+auto parallel_for_each_chunk(const std::size_t threads, const Function& f) -> void
+{
+    #ifndef BOOST_DECIMAL_DISABLE_CLIB
+    if (threads > 1U)
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1U);
+
+        std::size_t started {1};
+
+        #if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+        try
+        {
+        #endif
+
+            for (; started < threads; ++started)
+            {
+                workers.emplace_back(f, started);
+            }
+
+        #if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+        }
+        catch (...)
+        {
+            // Destroying workers while its threads are joinable would terminate,
+            // so fall through and run the rest here (e.g. std::system_error once the system is out of threads)
+        }
+        #endif
+
+        f(std::size_t{0});
+
+        for (auto t {started}; t < threads; ++t)
+        {
+            f(t);
+        }
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        return;
+    }
+    #endif
+
+    static_cast<void>(threads);
+    f(std::size_t{0});
+}
+
+#ifndef BOOST_DECIMAL_DISABLE_CLIB
+
+// The threads argument of the public functions, where 0 requests one thread per hardware thread
+inline auto parallel_requested_threads(const unsigned threads) -> std::size_t
+{
+    return threads == 0U ? static_cast<std::size_t>(std::thread::hardware_concurrency()) : static_cast<std::size_t>(threads);
+}
+
+#endif // BOOST_DECIMAL_DISABLE_CLIB
+
+} // namespace detail
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_PARALLEL_HPP
@@ -67,6 +67,182 @@ constexpr auto from_chars_dispatch(const char* first, const char* last, builtin_
 #endif
 
 #if !defined(BOOST_DECIMAL_DISABLE_CLIB)
+
+// Packs the next eight characters into a word with the first character in the low byte.
+// The shifts are recognized as a single unaligned load by the usual compilers,
+// and unlike memcpy this stays usable in constant evaluation
+constexpr auto swar_load_eight(const char* first) noexcept -> std::uint64_t
+{
+    std::uint64_t value {};
+    for (int i {}; i < 8; ++i)
+    {
+        value |= static_cast<std::uint64_t>(static_cast<unsigned char>(first[i])) << (i * 8);
+    }
+
+    return value;
+}
+
+// Each byte is in ['0', '9'] iff its high nibble is 3, and adding 6 does not carry it out of 3
+constexpr auto swar_is_eight_digits(std::uint64_t value) noexcept -> bool
+{
+    return ((value & UINT64_C(0xF0F0F0F0F0F0F0F0)) |
+            (((value + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)) >> 4U)) == UINT64_C(0x3333333333333333);
+}
+
+// Converts eight validated digits in three multiplications by combining pairs, then quads, then the two halves
+constexpr auto swar_parse_eight_digits(std::uint64_t value) noexcept -> std::uint32_t
+{
+    constexpr std::uint64_t mask {UINT64_C(0x000000FF000000FF)};
+    constexpr std::uint64_t mul1 {UINT64_C(100) + (UINT64_C(1000000) << 32U)};
+    constexpr std::uint64_t mul2 {UINT64_C(1) + (UINT64_C(10000) << 32U)};
+
+    value -= UINT64_C(0x3030303030303030);
+    value = (value * 10U) + (value >> 8U);
+    value = (((value & mask) * mul1) + (((value >> 16U) & mask) * mul2)) >> 32U;
+
+    return static_cast<std::uint32_t>(value);
+}
+
+// Appends the run of decimal digits starting at first to significand, eight at a time while they are available.
+// Stops early once the significand would hold max_digits digits, so that the caller can detect the overflow
+template <typename Unsigned_Integer>
+constexpr auto accumulate_digits(const char* first, const char* last, Unsigned_Integer& significand,
+                                 std::size_t& digits, std::size_t max_digits) noexcept -> const char*
+{
+    while (last - first >= 8 && digits + 8U < max_digits)
+    {
+        const auto word {swar_load_eight(first)};
+        if (!swar_is_eight_digits(word))
+        {
+            break;
+        }
+
+        significand = significand * UINT32_C(100000000) + swar_parse_eight_digits(word);
+        digits += 8U;
+        first += 8;
+    }
+
+    while (first != last && is_integer_char(*first) && digits < max_digits)
+    {
+        significand = significand * 10U + static_cast<std::uint32_t>(*first - '0');
+        ++digits;
+        ++first;
+    }
+
+    return first;
+}
+
+// Fast path for the common [-]ddd[.ddd] form, optionally followed by a short exponent (e.g. e-5 or E+123),
+// with a non-zero significand that fits in Unsigned_Integer.
+// Returns false without touching the outputs for anything else (hex, inf, nan, zero, long or zero exponents,
+// or too many digits), in which case the general parser below handles the string.
+// The results are identical to what the general parser would produce: trailing zeros are kept,
+// and the exponent is offset by minus the number of fractional digits.
+template <typename Unsigned_Integer, typename Integer>
+constexpr auto parse_plain_decimal(const char* first, const char* last, bool& sign, Unsigned_Integer& significand,
+                                   Integer& exponent, chars_format fmt, from_chars_result& result) noexcept -> bool
+{
+    constexpr std::size_t max_digits {std::numeric_limits<Unsigned_Integer>::digits10};
+    constexpr int max_exponent_digits {4};
+
+    auto next {first};
+    const bool is_negative {*next == '-'};
+    if (is_negative)
+    {
+        ++next;
+    }
+
+    if (next == last || !is_integer_char(*next))
+    {
+        return false;
+    }
+
+    while (next != last && *next == '0')
+    {
+        ++next;
+    }
+
+    Unsigned_Integer sig {0U};
+    std::size_t digits {0U};
+    std::ptrdiff_t fractional_digits {0};
+
+    next = accumulate_digits(next, last, sig, digits, max_digits);
+
+    if (next != last && *next == '.')
+    {
+        ++next;
+        const auto fraction_start {next};
+
+        // Leading zeros of the fraction only move the exponent
+        if (digits == 0U)
+        {
+            while (next != last && *next == '0')
+            {
+                ++next;
+            }
+        }
+
+        next = accumulate_digits(next, last, sig, digits, max_digits);
+        fractional_digits = next - fraction_start;
+    }
+
+    if (digits == 0U || digits == max_digits)
+    {
+        return false;
+    }
+
+    Integer exp {0};
+    if (next != last && (*next == 'e' || *next == 'E'))
+    {
+        if (fmt == chars_format::fixed)
+        {
+            return false;
+        }
+
+        ++next;
+        const bool is_negative_exponent {next != last && *next == '-'};
+        if (next != last && (*next == '-' || *next == '+'))
+        {
+            ++next;
+        }
+
+        while (next != last && *next == '0')
+        {
+            ++next;
+        }
+
+        int exponent_digits {};
+        while (next != last && is_integer_char(*next) && exponent_digits <= max_exponent_digits)
+        {
+            exp = static_cast<Integer>(exp * 10 + static_cast<Integer>(*next - '0'));
+            ++exponent_digits;
+            ++next;
+        }
+
+        // A zero exponent and anything longer than max_exponent_digits take the general path
+        if (exponent_digits == 0 || exponent_digits > max_exponent_digits)
+        {
+            return false;
+        }
+
+        if (is_negative_exponent)
+        {
+            exp = -exp;
+        }
+    }
+    else if (fmt == chars_format::scientific || (next != last && !is_delimiter(*next, fmt)))
+    {
+        return false;
+    }
+
+    sign = is_negative;
+    significand = sig;
+    exponent = static_cast<Integer>(exp - static_cast<Integer>(fractional_digits));
+    result = {next, std::errc()};
+
+    return true;
+}
+
 template <typename Unsigned_Integer, typename Integer>
 constexpr auto parser(const char* first, const char* last, bool& sign, Unsigned_Integer& significand, Integer& exponent, chars_format fmt = chars_format::general) noexcept -> from_chars_result
 {
@@ -75,6 +251,16 @@ constexpr auto parser(const char* first, const char* last, bool& sign, Unsigned_
         return {first, std::errc::invalid_argument};
     }
 
+    // Plain decimal notation is by far the most common input (e.g. prices), so try the SWAR path first
+    if (fmt != chars_format::hex)
+    {
+        from_chars_result fast_result {};
+        if (parse_plain_decimal(first, last, sign, significand, exponent, fmt, fast_result))
+        {
+            return fast_result;
+        }
+    }
+
     auto next = first;
     bool all_zeros = true;
 
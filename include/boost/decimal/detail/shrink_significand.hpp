@@ -9,6 +9,7 @@
 #include <boost/decimal/detail/apply_sign.hpp>
 #include <boost/decimal/detail/integer_search_trees.hpp>
 #include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <limits>
@@ -22,7 +23,6 @@ namespace detail {
 template <typename TargetType = std::uint32_t, typename Integer, typename Exp>
 constexpr auto shrink_significand(Integer sig, Exp& exp) noexcept -> TargetType
 {
-    using Unsigned_Integer = make_unsigned_t<Integer>;
     constexpr auto max_digits {std::numeric_limits<TargetType>::digits10};
 
     auto unsigned_sig {make_positive_unsigned(sig)};
@@ -30,7 +30,7 @@ constexpr auto shrink_significand(Integer sig, Exp& exp) noexcept -> TargetType
 
     if (sig_dig > max_digits)
     {
-        unsigned_sig /= pow10(static_cast<Unsigned_Integer>(sig_dig - max_digits));
+        unsigned_sig = div_pow10(unsigned_sig, sig_dig - max_digits);
         exp += sig_dig - max_digits;
     }
 
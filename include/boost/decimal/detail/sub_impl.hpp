@@ -8,6 +8,7 @@
 #include <boost/decimal/detail/shrink_significand.hpp>
 #include <boost/decimal/detail/apply_sign.hpp>
 #include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
 #include "int128.hpp"
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
@@ -31,6 +32,14 @@ constexpr auto d128_sub_impl(T lhs_sig, U lhs_exp, bool lhs_sign,
         // we return the larger of the two
         //
         // e.g. 1e20 - 1e-20 = 1e20
+
+        #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+        if (lhs_sig != 0U && rhs_sig != 0U)
+        {
+            raise_exception_flag(exception_flag::fe_dec_inexact);
+        }
+        #endif
+
         return abs_lhs_bigger ? ReturnType{lhs_sig, lhs_exp, lhs_sign} :
                                 ReturnType{rhs_sig, rhs_exp, !rhs_sign};
     }
@@ -59,13 +68,20 @@ constexpr auto d128_sub_impl(T lhs_sig, U lhs_exp, bool lhs_sign,
 
         if (delta_exp > 1)
         {
-            sig_smaller /= pow10<std::remove_reference_t<decltype(sig_smaller)>>(delta_exp - 1);
+            #ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+            if (sig_smaller % pow10<std::remove_reference_t<decltype(sig_smaller)>>(delta_exp - 1) != 0U)
+            {
+                raise_exception_flag(exception_flag::fe_dec_inexact);
+            }
+            #endif
+
+            sig_smaller = div_pow10(sig_smaller, delta_exp - 1);
             delta_exp = 1;
         }
 
         if (delta_exp == 1)
         {
-            detail::fenv_round<decimal128_t>(sig_smaller, smaller_sign);
+            detail::fenv_round<decimal128_t, rounding_policy_t<ReturnType>>(sig_smaller, smaller_sign);
         }
     }
 
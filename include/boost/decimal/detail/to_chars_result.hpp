@@ -8,6 +8,7 @@
 #include <boost/decimal/detail/config.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
 #include <system_error>
 #endif
 
@@ -34,6 +35,23 @@ BOOST_DECIMAL_EXPORT struct to_chars_result
     constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
 };
 
+// Result of formatting many values into one buffer in one call
+
+BOOST_DECIMAL_EXPORT struct to_chars_bulk_result
+{
+    // One past the separator of the last value that was written
+    char* ptr;
+
+    // Number of values that were written
+    std::size_t count;
+
+    // std::errc::value_too_large if the buffer filled up before all the values were written,
+    // otherwise the error of to_chars for the value that could not be written
+    std::errc ec;
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
 } // namespace decimal
 } // namespace boost
 
@@ -199,6 +199,13 @@ struct conjunction<B1, Bn...>
 template <typename... B>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE bool conjunction_v = conjunction<B...>::value;
 
+// Backport of std::type_identity from C++20 to exclude a parameter from template argument deduction
+template <typename T>
+struct type_identity { using type = T; };
+
+template <typename T>
+using type_identity_t = typename type_identity<T>::type;
+
 } // namespace detail
 } // namespace decimal
 } // namespace boost
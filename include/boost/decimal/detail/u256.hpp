@@ -9,6 +9,7 @@
 #define BOOST_DECIMAL_DETAIL_U256_HPP
 
 #include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/countl.hpp>
 #include "int128.hpp"
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
@@ -766,76 +767,75 @@ BOOST_DECIMAL_FORCE_INLINE constexpr u256 from_words(const std::uint32_t (&words
 #pragma GCC diagnostic pop
 #endif
 
+// Schoolbook multiplication on 64-bit words, truncated to the low 256 bits.
+// The 64 x 64 -> 128-bit products come from int128::uint128_t, which uses the builtin 128-bit integer where there is one.
+// Compilers then emit mul + umulh on AArch64, and mulx with a single adc chain on x86-64 with BMI2
 template <std::size_t u_size, std::size_t v_size>
-constexpr u256 knuth_mulitply(const std::uint32_t (&u)[u_size],
-                              const std::uint32_t (&v)[v_size]) noexcept
+BOOST_DECIMAL_FORCE_INLINE constexpr u256 mul_words(const std::uint64_t (&u)[u_size],
+                                                    const std::uint64_t (&v)[v_size]) noexcept
 {
-    std::uint32_t w[u_size + v_size] {};
+    u256 result {};
 
-    // M.1
     for (std::size_t j {}; j < v_size; ++j)
     {
-        // M.2
-        if (v[j] == 0)
+        std::uint64_t carry {};
+        std::size_t i {};
+
+        for (; i < u_size && i + j < 4U; ++i)
         {
-            w[j + u_size] = 0u;
-            continue;
+            auto t {static_cast<int128::uint128_t>(u[i]) * v[j]};
+            t += result[i + j];
+            t += carry;
+
+            result[i + j] = t.low;
+            carry = t.high;
         }
 
-        // M.3
-        std::uint64_t t {};
-        for (std::size_t i {}; i < u_size; ++i)
+        if (i + j < 4U)
         {
-            // M.4
-            t += static_cast<std::uint64_t>(u[i]) * v[j] + w[i + j];
-            w[i + j] = static_cast<std::uint32_t>(t);
-            t >>= 32u;
+            result[i + j] = carry;
         }
-
-        // M.5
-        w[j + u_size] = static_cast<std::uint32_t>(t);
     }
 
-    return from_words(w);
+    return result;
 }
 
-constexpr void to_words(const u256& x, std::uint32_t (&words)[8]) noexcept
+BOOST_DECIMAL_FORCE_INLINE constexpr u256 default_mul(const u256& lhs, const u256& rhs) noexcept
 {
-    #if !defined(BOOST_DECIMAL_NO_CONSTEVAL_DETECTION) && !BOOST_DECIMAL_ENDIAN_BIG_BYTE
-    if (!BOOST_DECIMAL_DETAIL_INT128_IS_CONSTANT_EVALUATED(x))
-    {
-        std::memcpy(words, &x, sizeof(x));
-    }
-    else
-    #endif
-    {
+    const std::uint64_t u[4] {lhs[0], lhs[1], lhs[2], lhs[3]};
+    const std::uint64_t v[4] {rhs[0], rhs[1], rhs[2], rhs[3]};
 
-        words[0] = static_cast<std::uint32_t>(x[0] & UINT32_MAX);
-        words[1] = static_cast<std::uint32_t>(x[0] >> 32U);
-        words[2] = static_cast<std::uint32_t>(x[1] & UINT32_MAX);
-        words[3] = static_cast<std::uint32_t>(x[1] >> 32U);
-        words[4] = static_cast<std::uint32_t>(x[2] & UINT32_MAX);
-        words[5] = static_cast<std::uint32_t>(x[2] >> 32U);
-        words[6] = static_cast<std::uint32_t>(x[3] & UINT32_MAX);
-        words[7] = static_cast<std::uint32_t>(x[3] >> 32U);
-    }
+    return mul_words(u, v);
 }
 
-template <typename UnsignedInteger>
-BOOST_DECIMAL_FORCE_INLINE constexpr u256 default_mul(const u256& lhs, const UnsignedInteger& rhs) noexcept
+BOOST_DECIMAL_FORCE_INLINE constexpr u256 default_mul(const u256& lhs, const int128::uint128_t& rhs) noexcept
 {
-    using boost::decimal::detail::impl::to_words;
-    using boost::int128::detail::to_words;
+    const std::uint64_t u[4] {lhs[0], lhs[1], lhs[2], lhs[3]};
+    const std::uint64_t v[2] {rhs.low, rhs.high};
 
-    constexpr std::size_t rhs_words_needed {sizeof(UnsignedInteger) / sizeof(std::uint32_t)};
+    return mul_words(u, v);
+}
 
-    std::uint32_t lhs_words[8] {};
-    std::uint32_t rhs_words[rhs_words_needed] {};
+BOOST_DECIMAL_FORCE_INLINE constexpr u256 default_mul(const u256& lhs, const std::uint64_t rhs) noexcept
+{
+    const std::uint64_t u[4] {lhs[0], lhs[1], lhs[2], lhs[3]};
+    const std::uint64_t v[1] {rhs};
 
-    to_words(lhs, lhs_words);
-    to_words(rhs, rhs_words);
+    return mul_words(u, v);
+}
 
-    return knuth_mulitply(lhs_words, rhs_words);
+template <typename UnsignedInteger>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto default_mul(const u256& lhs, const UnsignedInteger& rhs) noexcept
+    -> std::enable_if_t<(sizeof(UnsignedInteger) <= sizeof(std::uint64_t)), u256>
+{
+    return default_mul(lhs, static_cast<std::uint64_t>(rhs));
+}
+
+template <typename UnsignedInteger>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto default_mul(const u256& lhs, const UnsignedInteger& rhs) noexcept
+    -> std::enable_if_t<(sizeof(UnsignedInteger) > sizeof(std::uint64_t)), u256>
+{
+    return default_mul(lhs, static_cast<int128::uint128_t>(rhs));
 }
 
 } // namespace impl
@@ -993,6 +993,182 @@ BOOST_DECIMAL_FORCE_INLINE constexpr u256 default_div(const u256& lhs, const std
     return quotient;
 }
 
+// Division by a 128-bit divisor on 64-bit words.
+// Uses the 2-by-1 and 3-by-2 divisions with a precomputed reciprocal of Moller and Granlund, "Improved division by invariant integers".
+// The reciprocal itself is found with a table lookup and Newton iterations,
+// so there is no hardware divide at all and each quotient word costs a few multiplications
+
+struct reciprocal_table_u16
+{
+    std::uint16_t v[256] {};
+};
+
+constexpr auto make_reciprocal_table() noexcept -> reciprocal_table_u16
+{
+    reciprocal_table_u16 table {};
+
+    for (std::uint32_t i {}; i < 256U; ++i)
+    {
+        table.v[i] = static_cast<std::uint16_t>(UINT32_C(0x7FD00) / (i + 256U));
+    }
+
+    return table;
+}
+
+BOOST_DECIMAL_CONSTEXPR_VARIABLE reciprocal_table_u16 reciprocal_table {make_reciprocal_table()};
+
+// floor((2^128 - 1) / d) - 2^64 for a normalized divisor d.
+// This is algorithm 3 of the paper: an 11-bit estimate from the top 9 bits of d, refined to 21, 34 and then 64 bits
+BOOST_DECIMAL_FORCE_INLINE constexpr auto reciprocal_2by1(const std::uint64_t d) noexcept -> std::uint64_t
+{
+    const std::uint64_t v0 {reciprocal_table.v[static_cast<std::size_t>((d >> 55U) - 256U)]};
+
+    const auto d40 {(d >> 24U) + 1U};
+    const auto v1 {(v0 << 11U) - ((v0 * v0 * d40) >> 40U) - 1U};
+
+    const auto v2 {(v1 << 13U) + ((v1 * ((UINT64_C(1) << 60U) - v1 * d40)) >> 47U)};
+
+    const auto d0 {d & 1U};
+    const auto d63 {(d >> 1U) + d0};
+    const auto e {((v2 >> 1U) & (UINT64_C(0) - d0)) - v2 * d63};
+    const auto v3 {((static_cast<int128::uint128_t>(v2) * e).high >> 1U) + (v2 << 31U)};
+
+    return v3 - (static_cast<int128::uint128_t>(v3) * d + d).high - d;
+}
+
+// floor((2^192 - 1) / d) - 2^64 for a normalized divisor d = d1:d0
+BOOST_DECIMAL_FORCE_INLINE constexpr auto reciprocal_3by2(const std::uint64_t d1, const std::uint64_t d0) noexcept -> std::uint64_t
+{
+    auto v {reciprocal_2by1(d1)};
+    auto p {d1 * v + d0};
+
+    if (p < d0)
+    {
+        --v;
+        if (p >= d1)
+        {
+            --v;
+            p -= d1;
+        }
+        p -= d1;
+    }
+
+    const auto t {static_cast<int128::uint128_t>(v) * d0};
+    p += t.high;
+
+    if (p < t.high)
+    {
+        --v;
+        if (p > d1 || (p == d1 && t.low >= d0))
+        {
+            --v;
+        }
+    }
+
+    return v;
+}
+
+// Divides high:low by the normalized divisor d with reciprocal v, where high < d
+BOOST_DECIMAL_FORCE_INLINE constexpr auto div_2by1(const std::uint64_t high, const std::uint64_t low,
+                                                   const std::uint64_t d, const std::uint64_t v,
+                                                   std::uint64_t& remainder) noexcept -> std::uint64_t
+{
+    auto q {static_cast<int128::uint128_t>(v) * high};
+    q += int128::uint128_t {high, low};
+
+    auto q1 {q.high + 1U};
+    auto r {low - q1 * d};
+
+    // This correction is taken about half the time so it is done without a branch
+    const auto mask {UINT64_C(0) - static_cast<std::uint64_t>(r > q.low)};
+    q1 += mask;
+    r += mask & d;
+
+    if (BOOST_DECIMAL_UNLIKELY(r >= d))
+    {
+        ++q1;
+        r -= d;
+    }
+
+    remainder = r;
+    return q1;
+}
+
+// Divides u2:u1:u0 by the normalized divisor d with reciprocal v, where u2:u1 < d
+BOOST_DECIMAL_FORCE_INLINE constexpr auto div_3by2(const std::uint64_t u2, const std::uint64_t u1, const std::uint64_t u0,
+                                                   const int128::uint128_t& d, const std::uint64_t v,
+                                                   int128::uint128_t& remainder) noexcept -> std::uint64_t
+{
+    auto q {static_cast<int128::uint128_t>(v) * u2};
+    q += int128::uint128_t {u2, u1};
+
+    auto q1 {q.high};
+    auto r {int128::uint128_t {u1 - q1 * d.high, u0} - static_cast<int128::uint128_t>(q1) * d.low - d};
+    ++q1;
+
+    const auto mask {UINT64_C(0) - static_cast<std::uint64_t>(r.high >= q.low)};
+    q1 += mask;
+    r += int128::uint128_t {mask & d.high, mask & d.low};
+
+    if (BOOST_DECIMAL_UNLIKELY(r >= d))
+    {
+        ++q1;
+        r -= d;
+    }
+
+    remainder = r;
+    return q1;
+}
+
+// Returns lhs / rhs and stores lhs % rhs into remainder
+BOOST_DECIMAL_FORCE_INLINE constexpr auto div_rem(const u256& lhs, const int128::uint128_t& rhs, int128::uint128_t& remainder) noexcept -> u256
+{
+    BOOST_DECIMAL_ASSERT(rhs != 0U);
+
+    // Normalize so that the high bit of the divisor is set, with the bits shifted out of the top of lhs in u[4].
+    // (x >> 1) >> (63 - shift) is x >> (64 - shift) but remains defined for shift == 0
+    const auto shift {rhs.high == 0U ? countl_zero(rhs.low) : countl_zero(rhs.high)};
+
+    std::uint64_t u[5] {};
+    u[4] = (lhs[3] >> 1U) >> (63 - shift);
+    for (std::size_t i {3U}; i > 0U; --i)
+    {
+        u[i] = (lhs[i] << shift) | ((lhs[i - 1U] >> 1U) >> (63 - shift));
+    }
+    u[0] = lhs[0] << shift;
+
+    u256 quotient {};
+
+    if (rhs.high == 0U)
+    {
+        const auto d {rhs.low << shift};
+        const auto v {reciprocal_2by1(d)};
+
+        std::uint64_t r {u[4]};
+        for (std::size_t i {4U}; i > 0U; --i)
+        {
+            quotient[i - 1U] = div_2by1(r, u[i - 1U], d, v, r);
+        }
+
+        remainder = int128::uint128_t{0U, r >> shift};
+    }
+    else
+    {
+        const auto d {rhs << shift};
+        const auto v {reciprocal_3by2(d.high, d.low)};
+
+        int128::uint128_t r {u[4], u[3]};
+        for (std::size_t i {3U}; i > 0U; --i)
+        {
+            quotient[i - 1U] = div_3by2(r.high, r.low, u[i - 1U], d, v, r);
+        }
+
+        remainder = r >> shift;
+    }
+
+    return quotient;
+}
+
 template <typename UnsignedInteger>
 BOOST_DECIMAL_FORCE_INLINE constexpr u256 default_div(const u256& lhs, const UnsignedInteger& rhs) noexcept
 {
@@ -1019,6 +1195,12 @@ BOOST_DECIMAL_FORCE_INLINE constexpr u256 default_div(const u256& lhs, const Uns
     return from_words(q);
 }
 
+BOOST_DECIMAL_FORCE_INLINE constexpr u256 default_div(const u256& lhs, const int128::uint128_t& rhs) noexcept
+{
+    int128::uint128_t remainder {};
+    return div_rem(lhs, rhs, remainder);
+}
+
 } // namespace impl
 
 constexpr u256 operator/(const u256& lhs, const u256& rhs) noexcept
@@ -1099,6 +1281,13 @@ BOOST_DECIMAL_FORCE_INLINE constexpr u256 default_mod(const u256& lhs, const Uns
     return from_words(u);
 }
 
+BOOST_DECIMAL_FORCE_INLINE constexpr u256 default_mod(const u256& lhs, const int128::uint128_t& rhs) noexcept
+{
+    int128::uint128_t remainder {};
+    div_rem(lhs, rhs, remainder);
+    return u256{int128::uint128_t{}, remainder};
+}
+
 } // namespace impl
 
 constexpr u256 operator%(const u256& lhs, const u256& rhs) noexcept
@@ -14,9 +14,11 @@
 #include <boost/decimal/bid_conversion.hpp>
 #include <boost/decimal/detail/config.hpp>
 #include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
 #include "detail/int128.hpp"
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #endif
@@ -316,6 +318,66 @@ constexpr auto decode_dpd(const std::uint32_t dpd_bits, std::uint8_t& d3, std::u
     // LCOV_EXCL_STOP
 }
 
+// Every declet decoded to its binary value 0-999, and every value 0-999 encoded to its canonical declet.
+// The 24 non-canonical declets decode to the same value as their canonical forms
+struct dpd_tables
+{
+    std::uint16_t declet_to_binary[1024] {};
+    std::uint16_t binary_to_declet[1000] {};
+};
+
+constexpr auto make_dpd_tables() noexcept -> dpd_tables
+{
+    dpd_tables tables {};
+
+    for (std::uint32_t declet {}; declet < 1024U; ++declet)
+    {
+        std::uint8_t d1 {};
+        std::uint8_t d2 {};
+        std::uint8_t d3 {};
+        decode_dpd(declet, d3, d2, d1);
+        tables.declet_to_binary[declet] = static_cast<std::uint16_t>(d1 * 100U + d2 * 10U + d3);
+    }
+
+    for (std::uint32_t value {}; value < 1000U; ++value)
+    {
+        tables.binary_to_declet[value] = encode_dpd(static_cast<std::uint8_t>(value / 100U),
+                                                    static_cast<std::uint8_t>((value / 10U) % 10U),
+                                                    static_cast<std::uint8_t>(value % 10U));
+    }
+
+    return tables;
+}
+
+BOOST_DECIMAL_CONSTEXPR_VARIABLE dpd_tables dpd_table {make_dpd_tables()};
+
+// Encodes the lowest 3 * count digits of x as count declets with the least significant in the low bits,
+// and leaves the remaining leading digits in x
+template <typename T>
+constexpr auto encode_declets(T& x, const int count) noexcept -> std::uint64_t
+{
+    std::uint64_t declets {};
+    for (int i {}; i < count; ++i)
+    {
+        declets |= static_cast<std::uint64_t>(dpd_table.binary_to_declet[static_cast<std::size_t>(x % 1000U)]) << (10 * i);
+        x /= 1000U;
+    }
+
+    return declets;
+}
+
+// Appends the 3 * count digits held in count declets to the digits already in x
+template <typename T>
+constexpr auto decode_declets(T x, const std::uint64_t declets, const int count) noexcept -> T
+{
+    for (int i {count - 1}; i >= 0; --i)
+    {
+        x = static_cast<T>(x * 1000U + dpd_table.declet_to_binary[static_cast<std::size_t>((declets >> (10 * i)) & 0b1111111111U)]);
+    }
+
+    return x;
+}
+
 } // namespace detail
 
 BOOST_DECIMAL_EXPORT template <typename DecimalType>
@@ -343,16 +405,11 @@ constexpr auto to_dpd_d32(const DecimalType val) noexcept
         dpd |= detail::d32_sign_mask;
     }
 
-    // Break the significand down into the 7 declets are needed
-    std::uint8_t d[std::numeric_limits<DecimalType>::digits10] {};
-    auto temp_sig {significand};
-    for (int i = 6; i >= 0; --i)
-    {
-        d[i] = static_cast<std::uint8_t>(temp_sig % 10U);
-        temp_sig /= 10U;
-    }
-    BOOST_DECIMAL_ASSERT(d[0] >= 0 && d[0] <= 9);
-    BOOST_DECIMAL_ASSERT(temp_sig == 0);
+    // Break the significand down into the 2 declets and the leading digit d0
+    auto temp_sig {static_cast<std::uint32_t>(significand)};
+    const auto declets {static_cast<std::uint32_t>(detail::encode_declets(temp_sig, 2))};
+    const auto d0 {temp_sig};
+    BOOST_DECIMAL_ASSERT(d0 <= 9U);
 
     // We now need to capture what the leading two bits of the exponent are,
     // since they are stored in the combination field
@@ -364,12 +421,12 @@ constexpr auto to_dpd_d32(const DecimalType val) noexcept
 
 
     std::uint32_t combination_field_bits {};
-    // Now based on what the value of d[0] and the leading bits of exp are we can set the value of the combination field
+    // Now based on what the value of d0 and the leading bits of exp are we can set the value of the combination field
     // See 3.5.2.c.1
     // If d0 is 8 or 9 then we follow section i
-    if (d[0] >= 8)
+    if (d0 >= 8U)
     {
-        const auto d0_is_nine {d[0] == 9};
+        const auto d0_is_nine {d0 == 9U};
         switch (leading_two_bits)
         {
             case 0U:
@@ -390,8 +447,8 @@ constexpr auto to_dpd_d32(const DecimalType val) noexcept
     // If d0 is 0 to 7 then we follow section II
     else
     {
-        // In here the value of d[0] = 4*G2 + 2*G3 + G4
-        const auto d0_mask {static_cast<std::uint32_t>(d[0])};
+        // In here the value of d0 = 4*G2 + 2*G3 + G4
+        const auto d0_mask {d0};
         switch (leading_two_bits)
         {
             case 0U:
@@ -415,15 +472,10 @@ constexpr auto to_dpd_d32(const DecimalType val) noexcept
         }
     }
 
-    // The only thing we have left to compute now is the bit patterns of d[1] - d[6]
-    const auto declet_1 {static_cast<std::uint32_t>(detail::encode_dpd(d[1], d[2], d[3]))};
-    const auto declet_2 {static_cast<std::uint32_t>(detail::encode_dpd(d[4], d[5], d[6]))};
-
     // Now we can do final assembly of the number
     dpd |= (combination_field_bits << 26U);
     dpd |= (trailing_exp_bits << 20U);
-    dpd |= (declet_1 << 10U);
-    dpd |= declet_2;
+    dpd |= declets;
 
     return dpd;
 }
@@ -498,21 +550,8 @@ constexpr auto from_dpd_d32(const std::uint32_t dpd) noexcept
     const auto complete_exp {(leading_biased_exp_bits << 6U) + exponent_field_bits};
     const auto exp {static_cast<std::int32_t>(complete_exp) - detail::bias_v<DecimalType>};
 
-    // We can now decode the remainder of the significand to recover the value
-    std::uint8_t digits[7] {};
-    digits[0] = static_cast<std::uint8_t>(d0);
-    const auto significand_low {significand_bits & 0b1111111111};
-    detail::decode_dpd(significand_low, digits[6], digits[5], digits[4]);
-    const auto significand_high {(significand_bits & 0b11111111110000000000) >> 10U};
-    BOOST_DECIMAL_ASSERT(significand_high <= 0b1111111111);
-    detail::decode_dpd(significand_high, digits[3], digits[2], digits[1]);
-
-    // Now we can assemble the significand
-    std::uint32_t significand {};
-    for (std::uint32_t i {}; i < 7U; ++i)
-    {
-        significand += digits[i] * detail::pow10(6 - i);
-    }
+    // We can now decode the 2 declets following d0 to recover the significand
+    const auto significand {detail::decode_declets(d0, significand_bits, 2)};
 
     return DecimalType{significand, exp, sign};
 }
@@ -542,15 +581,11 @@ constexpr auto to_dpd_d64(const DecimalType val) noexcept
         dpd |= detail::d64_sign_mask;
     }
 
-    std::uint8_t d[std::numeric_limits<DecimalType>::digits10] {};
-    auto temp_sig {significand};
-    for (int i = 15; i >= 0; --i)
-    {
-        d[i] = static_cast<std::uint8_t>(temp_sig % 10U);
-        temp_sig /= 10U;
-    }
-    BOOST_DECIMAL_ASSERT(d[0] >= 0 && d[0] <= 9);
-    BOOST_DECIMAL_ASSERT(temp_sig == 0);
+    // Break the significand down into the 5 declets and the leading digit d0
+    auto temp_sig {static_cast<std::uint64_t>(significand)};
+    const auto declets {detail::encode_declets(temp_sig, 5)};
+    const auto d0 {temp_sig};
+    BOOST_DECIMAL_ASSERT(d0 <= 9U);
 
     constexpr std::uint64_t leading_two_exp_bits_mask {0b1100000000};
     const auto leading_two_bits {(exp & leading_two_exp_bits_mask) >> 8U};
@@ -560,12 +595,12 @@ constexpr auto to_dpd_d64(const DecimalType val) noexcept
 
     std::uint64_t combination_field_bits {};
 
-    // Now based on what the value of d[0] and the leading bits of exp are we can set the value of the combination field
+    // Now based on what the value of d0 and the leading bits of exp are we can set the value of the combination field
     // See 3.5.2.c.1
     // If d0 is 8 or 9 then we follow section i
-    if (d[0] >= 8)
+    if (d0 >= 8U)
     {
-        const auto d0_is_nine {d[0] == 9};
+        const auto d0_is_nine {d0 == 9U};
         switch (leading_two_bits)
         {
             case 0U:
@@ -586,8 +621,8 @@ constexpr auto to_dpd_d64(const DecimalType val) noexcept
     // If d0 is 0 to 7 then we follow section II
     else
     {
-        // In here the value of d[0] = 4*G2 + 2*G3 + G4
-        const auto d0_mask {static_cast<std::uint64_t>(d[0])};
+        // In here the value of d0 = 4*G2 + 2*G3 + G4
+        const auto d0_mask {static_cast<std::uint64_t>(d0)};
         switch (leading_two_bits)
         {
             case 0U:
@@ -614,16 +649,7 @@ constexpr auto to_dpd_d64(const DecimalType val) noexcept
     // Write the now known combination field and trailing exp bits to the result
     dpd |= (combination_field_bits << 58U);
     dpd |= (trailing_exp_bits << 50U);
-
-    // Now we need to encode all the declets
-    // Once we have the declet right it into the result
-    int offset {4};
-    for (std::size_t i {1}; i < 15; i += 3U)
-    {
-        const auto declet {static_cast<std::uint64_t>(detail::encode_dpd(d[i], d[i + 1], d[i + 2]))};
-        dpd |= (declet << (10 * offset));
-        --offset;
-    }
+    dpd |= declets;
 
     return dpd;
 }
@@ -662,7 +688,7 @@ constexpr auto from_dpd_d64(const std::uint64_t dpd) noexcept
     const auto sign {(dpd & detail::d64_sign_mask) != 0};
     const auto combination_field_bits {(dpd & dpd_d64_combination_field_mask) >> 58U};
     const auto exponent_field_bits {(dpd & dpd_d64_exponent_field_mask) >> 50U};
-    auto significand_bits {(dpd & dpd_d64_significand_field_mask)};
+    const auto significand_bits {(dpd & dpd_d64_significand_field_mask)};
 
     // Case 1: 3.5.2.c.1.i
     // Combination field bits are 110XX or 11110X
@@ -699,21 +725,8 @@ constexpr auto from_dpd_d64(const std::uint64_t dpd) noexcept
     const auto complete_exp {(leading_biased_exp_bits << 8U) + exponent_field_bits};
     const auto exp {static_cast<std::int32_t>(complete_exp) - detail::bias_v<DecimalType>};
 
-    // We can now decode the remainder of the significand to recover the value
-    std::uint8_t digits[16] {};
-    digits[0] = static_cast<std::uint8_t>(d0);
-    for (int i = 15; i > 0; i -= 3)
-    {
-        const auto declet_bits {static_cast<std::uint32_t>(significand_bits & 0b1111111111)};
-        significand_bits >>= 10U;
-        detail::decode_dpd(declet_bits, digits[i], digits[i - 1], digits[i - 2]);
-    }
-
-    std::uint64_t significand {};
-    for (std::uint64_t i {}; i < 16U; ++i)
-    {
-        significand += digits[i] * detail::pow10(15 - i);
-    }
+    // We can now decode the 5 declets following d0 to recover the significand
+    const auto significand {detail::decode_declets(d0, significand_bits, 5)};
 
     return DecimalType{significand, exp, sign};
 }
@@ -744,16 +757,17 @@ constexpr auto to_dpd_d128(const DecimalType val) noexcept
         dpd.high |= detail::d128_sign_mask;
     }
 
-    constexpr int num_digits {std::numeric_limits<DecimalType>::digits10};
-    std::uint8_t d[static_cast<std::size_t>(num_digits)] {};
-    auto temp_sig {significand};
-    for (int i = num_digits - 1; i >= 0; --i)
-    {
-        d[i] = static_cast<std::uint8_t>(temp_sig % 10U);
-        temp_sig /= 10U;
-    }
-    BOOST_DECIMAL_ASSERT(d[0] >= 0 && d[0] <= 9);
-    BOOST_DECIMAL_ASSERT(temp_sig == 0U);
+    // Split the significand into the low 18 digits and the high 16 so that the declets can be computed with 64-bit arithmetic.
+    // The low half holds 6 declets, and the high half holds 5 declets and the leading digit d0
+    constexpr std::uint64_t low_half_divisor {UINT64_C(1000000000000000000)};
+    const auto sig {static_cast<int128::uint128_t>(significand)};
+    auto high_sig {static_cast<std::uint64_t>(detail::div_pow10(sig, 18))};
+    auto low_sig {static_cast<std::uint64_t>(sig - static_cast<int128::uint128_t>(high_sig) * low_half_divisor)};
+
+    const auto low_declets {detail::encode_declets(low_sig, 6)};
+    const auto high_declets {detail::encode_declets(high_sig, 5)};
+    const auto d0 {high_sig};
+    BOOST_DECIMAL_ASSERT(d0 <= 9U);
 
     constexpr std::uint64_t leading_two_exp_bits_mask {0b11000000000000};
     const auto leading_two_bits {(exp & leading_two_exp_bits_mask) >> 12U};
@@ -762,12 +776,12 @@ constexpr auto to_dpd_d128(const DecimalType val) noexcept
 
     std::uint64_t combination_field_bits {};
 
-    // Now based on what the value of d[0] and the leading bits of exp are we can set the value of the combination field
+    // Now based on what the value of d0 and the leading bits of exp are we can set the value of the combination field
     // See 3.5.2.c.1
     // If d0 is 8 or 9 then we follow section i
-    if (d[0] >= 8)
+    if (d0 >= 8U)
     {
-        const auto d0_is_nine {d[0] == 9};
+        const auto d0_is_nine {d0 == 9U};
         switch (leading_two_bits)
         {
             case 0U:
@@ -788,8 +802,8 @@ constexpr auto to_dpd_d128(const DecimalType val) noexcept
         // If d0 is 0 to 7 then we follow section II
     else
     {
-        // In here the value of d[0] = 4*G2 + 2*G3 + G4
-        const auto d0_mask {static_cast<std::uint64_t>(d[0])};
+        // In here the value of d0 = 4*G2 + 2*G3 + G4
+        const auto d0_mask {static_cast<std::uint64_t>(d0)};
         switch (leading_two_bits)
         {
             case 0U:
@@ -817,14 +831,9 @@ constexpr auto to_dpd_d128(const DecimalType val) noexcept
     dpd.high |= (combination_field_bits << 58U);
     dpd.high |= (trailing_exp_bits << 46U);
 
-    // Now we have to encode all 11 of the declets
-    int offset {10};
-    for (std::size_t i {1}; i < num_digits - 1; i += 3U)
-    {
-        const auto declet {static_cast<int128::uint128_t>(detail::encode_dpd(d[i], d[i + 1], d[i + 2]))};
-        dpd |= int128::uint128_t(declet << (10 * offset));
-        --offset;
-    }
+    // The 11 declets occupy the low 110 bits
+    dpd.high |= (high_declets >> 4U);
+    dpd.low = low_declets | (high_declets << 60U);
 
     return dpd;
 }
@@ -860,7 +869,7 @@ constexpr auto from_dpd_d128(const int128::uint128_t dpd) noexcept
     const auto sign {(dpd.high & detail::d128_sign_mask) != 0};
     const auto combination_field_bits {(dpd.high & d128_dpd_combination_field_mask_high_bits) >> 58U};
     const auto exponent_field_bits {(dpd.high & d128_dpd_exponent_mask_high_bits) >> 46U};
-    auto significand_bits {(dpd & d128_dpd_significand_mask)};
+    const auto significand_bits {(dpd & d128_dpd_significand_mask)};
 
     // Case 1: 3.5.2.c.1.i
     // Combination field bits are 110XX or 11110X
@@ -897,22 +906,16 @@ constexpr auto from_dpd_d128(const int128::uint128_t dpd) noexcept
     const auto complete_exp {(leading_biased_exp_bits << 12U) + exponent_field_bits};
     const auto exp {static_cast<std::int32_t>(complete_exp) - detail::bias_v<DecimalType>};
 
-    // We can now decode the remainder of the significand to recover the value
-    constexpr auto num_digits {std::numeric_limits<DecimalType>::digits10};
-    std::uint8_t digits[static_cast<std::size_t>(num_digits)] {};
-    digits[0] = static_cast<std::uint8_t>(d0);
-    for (int i = num_digits - 1; i > 0; i -= 3)
-    {
-        const auto declet_bits {static_cast<std::uint32_t>(significand_bits & 0b1111111111U)};
-        significand_bits >>= 10U;
-        detail::decode_dpd(declet_bits, digits[i], digits[i - 1], digits[i - 2]);
-    }
+    // We can now decode the 11 declets following d0 to recover the significand.
+    // As in encoding the high 16 digits and the low 18 are assembled separately with 64-bit arithmetic
+    constexpr std::uint64_t low_half_multiplier {UINT64_C(1000000000000000000)};
+    constexpr std::uint64_t low_declets_mask {(UINT64_C(1) << 60U) - 1U};
+    const auto high_declets {static_cast<std::uint64_t>(significand_bits >> 60U)};
+    const auto low_declets {significand_bits.low & low_declets_mask};
 
-    int128::uint128_t significand {};
-    for (int i {}; i < num_digits; ++i)
-    {
-        significand += static_cast<int128::uint128_t>(digits[i]) * detail::pow10(static_cast<int128::uint128_t>((num_digits - 1) - i));
-    }
+    const auto high_sig {detail::decode_declets(d0, high_declets, 5)};
+    const auto low_sig {detail::decode_declets(std::uint64_t{}, low_declets, 6)};
+    const auto significand {static_cast<int128::uint128_t>(high_sig) * low_half_multiplier + low_sig};
 
     return DecimalType{significand, exp, sign};
 }
@@ -987,6 +990,60 @@ constexpr auto from_dpd(const detail::builtin_uint128_t bits) noexcept
 
 #endif // BOOST_DECIMAL_HAS_INT128
 
+// Bulk conversions over contiguous ranges of n elements: bits[i] = to_dpd(values[i]) and values[i] = from_dpd(bits[i])
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto to_dpd(const DecimalType* values, detail::interchange_bits_t<DecimalType>* bits, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    for (std::size_t i {}; i < n; ++i)
+    {
+        bits[i] = to_dpd(values[i]);
+    }
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto from_dpd(const detail::interchange_bits_t<DecimalType>* bits, DecimalType* values, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    for (std::size_t i {}; i < n; ++i)
+    {
+        values[i] = from_dpd<DecimalType>(bits[i]);
+    }
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+// Both spans must have the same extent
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto to_dpd(std::span<const DecimalType> values, std::span<detail::interchange_bits_t<DecimalType>> bits) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    BOOST_DECIMAL_ASSERT(values.size() == bits.size());
+    to_dpd(values.data(), bits.data(), values.size());
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto from_dpd(std::span<const detail::interchange_bits_t<DecimalType>> bits, std::span<DecimalType> values) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    BOOST_DECIMAL_ASSERT(values.size() == bits.size());
+    from_dpd(bits.data(), values.data(), values.size());
+}
+
+// DecimalType cannot be deduced from a span of non-const values for to_dpd above.
+// Taking the extent as well keeps this out of overload resolution when DecimalType is given explicitly for a container
+BOOST_DECIMAL_EXPORT template <typename DecimalType, std::size_t Extent>
+constexpr auto to_dpd(std::span<DecimalType, Extent> values, std::span<detail::interchange_bits_t<DecimalType>> bits) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    BOOST_DECIMAL_ASSERT(values.size() == bits.size());
+    to_dpd(values.data(), bits.data(), values.size());
+}
+
+#endif // BOOST_DECIMAL_HAS_STD_SPAN
+
 } // namespace decimal
 } // namespace boost
 
@@ -0,0 +1,424 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_FIXED_DECIMAL_HPP
+#define BOOST_DECIMAL_FIXED_DECIMAL_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal128_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if !defined(BOOST_DECIMAL_DISABLE_IOSTREAM)
+#include <ostream>
+#endif
+
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+template <typename Storage>
+struct fixed_decimal_traits;
+
+// The product of two magnitudes always fits in product_type,
+// and a magnitude times 10^(max_scale + 1) always fits in a uint128_t
+
+template <>
+struct fixed_decimal_traits<std::int32_t>
+{
+    using magnitude_type = std::uint32_t;
+    using product_type = std::uint64_t;
+
+    static constexpr int max_scale {9};
+};
+
+template <>
+struct fixed_decimal_traits<std::int64_t>
+{
+    using magnitude_type = std::uint64_t;
+    using product_type = int128::uint128_t;
+
+    static constexpr int max_scale {18};
+};
+
+// Divides by 10^digits and rounds in the current rounding mode.
+// sticky records that nonzero digits were already removed before the call
+template <typename T>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto fixed_decimal_shift_right(T val, const int digits, const bool is_neg, bool sticky) noexcept -> T
+{
+    if (digits > std::numeric_limits<T>::digits10 + 1)
+    {
+        sticky = sticky || val != 0U;
+        val = 0U;
+    }
+    else if (digits > 1)
+    {
+        const auto divisor {pow10(static_cast<T>(digits - 1))};
+        sticky = sticky || val % divisor != 0U;
+        val /= divisor;
+    }
+
+    // decimal128_t has more significand digits than any value reaching here, so the result is never shifted again
+    fenv_round<decimal128_t>(val, is_neg, sticky);
+
+    return val;
+}
+
+} // namespace detail
+
+// A decimal number with exactly Scale fractional digits, stored as the integer value * 10^Scale.
+// Addition, subtraction and comparisons are single integer operations.
+// Multiplication and division round the result to Scale digits in the current rounding mode.
+// Like the Storage type itself, results which are out of range are undefined
+BOOST_DECIMAL_EXPORT template <int Scale, typename Storage = std::int64_t>
+class fixed_decimal
+{
+public:
+    using storage_type = Storage;
+
+    static constexpr int scale {Scale};
+
+private:
+    using traits = detail::fixed_decimal_traits<Storage>;
+    using magnitude_type = typename traits::magnitude_type;
+    using product_type = typename traits::product_type;
+
+    static_assert(Scale >= 0 && Scale <= traits::max_scale, "Scale must be in the range [0, digits10] of the Storage type");
+
+    Storage value_ {};
+
+    static constexpr auto magnitude(const Storage val) noexcept -> magnitude_type
+    {
+        return val < 0 ? static_cast<magnitude_type>(magnitude_type{0} - static_cast<magnitude_type>(val)) : static_cast<magnitude_type>(val);
+    }
+
+    template <typename T>
+    static constexpr auto from_magnitude(const T mag, const bool is_neg) noexcept -> fixed_decimal
+    {
+        const auto val {static_cast<magnitude_type>(mag)};
+        return from_scaled(static_cast<Storage>(is_neg ? static_cast<magnitude_type>(magnitude_type{0} - val) : val));
+    }
+
+public:
+    constexpr fixed_decimal() noexcept = default;
+
+    #ifdef BOOST_DECIMAL_HAS_CONCEPTS
+    template <BOOST_DECIMAL_INTEGRAL Integer>
+    #else
+    template <typename Integer, std::enable_if_t<detail::is_integral_v<Integer>, bool> = true>
+    #endif
+    explicit constexpr fixed_decimal(const Integer val) noexcept
+        : value_ {static_cast<Storage>(static_cast<Storage>(val) * detail::pow10(static_cast<Storage>(Scale)))} {}
+
+    // Rounds to Scale fractional digits in the current rounding mode.
+    // NaN gives zero, and values out of range, including infinities, saturate
+    #ifdef BOOST_DECIMAL_HAS_CONCEPTS
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
+    #else
+    template <typename Decimal, std::enable_if_t<detail::is_decimal_floating_point_v<Decimal>, bool> = true>
+    #endif
+    explicit constexpr fixed_decimal(const Decimal val) noexcept
+    {
+        const bool is_neg {signbit(val)};
+        const auto limit {static_cast<int128::uint128_t>(magnitude(is_neg ? (std::numeric_limits<Storage>::min)() : (std::numeric_limits<Storage>::max)()))};
+
+        #ifndef BOOST_DECIMAL_FAST_MATH
+        if (isnan(val))
+        {
+            return;
+        }
+        if (isinf(val))
+        {
+            *this = from_magnitude(limit, is_neg);
+            return;
+        }
+        #endif
+
+        int exp {};
+        int128::uint128_t mag {frexp10(val, &exp)};
+        const auto shift {exp + Scale};
+
+        if (shift < 0)
+        {
+            mag = detail::fixed_decimal_shift_right(mag, -shift, is_neg, false);
+        }
+        else if (mag != 0U)
+        {
+            // mag * 10^shift > limit, without overflowing
+            if (shift > std::numeric_limits<int128::uint128_t>::digits10 || mag > limit / detail::pow10(static_cast<int128::uint128_t>(shift)))
+            {
+                mag = limit;
+            }
+            else
+            {
+                mag *= detail::pow10(static_cast<int128::uint128_t>(shift));
+            }
+        }
+
+        *this = from_magnitude(mag > limit ? limit : mag, is_neg);
+    }
+
+    // Exact when the type has enough digits, which decimal128_t always does
+    #ifdef BOOST_DECIMAL_HAS_CONCEPTS
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
+    #else
+    template <typename Decimal, std::enable_if_t<detail::is_decimal_floating_point_v<Decimal>, bool> = true>
+    #endif
+    explicit constexpr operator Decimal() const noexcept
+    {
+        return Decimal{magnitude(value_), -Scale, value_ < 0};
+    }
+
+    // The value is scaled * 10^-Scale
+    static constexpr auto from_scaled(const Storage scaled) noexcept -> fixed_decimal
+    {
+        fixed_decimal res {};
+        res.value_ = scaled;
+        return res;
+    }
+
+    constexpr auto scaled_value() const noexcept -> Storage
+    {
+        return value_;
+    }
+
+    // Unary operators
+    constexpr auto operator+() const noexcept -> fixed_decimal
+    {
+        return *this;
+    }
+
+    constexpr auto operator-() const noexcept -> fixed_decimal
+    {
+        return from_scaled(static_cast<Storage>(-value_));
+    }
+
+    // Addition and subtraction need no rescaling since both operands have the same scale
+    friend constexpr auto operator+(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> fixed_decimal
+    {
+        return from_scaled(static_cast<Storage>(lhs.value_ + rhs.value_));
+    }
+
+    friend constexpr auto operator-(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> fixed_decimal
+    {
+        return from_scaled(static_cast<Storage>(lhs.value_ - rhs.value_));
+    }
+
+    // The product has 2 * Scale fractional digits, of which Scale are rounded off
+    friend constexpr auto operator*(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> fixed_decimal
+    {
+        const bool is_neg {(lhs.value_ < 0) != (rhs.value_ < 0)};
+        auto product {static_cast<product_type>(static_cast<product_type>(magnitude(lhs.value_)) * magnitude(rhs.value_))};
+
+        BOOST_DECIMAL_IF_CONSTEXPR (Scale > 0)
+        {
+            // Most products still fit in the narrower type, where the division is much cheaper
+            if (product <= (std::numeric_limits<magnitude_type>::max)())
+            {
+                return from_magnitude(detail::fixed_decimal_shift_right(static_cast<magnitude_type>(product), Scale, is_neg, false), is_neg);
+            }
+
+            product = detail::fixed_decimal_shift_right(product, Scale, is_neg, false);
+        }
+
+        return from_magnitude(product, is_neg);
+    }
+
+    // Computes one digit beyond Scale, and the remainder of the division decides the rounding of ties.
+    // rhs must not be zero
+    friend constexpr auto operator/(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> fixed_decimal
+    {
+        const bool is_neg {(lhs.value_ < 0) != (rhs.value_ < 0)};
+        const auto numerator {static_cast<int128::uint128_t>(magnitude(lhs.value_)) * detail::pow10(static_cast<int128::uint128_t>(Scale + 1))};
+        const auto denominator {magnitude(rhs.value_)};
+
+        if (numerator <= (std::numeric_limits<std::uint64_t>::max)())
+        {
+            const auto narrow_numerator {static_cast<std::uint64_t>(numerator)};
+            auto quotient {narrow_numerator / denominator};
+            const bool sticky {quotient * denominator != narrow_numerator};
+            quotient = detail::fixed_decimal_shift_right(quotient, 1, is_neg, sticky);
+
+            return from_magnitude(quotient, is_neg);
+        }
+
+        auto quotient {numerator / denominator};
+        const bool sticky {quotient * denominator != numerator};
+        quotient = detail::fixed_decimal_shift_right(quotient, 1, is_neg, sticky);
+
+        return from_magnitude(quotient, is_neg);
+    }
+
+    // Scaling by an integer is exact, apart from the rounding of the division
+    #ifdef BOOST_DECIMAL_HAS_CONCEPTS
+    template <BOOST_DECIMAL_INTEGRAL Integer>
+    #else
+    template <typename Integer, std::enable_if_t<detail::is_integral_v<Integer>, bool> = true>
+    #endif
+    friend constexpr auto operator*(const fixed_decimal lhs, const Integer rhs) noexcept -> fixed_decimal
+    {
+        return from_scaled(static_cast<Storage>(lhs.value_ * static_cast<Storage>(rhs)));
+    }
+
+    #ifdef BOOST_DECIMAL_HAS_CONCEPTS
+    template <BOOST_DECIMAL_INTEGRAL Integer>
+    #else
+    template <typename Integer, std::enable_if_t<detail::is_integral_v<Integer>, bool> = true>
+    #endif
+    friend constexpr auto operator*(const Integer lhs, const fixed_decimal rhs) noexcept -> fixed_decimal
+    {
+        return rhs * lhs;
+    }
+
+    #ifdef BOOST_DECIMAL_HAS_CONCEPTS
+    template <BOOST_DECIMAL_INTEGRAL Integer>
+    #else
+    template <typename Integer, std::enable_if_t<detail::is_integral_v<Integer>, bool> = true>
+    #endif
+    friend constexpr auto operator/(const fixed_decimal lhs, const Integer rhs) noexcept -> fixed_decimal
+    {
+        const bool is_neg {(lhs.value_ < 0) != (static_cast<Storage>(rhs) < 0)};
+        const auto numerator {static_cast<product_type>(static_cast<product_type>(magnitude(lhs.value_)) * 10U)};
+        const auto denominator {static_cast<product_type>(magnitude(static_cast<Storage>(rhs)))};
+
+        auto quotient {static_cast<product_type>(numerator / denominator)};
+        const bool sticky {quotient * denominator != numerator};
+        quotient = detail::fixed_decimal_shift_right(quotient, 1, is_neg, sticky);
+
+        return from_magnitude(quotient, is_neg);
+    }
+
+    // Compound assignment
+    constexpr auto operator+=(const fixed_decimal rhs) noexcept -> fixed_decimal&
+    {
+        *this = *this + rhs;
+        return *this;
+    }
+
+    constexpr auto operator-=(const fixed_decimal rhs) noexcept -> fixed_decimal&
+    {
+        *this = *this - rhs;
+        return *this;
+    }
+
+    constexpr auto operator*=(const fixed_decimal rhs) noexcept -> fixed_decimal&
+    {
+        *this = *this * rhs;
+        return *this;
+    }
+
+    constexpr auto operator/=(const fixed_decimal rhs) noexcept -> fixed_decimal&
+    {
+        *this = *this / rhs;
+        return *this;
+    }
+
+    template <typename Integer>
+    constexpr auto operator*=(const Integer rhs) noexcept
+        BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, fixed_decimal&)
+    {
+        *this = *this * rhs;
+        return *this;
+    }
+
+    template <typename Integer>
+    constexpr auto operator/=(const Integer rhs) noexcept
+        BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, fixed_decimal&)
+    {
+        *this = *this / rhs;
+        return *this;
+    }
+
+    // Comparisons are those of the scaled integers
+    friend constexpr auto operator==(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> bool
+    {
+        return lhs.value_ == rhs.value_;
+    }
+
+    friend constexpr auto operator!=(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> bool
+    {
+        return lhs.value_ != rhs.value_;
+    }
+
+    friend constexpr auto operator<(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> bool
+    {
+        return lhs.value_ < rhs.value_;
+    }
+
+    friend constexpr auto operator<=(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> bool
+    {
+        return lhs.value_ <= rhs.value_;
+    }
+
+    friend constexpr auto operator>(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> bool
+    {
+        return lhs.value_ > rhs.value_;
+    }
+
+    friend constexpr auto operator>=(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> bool
+    {
+        return lhs.value_ >= rhs.value_;
+    }
+
+    #ifdef BOOST_DECIMAL_HAS_SPACESHIP_OPERATOR
+    friend constexpr auto operator<=>(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> std::strong_ordering
+    {
+        return lhs.value_ <=> rhs.value_;
+    }
+    #endif
+
+    #if !defined(BOOST_DECIMAL_DISABLE_IOSTREAM)
+
+    // Always prints all Scale fractional digits, e.g. 12.50 for fixed_decimal<2>
+    template <typename charT, typename traits_type>
+    friend auto operator<<(std::basic_ostream<charT, traits_type>& os, const fixed_decimal val) -> std::basic_ostream<charT, traits_type>&
+    {
+        char buffer[std::numeric_limits<magnitude_type>::digits10 + 5] {};
+        char* first {buffer + sizeof(buffer) - 1U};
+
+        // At least one digit before the decimal point
+        auto mag {magnitude(val.value_)};
+        for (int i {}; i <= Scale || mag != 0U; ++i)
+        {
+            if (i == Scale && Scale != 0)
+            {
+                *--first = '.';
+            }
+
+            *--first = static_cast<char>('0' + static_cast<int>(mag % 10U));
+            mag /= 10U;
+        }
+
+        if (val.value_ < 0)
+        {
+            *--first = '-';
+        }
+
+        os << first;
+        return os;
+    }
+
+    #endif // BOOST_DECIMAL_DISABLE_IOSTREAM
+};
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_FIXED_DECIMAL_HPP
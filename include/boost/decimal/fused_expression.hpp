@@ -0,0 +1,493 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_FUSED_EXPRESSION_HPP
+#define BOOST_DECIMAL_FUSED_EXPRESSION_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// The nodes of an expression hold their operands by value, so an expression can outlive the variables it was built from
+
+template <typename DecimalType>
+struct fused_terminal
+{
+    DecimalType value;
+};
+
+struct fused_add {};
+struct fused_sub {};
+struct fused_mul {};
+
+template <typename Op, typename Lhs, typename Rhs>
+struct fused_binary
+{
+    Lhs lhs;
+    Rhs rhs;
+};
+
+template <typename Operand>
+struct fused_negate
+{
+    Operand operand;
+};
+
+// An intermediate result, held unrounded in an unsigned integer of at least twice the precision of the type.
+// When digits had to be removed, the last digit is made odd so that it can not be mistaken for an exact value.
+// Every rounding of the final result is at least two digits above it, so is the same as the rounding of the value without the removal
+template <typename UnsignedInteger>
+struct fused_components
+{
+    using significand_type = UnsignedInteger;
+
+    // The sum of two significands of add_digits, or the product of two of mul_digits, still fits:
+    // 19 and 9 digits in 64 bits, and 38 and 19 digits in 128 bits
+    static constexpr int add_digits {std::numeric_limits<UnsignedInteger>::digits10 - 1};
+    static constexpr int mul_digits {std::numeric_limits<UnsignedInteger>::digits10 / 2};
+
+    UnsignedInteger sig;
+    int exp;
+    bool sign;
+};
+
+// 64 bits hold the exact products of 7 digit significands, and 128 bits those of 16 digits
+template <typename DecimalType>
+using fused_components_type = fused_components<std::conditional_t<(precision_v<DecimalType> <= 7), std::uint64_t, boost::int128::uint128_t>>;
+
+template <typename Components>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto fused_shrink(Components& val, const int max_digits) noexcept -> void
+{
+    using sig_type = typename Components::significand_type;
+
+    if (val.sig >= pow10(static_cast<sig_type>(max_digits)))
+    {
+        const auto digits {num_digits(val.sig)};
+        const auto divisor {pow10(static_cast<sig_type>(digits - max_digits))};
+        const bool inexact {val.sig % divisor != 0U};
+
+        val.sig /= divisor;
+        val.exp += digits - max_digits;
+
+        if (inexact)
+        {
+            val.sig |= 1U;
+        }
+    }
+}
+
+template <typename Components>
+constexpr auto fused_add_impl(Components lhs, Components rhs) noexcept -> Components
+{
+    using sig_type = typename Components::significand_type;
+
+    if (lhs.sig == 0U || rhs.sig == 0U)
+    {
+        if (lhs.sig == 0U && rhs.sig == 0U)
+        {
+            return {0U, 0, lhs.sign && rhs.sign};
+        }
+
+        return lhs.sig == 0U ? rhs : lhs;
+    }
+
+    fused_shrink(lhs, Components::add_digits);
+    fused_shrink(rhs, Components::add_digits);
+
+    auto& high {lhs.exp >= rhs.exp ? lhs : rhs};
+    auto& low {lhs.exp >= rhs.exp ? rhs : lhs};
+
+    // Scale the operand with the larger exponent up as far as it goes,
+    // and only then scale the other one down
+    auto gap {high.exp - low.exp};
+    const auto room {Components::add_digits - num_digits(high.sig)};
+    const auto up {gap < room ? gap : room};
+
+    high.sig *= pow10(static_cast<sig_type>(up));
+    high.exp -= up;
+    gap -= up;
+
+    bool sticky {};
+    if (gap > 0)
+    {
+        if (gap > Components::add_digits || low.sig < pow10(static_cast<sig_type>(gap)))
+        {
+            low.sig = 0U;
+            sticky = true;
+        }
+        else
+        {
+            const auto divisor {pow10(static_cast<sig_type>(gap))};
+            sticky = low.sig % divisor != 0U;
+            low.sig /= divisor;
+        }
+    }
+
+    Components res {0U, high.exp, high.sign};
+
+    if (high.sign == low.sign)
+    {
+        res.sig = high.sig + low.sig;
+    }
+    else if (sticky)
+    {
+        // high has add_digits digits and low fewer, and the removed digits of low make the difference smaller
+        res.sig = high.sig - low.sig - 1U;
+    }
+    else if (high.sig >= low.sig)
+    {
+        res.sig = high.sig - low.sig;
+    }
+    else
+    {
+        res.sig = low.sig - high.sig;
+        res.sign = low.sign;
+    }
+
+    if (sticky)
+    {
+        res.sig |= 1U;
+    }
+    else if (res.sig == 0U)
+    {
+        // An exact cancellation gives +0
+        res.sign = false;
+    }
+
+    return res;
+}
+
+template <typename Components>
+constexpr auto fused_mul_impl(Components lhs, Components rhs) noexcept -> Components
+{
+    fused_shrink(lhs, Components::mul_digits);
+    fused_shrink(rhs, Components::mul_digits);
+
+    return {lhs.sig * rhs.sig, lhs.exp + rhs.exp, lhs.sign != rhs.sign};
+}
+
+// Unrounded evaluation of each kind of node
+
+template <typename DecimalType>
+constexpr auto fused_evaluate(const fused_terminal<DecimalType>& node) noexcept -> fused_components_type<DecimalType>
+{
+    int exp {};
+    const auto sig {frexp10(node.value, &exp)};
+
+    return {sig, exp, signbit(node.value)};
+}
+
+template <typename Lhs, typename Rhs>
+constexpr auto fused_evaluate(const fused_binary<fused_add, Lhs, Rhs>& node) noexcept
+{
+    return fused_add_impl(fused_evaluate(node.lhs), fused_evaluate(node.rhs));
+}
+
+template <typename Lhs, typename Rhs>
+constexpr auto fused_evaluate(const fused_binary<fused_sub, Lhs, Rhs>& node) noexcept
+{
+    auto rhs {fused_evaluate(node.rhs)};
+    rhs.sign = !rhs.sign;
+
+    return fused_add_impl(fused_evaluate(node.lhs), rhs);
+}
+
+template <typename Lhs, typename Rhs>
+constexpr auto fused_evaluate(const fused_binary<fused_mul, Lhs, Rhs>& node) noexcept
+{
+    return fused_mul_impl(fused_evaluate(node.lhs), fused_evaluate(node.rhs));
+}
+
+template <typename Operand>
+constexpr auto fused_evaluate(const fused_negate<Operand>& node) noexcept
+{
+    auto res {fused_evaluate(node.operand)};
+    res.sign = !res.sign;
+
+    return res;
+}
+
+// Evaluation with the usual operators, which gives the IEEE 754 results when an operand is not finite
+
+template <typename DecimalType>
+constexpr auto fused_evaluate_rounded(const fused_terminal<DecimalType>& node) noexcept -> DecimalType
+{
+    return node.value;
+}
+
+template <typename Lhs, typename Rhs>
+constexpr auto fused_evaluate_rounded(const fused_binary<fused_add, Lhs, Rhs>& node) noexcept
+{
+    return fused_evaluate_rounded(node.lhs) + fused_evaluate_rounded(node.rhs);
+}
+
+template <typename Lhs, typename Rhs>
+constexpr auto fused_evaluate_rounded(const fused_binary<fused_sub, Lhs, Rhs>& node) noexcept
+{
+    return fused_evaluate_rounded(node.lhs) - fused_evaluate_rounded(node.rhs);
+}
+
+template <typename Lhs, typename Rhs>
+constexpr auto fused_evaluate_rounded(const fused_binary<fused_mul, Lhs, Rhs>& node) noexcept
+{
+    return fused_evaluate_rounded(node.lhs) * fused_evaluate_rounded(node.rhs);
+}
+
+template <typename Operand>
+constexpr auto fused_evaluate_rounded(const fused_negate<Operand>& node) noexcept
+{
+    return -fused_evaluate_rounded(node.operand);
+}
+
+template <typename DecimalType>
+constexpr auto fused_isfinite(const fused_terminal<DecimalType>& node) noexcept -> bool
+{
+    return isfinite(node.value);
+}
+
+template <typename Op, typename Lhs, typename Rhs>
+constexpr auto fused_isfinite(const fused_binary<Op, Lhs, Rhs>& node) noexcept -> bool
+{
+    return fused_isfinite(node.lhs) && fused_isfinite(node.rhs);
+}
+
+template <typename Operand>
+constexpr auto fused_isfinite(const fused_negate<Operand>& node) noexcept -> bool
+{
+    return fused_isfinite(node.operand);
+}
+
+// The only rounding of the expression, in the current rounding mode
+template <typename DecimalType, typename Components>
+constexpr auto fused_round(Components val) noexcept -> DecimalType
+{
+    using significand_type = typename DecimalType::significand_type;
+    using sig_type = typename Components::significand_type;
+
+    if (val.sig == 0U)
+    {
+        return DecimalType{0U, 0, val.sign};
+    }
+
+    // Keep at most precision digits, and never an exponent below etiny.
+    // One digit more than that is kept here and rounded off by fenv_round
+    const auto digits {num_digits(val.sig)};
+    const auto max_drop {digits - precision_v<DecimalType>};
+    const auto min_drop {etiny_v<DecimalType> - val.exp};
+    const auto drop {max_drop > min_drop ? max_drop : min_drop};
+
+    if (drop <= 0)
+    {
+        return DecimalType{static_cast<significand_type>(val.sig), val.exp, val.sign};
+    }
+
+    const auto removed {drop - 1};
+    bool sticky {};
+
+    if (removed >= digits)
+    {
+        val.sig = 0U;
+        sticky = true;
+    }
+    else if (removed > 0)
+    {
+        const auto divisor {pow10(static_cast<sig_type>(removed))};
+        sticky = val.sig % divisor != 0U;
+        val.sig /= divisor;
+    }
+
+    auto sig {static_cast<significand_type>(val.sig)};
+    auto exp {val.exp + removed};
+
+    // As in decimal_accumulator, decimal_fast128_t only sets a limit that is never reached
+    exp += fenv_round<decimal_fast128_t>(sig, val.sign, sticky);
+
+    if (sig == pow10(static_cast<significand_type>(precision_v<DecimalType>)))
+    {
+        sig /= 10U;
+        ++exp;
+    }
+
+    return DecimalType{sig, exp, val.sign};
+}
+
+template <typename T>
+struct is_fused_decimal
+{
+    static constexpr bool value {std::is_same<T, decimal32_t>::value || std::is_same<T, decimal64_t>::value ||
+                                 std::is_same<T, decimal_fast32_t>::value || std::is_same<T, decimal_fast64_t>::value};
+};
+
+template <typename T>
+constexpr bool is_fused_decimal_v = is_fused_decimal<T>::value;
+
+} // namespace detail
+
+// An expression of +, - and * over values of DecimalType, which is only rounded once when it is converted to DecimalType.
+// The intermediate results are held unpacked in integers of at least twice the precision, so they are neither rounded to the precision of DecimalType
+// nor encoded back into it in between
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Node = detail::fused_terminal<DecimalType>>
+class fused_expression
+{
+public:
+    static_assert(detail::is_fused_decimal_v<DecimalType>, "fused expressions support decimal32_t, decimal64_t, decimal_fast32_t and decimal_fast64_t");
+
+    using value_type = DecimalType;
+    using node_type = Node;
+
+private:
+    Node node_;
+
+public:
+    constexpr explicit fused_expression(const Node& node) noexcept : node_ {node} {}
+
+    constexpr auto node() const noexcept -> const Node&
+    {
+        return node_;
+    }
+
+    constexpr auto value() const noexcept -> DecimalType
+    {
+        #ifndef BOOST_DECIMAL_FAST_MATH
+        if (!detail::fused_isfinite(node_))
+        {
+            return detail::fused_evaluate_rounded(node_);
+        }
+        #endif
+
+        return detail::fused_round<DecimalType>(detail::fused_evaluate(node_));
+    }
+
+    constexpr operator DecimalType() const noexcept
+    {
+        return value();
+    }
+};
+
+// Starts an expression, e.g. DecimalType price {fused(a) * b + fused(c) * d - e};
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto fused(const DecimalType val) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_fused_decimal_v, DecimalType, fused_expression<DecimalType>)
+{
+    return fused_expression<DecimalType> {detail::fused_terminal<DecimalType> {val}};
+}
+
+namespace detail {
+
+template <typename DecimalType, typename Node>
+constexpr auto fused_node(const fused_expression<DecimalType, Node>& expr) noexcept -> const Node&
+{
+    return expr.node();
+}
+
+template <typename DecimalType>
+constexpr auto fused_node(const DecimalType val) noexcept -> fused_terminal<DecimalType>
+{
+    return fused_terminal<DecimalType> {val};
+}
+
+template <typename DecimalType, typename Op, typename Lhs, typename Rhs>
+constexpr auto fused_make_binary(const Lhs& lhs, const Rhs& rhs) noexcept
+{
+    using lhs_node = std::decay_t<decltype(fused_node(lhs))>;
+    using rhs_node = std::decay_t<decltype(fused_node(rhs))>;
+    using node_type = fused_binary<Op, lhs_node, rhs_node>;
+
+    return fused_expression<DecimalType, node_type> {node_type {fused_node(lhs), fused_node(rhs)}};
+}
+
+} // namespace detail
+
+// Each operator takes two expressions, or an expression and a value of the same DecimalType
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Lhs, typename Rhs>
+constexpr auto operator+(const fused_expression<DecimalType, Lhs>& lhs, const fused_expression<DecimalType, Rhs>& rhs) noexcept
+{
+    return detail::fused_make_binary<DecimalType, detail::fused_add>(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Lhs>
+constexpr auto operator+(const fused_expression<DecimalType, Lhs>& lhs, const DecimalType rhs) noexcept
+{
+    return detail::fused_make_binary<DecimalType, detail::fused_add>(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Rhs>
+constexpr auto operator+(const DecimalType lhs, const fused_expression<DecimalType, Rhs>& rhs) noexcept
+{
+    return detail::fused_make_binary<DecimalType, detail::fused_add>(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Lhs, typename Rhs>
+constexpr auto operator-(const fused_expression<DecimalType, Lhs>& lhs, const fused_expression<DecimalType, Rhs>& rhs) noexcept
+{
+    return detail::fused_make_binary<DecimalType, detail::fused_sub>(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Lhs>
+constexpr auto operator-(const fused_expression<DecimalType, Lhs>& lhs, const DecimalType rhs) noexcept
+{
+    return detail::fused_make_binary<DecimalType, detail::fused_sub>(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Rhs>
+constexpr auto operator-(const DecimalType lhs, const fused_expression<DecimalType, Rhs>& rhs) noexcept
+{
+    return detail::fused_make_binary<DecimalType, detail::fused_sub>(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Lhs, typename Rhs>
+constexpr auto operator*(const fused_expression<DecimalType, Lhs>& lhs, const fused_expression<DecimalType, Rhs>& rhs) noexcept
+{
+    return detail::fused_make_binary<DecimalType, detail::fused_mul>(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Lhs>
+constexpr auto operator*(const fused_expression<DecimalType, Lhs>& lhs, const DecimalType rhs) noexcept
+{
+    return detail::fused_make_binary<DecimalType, detail::fused_mul>(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Rhs>
+constexpr auto operator*(const DecimalType lhs, const fused_expression<DecimalType, Rhs>& rhs) noexcept
+{
+    return detail::fused_make_binary<DecimalType, detail::fused_mul>(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Operand>
+constexpr auto operator-(const fused_expression<DecimalType, Operand>& operand) noexcept
+{
+    using node_type = detail::fused_negate<Operand>;
+    return fused_expression<DecimalType, node_type> {node_type {operand.node()}};
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Operand>
+constexpr auto operator+(const fused_expression<DecimalType, Operand>& operand) noexcept -> fused_expression<DecimalType, Operand>
+{
+    return operand;
+}
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_FUSED_EXPRESSION_HPP
@@ -0,0 +1,211 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_ORDERED_KEY_HPP
+#define BOOST_DECIMAL_ORDERED_KEY_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal128_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// Layout of the keys of a type with precision p, in increasing order:
+//
+//   ~key(+qNaN) ~key(+sNaN) ~key(+inf) ... ~key(+x) ... -0 | +0 ... +x ... +inf +sNaN +qNaN
+//
+// where +0 sits at the midpoint of the key range and every positive finite x = m * 10^e,
+// with m normalized into [10^(p-1), 10^p), lies at (e - e_min) * 10^p + m above it.
+// Larger exponents are always larger values once the significand is normalized,
+// so the order of the keys is the order of the values.
+// Negative values are the bitwise complement of their magnitude, which reverses their order.
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
+struct ordered_key_traits
+{
+    using key_type = std::conditional_t<decimal_val_v<DecimalType> < 64, std::uint32_t,
+                        std::conditional_t<decimal_val_v<DecimalType> < 128, std::uint64_t, int128::uint128_t>>;
+
+    static constexpr int precision {precision_v<DecimalType>};
+
+    // The normalized exponents of denorm_min and max
+    static constexpr int min_exp {etiny_v<DecimalType> - (precision_v<DecimalType> - 1)};
+    static constexpr int max_exp {max_biased_exp_v<DecimalType> - bias_v<DecimalType>};
+
+    static constexpr auto positive_zero() noexcept -> key_type
+    {
+        return static_cast<key_type>(key_type{1} << (std::numeric_limits<key_type>::digits - 1));
+    }
+
+    static constexpr auto significand_range() noexcept -> key_type
+    {
+        return pow10(static_cast<key_type>(precision));
+    }
+
+    // Offset of +inf from +0, which is one past the largest finite key
+    static constexpr auto infinity_offset() noexcept -> key_type
+    {
+        return static_cast<key_type>(static_cast<key_type>(max_exp - min_exp + 1) * significand_range());
+    }
+};
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
+constexpr auto to_ordered_key_impl(const DecimalType val) noexcept -> typename ordered_key_traits<DecimalType>::key_type
+{
+    using traits = ordered_key_traits<DecimalType>;
+    using key_type = typename traits::key_type;
+
+    key_type magnitude {};
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (isnan(val))
+    {
+        magnitude = static_cast<key_type>(traits::infinity_offset() + (issignaling(val) ? 1U : 2U));
+    }
+    else if (isinf(val))
+    {
+        magnitude = traits::infinity_offset();
+    }
+    else
+    #endif
+    {
+        int exp {};
+        const auto sig {frexp10(val, &exp)};
+
+        // Zero stays at the midpoint whatever its exponent
+        if (sig != 0U)
+        {
+            magnitude = static_cast<key_type>(static_cast<key_type>(exp - traits::min_exp) * traits::significand_range() + static_cast<key_type>(sig));
+        }
+    }
+
+    const auto key {static_cast<key_type>(traits::positive_zero() + magnitude)};
+
+    return signbit(val) ? static_cast<key_type>(~key) : key;
+}
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
+constexpr auto from_ordered_key_impl(const typename ordered_key_traits<DecimalType>::key_type key) noexcept -> DecimalType
+{
+    using traits = ordered_key_traits<DecimalType>;
+    using key_type = typename traits::key_type;
+    using sig_type = typename DecimalType::significand_type;
+
+    const bool sign {key < traits::positive_zero()};
+    const auto magnitude {static_cast<key_type>((sign ? static_cast<key_type>(~key) : key) - traits::positive_zero())};
+
+    if (magnitude < traits::infinity_offset())
+    {
+        auto exp {static_cast<int>(magnitude / traits::significand_range()) + traits::min_exp};
+        auto sig {static_cast<sig_type>(magnitude % traits::significand_range())};
+
+        // Subnormals have to be given with their trailing zeros removed, which is exact for any key of a value
+        if (exp < etiny_v<DecimalType>)
+        {
+            sig /= pow10(static_cast<sig_type>(etiny_v<DecimalType> - exp));
+            exp = etiny_v<DecimalType>;
+        }
+
+        // A zero significand gives a zero of the right sign
+        return DecimalType{sig, sig == 0U ? 0 : exp, sign};
+    }
+
+    DecimalType res {};
+    if (magnitude == traits::infinity_offset())
+    {
+        res = std::numeric_limits<DecimalType>::infinity();
+    }
+    else if (magnitude == traits::infinity_offset() + 1U)
+    {
+        res = std::numeric_limits<DecimalType>::signaling_NaN();
+    }
+    else
+    {
+        res = std::numeric_limits<DecimalType>::quiet_NaN();
+    }
+
+    return sign ? -res : res;
+}
+
+} // namespace detail
+
+// Maps each value onto an unsigned integer of the same width such that comparing the integers
+// gives the same result as comparing the values, for use as sort or index keys.
+// -0 sorts directly below +0, and NaNs sort beyond the infinity of the same sign.
+// Every member of a cohort (e.g. 1.0 and 1.00) maps to the same key
+BOOST_DECIMAL_EXPORT constexpr auto to_ordered_key(const decimal32_t val) noexcept -> std::uint32_t
+{
+    return detail::to_ordered_key_impl(val);
+}
+
+BOOST_DECIMAL_EXPORT constexpr auto to_ordered_key(const decimal_fast32_t val) noexcept -> std::uint32_t
+{
+    const decimal32_t compliant_val {val};
+    return detail::to_ordered_key_impl(compliant_val);
+}
+
+BOOST_DECIMAL_EXPORT constexpr auto to_ordered_key(const decimal64_t val) noexcept -> std::uint64_t
+{
+    return detail::to_ordered_key_impl(val);
+}
+
+BOOST_DECIMAL_EXPORT constexpr auto to_ordered_key(const decimal_fast64_t val) noexcept -> std::uint64_t
+{
+    const decimal64_t compliant_val {val};
+    return detail::to_ordered_key_impl(compliant_val);
+}
+
+BOOST_DECIMAL_EXPORT constexpr auto to_ordered_key(const decimal128_t val) noexcept -> int128::uint128_t
+{
+    return detail::to_ordered_key_impl(val);
+}
+
+BOOST_DECIMAL_EXPORT constexpr auto to_ordered_key(const decimal_fast128_t& val) noexcept -> int128::uint128_t
+{
+    const decimal128_t compliant_val {val};
+    return detail::to_ordered_key_impl(compliant_val);
+}
+
+// Returns the normalized member of the cohort the key was made from.
+// NaN payloads are not preserved, and the fast types are converted from their IEEE counterpart
+BOOST_DECIMAL_EXPORT template <typename T = decimal32_t>
+constexpr auto from_ordered_key(const std::uint32_t key) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, T)
+{
+    return static_cast<T>(detail::from_ordered_key_impl<decimal32_t>(key));
+}
+
+BOOST_DECIMAL_EXPORT template <typename T = decimal64_t>
+constexpr auto from_ordered_key(const std::uint64_t key) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, T)
+{
+    return static_cast<T>(detail::from_ordered_key_impl<decimal64_t>(key));
+}
+
+BOOST_DECIMAL_EXPORT template <typename T = decimal128_t>
+constexpr auto from_ordered_key(const int128::uint128_t key) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, T)
+{
+    return static_cast<T>(detail::from_ordered_key_impl<decimal128_t>(key));
+}
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_ORDERED_KEY_HPP
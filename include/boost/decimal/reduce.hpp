@@ -0,0 +1,311 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_REDUCE_HPP
+#define BOOST_DECIMAL_REDUCE_HPP
+
+#include <boost/decimal/decimal_accumulator.hpp>
+#include <boost/decimal/batch.hpp>
+#include <boost/decimal/detail/parallel.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/config.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <vector>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+template <typename DecimalType>
+constexpr auto reduce_chunk(const DecimalType* first, const std::size_t begin, const std::size_t end, decimal_accumulator<DecimalType>& sum) noexcept -> void
+{
+    for (auto i {begin}; i < end; ++i)
+    {
+        sum += first[i];
+    }
+}
+
+template <typename DecimalType, typename UnaryOp>
+constexpr auto transform_reduce_chunk(const DecimalType* first, const std::size_t begin, const std::size_t end,
+                                      decimal_accumulator<DecimalType>& sum, const UnaryOp& op) -> void
+{
+    for (auto i {begin}; i < end; ++i)
+    {
+        sum += op(first[i]);
+    }
+}
+
+// The products are computed a block at a time by the batch kernel
+template <typename DecimalType>
+constexpr auto dot_chunk(const DecimalType* x, const DecimalType* y, const std::size_t begin, const std::size_t end,
+                         decimal_accumulator<DecimalType>& sum) noexcept -> void
+{
+    DecimalType products[batch_block_size] {};
+
+    for (auto i {begin}; i < end; i += batch_block_size)
+    {
+        const auto block_size {end - i < batch_block_size ? end - i : batch_block_size};
+        mul(x + i, y + i, products, block_size);
+
+        for (std::size_t j {}; j < block_size; ++j)
+        {
+            sum += products[j];
+        }
+    }
+}
+
+// Every chunk is summed exactly, and the exact sums are combined before the only rounding.
+// The result is therefore the same for any number of threads
+template <typename DecimalType, typename ChunkFunction>
+auto parallel_reduce_impl(const std::size_t n, std::size_t threads, const ChunkFunction& chunk) -> DecimalType
+{
+    threads = parallel_threads(n, threads);
+
+    std::vector<decimal_accumulator<DecimalType>> sums(threads);
+
+    parallel_for_each_chunk(threads, [&](const std::size_t t)
+    {
+        chunk(parallel_chunk_begin(n, threads, t), parallel_chunk_begin(n, threads, t + 1U), sums[t]);
+    });
+
+    for (std::size_t t {1}; t < threads; ++t)
+    {
+        sums.front() += sums[t];
+    }
+
+    return sums.front().value();
+}
+
+} // namespace detail
+
+// Each function returns the exact result rounded once in the current rounding mode,
+// so it does not depend on the order of the elements or on the number of threads.
+// transform_reduce and dot round each op(x) or x * y on its own as the scalar operators do,
+// and only their sum is exact. The overloads with a number of threads use up to that many,
+// or one per hardware thread when it is 0, and small inputs use fewer threads than requested.
+
+// The sum of the n values
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto reduce(const DecimalType* first, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    decimal_accumulator<DecimalType> sum;
+    detail::reduce_chunk(first, 0U, n, sum);
+
+    return sum.value();
+}
+
+// The sum of op(first[i]), where op returns DecimalType
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename UnaryOp>
+constexpr auto transform_reduce(const DecimalType* first, const std::size_t n, UnaryOp op)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    decimal_accumulator<DecimalType> sum;
+    detail::transform_reduce_chunk(first, 0U, n, sum, op);
+
+    return sum.value();
+}
+
+// The sum of x[i] * y[i]
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto dot(const DecimalType* x, const DecimalType* y, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    decimal_accumulator<DecimalType> sum;
+    detail::dot_chunk(x, y, 0U, n, sum);
+
+    return sum.value();
+}
+
+// The sum of x[i] * x[i]
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto sum_of_squares(const DecimalType* x, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return dot(x, x, n);
+}
+
+#ifndef BOOST_DECIMAL_DISABLE_CLIB
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto reduce(const DecimalType* first, const std::size_t n, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return detail::parallel_reduce_impl<DecimalType>(n, detail::parallel_requested_threads(threads),
+        [first](const std::size_t begin, const std::size_t end, decimal_accumulator<DecimalType>& sum)
+        {
+            detail::reduce_chunk(first, begin, end, sum);
+        });
+}
+
+// op is called concurrently from several threads
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename UnaryOp>
+auto transform_reduce(const DecimalType* first, const std::size_t n, UnaryOp op, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return detail::parallel_reduce_impl<DecimalType>(n, detail::parallel_requested_threads(threads),
+        [first, &op](const std::size_t begin, const std::size_t end, decimal_accumulator<DecimalType>& sum)
+        {
+            detail::transform_reduce_chunk(first, begin, end, sum, op);
+        });
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto dot(const DecimalType* x, const DecimalType* y, const std::size_t n, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return detail::parallel_reduce_impl<DecimalType>(n, detail::parallel_requested_threads(threads),
+        [x, y](const std::size_t begin, const std::size_t end, decimal_accumulator<DecimalType>& sum)
+        {
+            detail::dot_chunk(x, y, begin, end, sum);
+        });
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto sum_of_squares(const DecimalType* x, const std::size_t n, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return dot(x, x, n, threads);
+}
+
+#endif // BOOST_DECIMAL_DISABLE_CLIB
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+// All spans must have the same extent
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto reduce(std::span<const DecimalType> values) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return reduce(values.data(), values.size());
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename UnaryOp>
+constexpr auto transform_reduce(std::span<const DecimalType> values, UnaryOp op)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return transform_reduce(values.data(), values.size(), op);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto dot(std::span<const DecimalType> x, std::span<const detail::type_identity_t<DecimalType>> y) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return dot(x.data(), y.data(), x.size());
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto sum_of_squares(std::span<const DecimalType> x) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return sum_of_squares(x.data(), x.size());
+}
+
+#ifndef BOOST_DECIMAL_DISABLE_CLIB
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto reduce(std::span<const DecimalType> values, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return reduce(values.data(), values.size(), threads);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename UnaryOp>
+auto transform_reduce(std::span<const DecimalType> values, UnaryOp op, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return transform_reduce(values.data(), values.size(), op, threads);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto dot(std::span<const DecimalType> x, std::span<const detail::type_identity_t<DecimalType>> y, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return dot(x.data(), y.data(), x.size(), threads);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto sum_of_squares(std::span<const DecimalType> x, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return sum_of_squares(x.data(), x.size(), threads);
+}
+
+#endif // BOOST_DECIMAL_DISABLE_CLIB
+
+// DecimalType cannot be deduced from a span of non-const values for the overloads above.
+// Taking the extent as well keeps these out of overload resolution when DecimalType is given explicitly for a container
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, std::size_t Extent>
+constexpr auto reduce(std::span<DecimalType, Extent> values) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return reduce(values.data(), values.size());
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, std::size_t Extent, typename UnaryOp>
+constexpr auto transform_reduce(std::span<DecimalType, Extent> values, UnaryOp op)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return transform_reduce(values.data(), values.size(), op);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, std::size_t Extent>
+constexpr auto dot(std::span<DecimalType, Extent> x, std::span<const detail::type_identity_t<DecimalType>> y) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return dot(x.data(), y.data(), x.size());
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, std::size_t Extent>
+constexpr auto sum_of_squares(std::span<DecimalType, Extent> x) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return sum_of_squares(x.data(), x.size());
+}
+
+#ifndef BOOST_DECIMAL_DISABLE_CLIB
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, std::size_t Extent>
+auto reduce(std::span<DecimalType, Extent> values, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return reduce(values.data(), values.size(), threads);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, std::size_t Extent, typename UnaryOp>
+auto transform_reduce(std::span<DecimalType, Extent> values, UnaryOp op, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return transform_reduce(values.data(), values.size(), op, threads);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, std::size_t Extent>
+auto dot(std::span<DecimalType, Extent> x, std::span<const detail::type_identity_t<DecimalType>> y, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return dot(x.data(), y.data(), x.size(), threads);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, std::size_t Extent>
+auto sum_of_squares(std::span<DecimalType, Extent> x, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return sum_of_squares(x.data(), x.size(), threads);
+}
+
+#endif // BOOST_DECIMAL_DISABLE_CLIB
+
+#endif // BOOST_DECIMAL_HAS_STD_SPAN
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_REDUCE_HPP
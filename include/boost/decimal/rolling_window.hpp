@@ -0,0 +1,554 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_ROLLING_WINDOW_HPP
+#define BOOST_DECIMAL_ROLLING_WINDOW_HPP
+
+#include <boost/decimal/decimal_accumulator.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/config.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// The values that can still become the minimum (or maximum) of the window as older values leave it.
+// They are held in the order they were pushed, which is also the order of strictly increasing (decreasing) value,
+// so the extremum is always the front and each value is pushed and removed at most once
+template <typename DecimalType, bool IsMax>
+class rolling_extremum
+{
+private:
+    struct entry
+    {
+        std::uint64_t sequence;
+        DecimalType value;
+    };
+
+    std::vector<entry> queue_;
+    std::size_t head_ {};
+    std::size_t size_ {};
+
+    auto back_index() const noexcept -> std::size_t
+    {
+        const auto index {head_ + size_ - 1U};
+        return index < queue_.size() ? index : index - queue_.size();
+    }
+
+    static auto dominates(const DecimalType newer, const DecimalType older) noexcept -> bool
+    {
+        return IsMax ? !(newer < older) : !(older < newer);
+    }
+
+public:
+    explicit rolling_extremum(const std::size_t capacity) : queue_(capacity) {}
+
+    auto push(const std::uint64_t sequence, const DecimalType val) noexcept -> void
+    {
+        // An older value that is not better than val can no longer be the extremum
+        while (size_ > 0U && dominates(val, queue_[back_index()].value))
+        {
+            --size_;
+        }
+
+        ++size_;
+        queue_[back_index()] = entry {sequence, val};
+    }
+
+    // Removes the value pushed with sequence if it is still held
+    auto evict(const std::uint64_t sequence) noexcept -> void
+    {
+        if (size_ > 0U && queue_[head_].sequence == sequence)
+        {
+            head_ = head_ + 1U < queue_.size() ? head_ + 1U : 0U;
+            --size_;
+        }
+    }
+
+    auto front() const noexcept -> DecimalType
+    {
+        return queue_[head_].value;
+    }
+
+    auto clear() noexcept -> void
+    {
+        head_ = 0U;
+        size_ = 0U;
+    }
+};
+
+// An exact sum that values can also be removed from.
+// The non-finite values are counted instead of being added to the accumulator,
+// since it cannot forget an infinity or a NaN once it has seen one
+template <typename DecimalType>
+class rolling_sum
+{
+private:
+    decimal_accumulator<DecimalType> finite_;
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    std::size_t nan_ {};
+    std::size_t positive_infinity_ {};
+    std::size_t negative_infinity_ {};
+
+    auto count_non_finite(const DecimalType val, const bool remove) noexcept -> bool
+    {
+        if (isfinite(val))
+        {
+            return false;
+        }
+
+        auto& count {isnan(val) ? nan_ : (signbit(val) ? negative_infinity_ : positive_infinity_)};
+        if (remove)
+        {
+            --count;
+        }
+        else
+        {
+            ++count;
+        }
+
+        return true;
+    }
+    #endif
+
+public:
+    auto add(const DecimalType val) noexcept -> void
+    {
+        #ifndef BOOST_DECIMAL_FAST_MATH
+        if (count_non_finite(val, false))
+        {
+            return;
+        }
+        #endif
+
+        finite_ += val;
+    }
+
+    // val must have been added before
+    auto remove(const DecimalType val) noexcept -> void
+    {
+        #ifndef BOOST_DECIMAL_FAST_MATH
+        if (count_non_finite(val, true))
+        {
+            return;
+        }
+        #endif
+
+        finite_ -= val;
+    }
+
+    auto value() const noexcept -> DecimalType
+    {
+        #ifndef BOOST_DECIMAL_FAST_MATH
+        if (nan_ > 0U || (positive_infinity_ > 0U && negative_infinity_ > 0U))
+        {
+            return std::numeric_limits<DecimalType>::quiet_NaN();
+        }
+        if (positive_infinity_ > 0U)
+        {
+            return std::numeric_limits<DecimalType>::infinity();
+        }
+        if (negative_infinity_ > 0U)
+        {
+            return -std::numeric_limits<DecimalType>::infinity();
+        }
+        #endif
+
+        return finite_.value();
+    }
+
+    // Whether every value that was added is finite
+    auto finite() const noexcept -> bool
+    {
+        #ifndef BOOST_DECIMAL_FAST_MATH
+        return nan_ == 0U && positive_infinity_ == 0U && negative_infinity_ == 0U;
+        #else
+        return true;
+        #endif
+    }
+
+    // The exact sum of the finite values
+    auto finite_sum() const noexcept -> const decimal_accumulator<DecimalType>&
+    {
+        return finite_;
+    }
+};
+
+// The exact sum of the squares of finite values, from which the variance is formed with the exact sum of the values.
+// Limb i has the weight 10^(9 * i + 2 * min_exp), where min_exp is that of decimal_accumulator,
+// so the limbs of the square of that sum line up with these. Non-finite values are ignored,
+// since the rolling_sum of the values already accounts for them
+template <typename DecimalType>
+class square_accumulator
+{
+private:
+    using traits = accumulator_traits<DecimalType>;
+
+    static constexpr std::size_t limb_count {static_cast<std::size_t>((2 * (traits::max_exp - traits::min_exp + traits::precision) + accumulator_limb_digits - 1) / accumulator_limb_digits + 2)};
+
+    std::vector<std::int64_t> limbs_;
+    std::size_t lowest_ {limb_count};
+    std::size_t highest_ {};
+    std::uint32_t pending_ {};
+
+    // Adds sig * 10^pos in pieces of at most 18 digits
+    auto add_wide(int128::uint128_t sig, std::size_t pos, const bool is_neg) noexcept -> void
+    {
+        constexpr auto piece {pow10(int128::uint128_t{18U})};
+
+        for (; sig != 0U; sig /= piece, pos += 18U)
+        {
+            if (BOOST_DECIMAL_UNLIKELY(pending_ >= accumulator_max_pending))
+            {
+                accumulator_propagate(limbs_.data(), limb_count, lowest_, highest_);
+                pending_ = 0U;
+            }
+
+            ++pending_;
+            accumulator_add(limbs_.data(), lowest_, highest_, static_cast<std::uint64_t>(sig % piece), pos, is_neg);
+        }
+    }
+
+public:
+    square_accumulator() : limbs_(limb_count) {}
+
+    // Adds val * val exactly, or subtracts it again
+    auto add(const DecimalType val, const bool subtract) noexcept -> void
+    {
+        #ifndef BOOST_DECIMAL_FAST_MATH
+        if (!isfinite(val))
+        {
+            return;
+        }
+        #endif
+
+        int exp {};
+        const int128::uint128_t sig {frexp10(val, &exp)};
+        const auto pos {static_cast<std::size_t>(2 * (exp - traits::min_exp))};
+
+        BOOST_DECIMAL_IF_CONSTEXPR (traits::precision <= 19)
+        {
+            add_wide(sig * sig, pos, subtract);
+        }
+        else
+        {
+            // The square of 34 digits does not fit, so it is formed from the squares and the product of the two halves
+            constexpr auto half {pow10(int128::uint128_t{17U})};
+            const auto high {sig / half};
+            const auto low {sig % half};
+
+            add_wide(low * low, pos, subtract);
+            add_wide(2U * high * low, pos + 17U, subtract);
+            add_wide(high * high, pos + 34U, subtract);
+        }
+    }
+
+    auto clear() noexcept -> void
+    {
+        for (auto i {lowest_}; i <= highest_ && i < limb_count; ++i)
+        {
+            limbs_[i] = 0;
+        }
+
+        lowest_ = limb_count;
+        highest_ = 0U;
+        pending_ = 0U;
+    }
+
+    // The population variance (n * sum of squares - sum^2) / n^2 of the n values whose exact sum is sum, rounded once.
+    // The numerator is formed exactly one limb at a time, and only the limbs that decide the rounding are kept
+    auto variance(const decimal_accumulator<DecimalType>& sum, const std::size_t n) const noexcept -> DecimalType;
+};
+
+template <typename DecimalType>
+auto square_accumulator<DecimalType>::variance(const decimal_accumulator<DecimalType>& sum, const std::size_t n) const noexcept -> DecimalType
+{
+    constexpr auto base {accumulator_limb_base};
+
+    // n^2 and the remainders of the division by it fit in 128 bits
+    BOOST_DECIMAL_ASSERT(n > 0U && n <= UINT32_MAX);
+
+    // Carrying towards zero leaves every limb of the sum in (-10^9, 10^9),
+    // so the products of two of them and their sums over a limb are exact in 128 bits
+    std::vector<std::int64_t> sum_limbs;
+    std::size_t sum_lowest {};
+
+    if (sum.lowest_ <= sum.highest_)
+    {
+        sum_lowest = sum.lowest_;
+
+        std::int64_t carry {};
+        for (auto i {sum.lowest_}; i <= sum.highest_ || carry != 0; ++i)
+        {
+            auto limb {(i < traits::limbs ? sum.limbs_[i] : 0) + carry};
+            carry = limb / base;
+            limb -= carry * base;
+            sum_limbs.push_back(limb);
+        }
+    }
+
+    const auto sum_count {sum_limbs.size()};
+    const auto square_lowest {2U * sum_lowest};
+    const auto square_highest {sum_count > 0U ? square_lowest + 2U * (sum_count - 1U) : 0U};
+
+    std::size_t first {lowest_ <= highest_ ? lowest_ : limb_count};
+    std::size_t last {lowest_ <= highest_ ? highest_ : 0U};
+    if (sum_count > 0U)
+    {
+        first = square_lowest < first ? square_lowest : first;
+        last = square_highest > last ? square_highest : last;
+    }
+
+    if (first > last)
+    {
+        return DecimalType{0};
+    }
+
+    // The carries out of the last limbs are at most about 10^12, so they are gone within a few more limbs
+    constexpr std::size_t carry_limbs {6U};
+
+    // Enough limbs that the quotient by n^2 < 10^20 still has more than precision + 1 digits
+    constexpr auto window_limbs {static_cast<std::size_t>(traits::precision / accumulator_limb_digits + 6)};
+    std::int64_t window[window_limbs] {};
+    auto window_top {first};
+    bool below_window {};
+    bool nonzero {};
+
+    const int128::int128_t count {static_cast<std::int64_t>(n)};
+    std::int64_t square_carry {};
+    int128::int128_t carry {};
+
+    for (auto k {first}; k <= last + carry_limbs; ++k)
+    {
+        // The limbs of the sum of squares are carried towards zero as well, so that n times one of them is exact
+        auto square {(k < limb_count ? limbs_[k] : 0) + square_carry};
+        square_carry = square / base;
+        square -= square_carry * base;
+
+        int128::int128_t sum_squared {};
+        if (sum_count > 0U && k >= square_lowest && k <= square_highest)
+        {
+            const auto offset {k - square_lowest};
+            const auto low {offset >= sum_count ? offset - (sum_count - 1U) : 0U};
+            const auto high {offset < sum_count ? offset : sum_count - 1U};
+
+            for (auto i {low}; i <= high; ++i)
+            {
+                sum_squared += int128::int128_t{sum_limbs[i]} * int128::int128_t{sum_limbs[offset - i]};
+            }
+        }
+
+        // The numerator is never negative, so carrying with floor division leaves every limb in [0, 10^9)
+        auto limb {count * int128::int128_t{square} - sum_squared + carry};
+        carry = limb / base;
+        limb -= carry * base;
+        if (limb < 0)
+        {
+            limb += base;
+            --carry;
+        }
+
+        if (limb != 0)
+        {
+            accumulator_window_push(window, window_top, below_window, k, static_cast<std::int64_t>(limb));
+            nonzero = true;
+        }
+    }
+
+    BOOST_DECIMAL_ASSERT(carry == 0 && square_carry == 0);
+
+    if (!nonzero)
+    {
+        return DecimalType{0};
+    }
+
+    // Divide the kept limbs by n^2. The remainder and the limbs below the window only decide the sticky bit
+    const auto divisor {static_cast<int128::uint128_t>(n) * n};
+    int128::uint128_t remainder {};
+
+    for (auto k {window_limbs}; k-- > 0U;)
+    {
+        const auto current {remainder * static_cast<std::uint64_t>(base) + static_cast<std::uint64_t>(window[k])};
+        window[k] = static_cast<std::int64_t>(current / divisor);
+        remainder = current % divisor;
+    }
+
+    auto quotient_limbs {window_limbs};
+    while (window[quotient_limbs - 1U] == 0)
+    {
+        --quotient_limbs;
+    }
+
+    const auto window_exp {2 * traits::min_exp + (static_cast<int>(window_top) - static_cast<int>(window_limbs - 1U)) * accumulator_limb_digits};
+    return accumulator_round<DecimalType>(window, quotient_limbs, window_exp, below_window || remainder != 0U, false);
+}
+
+} // namespace detail
+
+// Statistics of the most recent window_size values of a stream, updated in amortized O(1) per value.
+// The sums are held exactly, so removing the oldest value undoes its addition exactly,
+// and the statistics never drift however long the stream is.
+// Infinities and NaNs only affect the statistics while they are in the window
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+class rolling_window
+{
+public:
+    static_assert(detail::is_decimal_floating_point_v<DecimalType>, "rolling_window requires a decimal floating point type");
+
+    using value_type = DecimalType;
+    using size_type = std::size_t;
+
+private:
+    // The product is stored as well, so that exactly the term that was added is subtracted again
+    struct entry
+    {
+        DecimalType value;
+        DecimalType weight;
+        DecimalType weighted;
+    };
+
+    std::vector<entry> entries_;
+    std::uint64_t count_ {};
+
+    detail::rolling_sum<DecimalType> sum_;
+    detail::square_accumulator<DecimalType> squares_;
+    detail::rolling_sum<DecimalType> sum_of_weights_;
+    detail::rolling_sum<DecimalType> weighted_sum_;
+
+    detail::rolling_extremum<DecimalType, false> min_;
+    detail::rolling_extremum<DecimalType, true> max_;
+
+public:
+    // window_size must not be 0
+    explicit rolling_window(const size_type window_size) : entries_(window_size), min_ {window_size}, max_ {window_size}
+    {
+        BOOST_DECIMAL_ASSERT(window_size > 0U);
+    }
+
+    auto window_size() const noexcept -> size_type
+    {
+        return entries_.size();
+    }
+
+    // The number of values in the window, which is window_size() once that many have been pushed
+    auto size() const noexcept -> size_type
+    {
+        return count_ < entries_.size() ? static_cast<size_type>(count_) : entries_.size();
+    }
+
+    auto empty() const noexcept -> bool
+    {
+        return count_ == 0U;
+    }
+
+    auto full() const noexcept -> bool
+    {
+        return count_ >= entries_.size();
+    }
+
+    // Adds val with weight 1, and removes the oldest value once the window is full
+    auto push(const DecimalType val) noexcept -> void
+    {
+        push(val, DecimalType{1});
+    }
+
+    // Adds val with the given weight, e.g. a price with its traded volume
+    auto push(const DecimalType val, const DecimalType weight) noexcept -> void
+    {
+        const auto index {static_cast<size_type>(count_ % entries_.size())};
+        auto& slot {entries_[index]};
+
+        if (full())
+        {
+            const auto oldest {count_ - entries_.size()};
+            min_.evict(oldest);
+            max_.evict(oldest);
+
+            sum_.remove(slot.value);
+            squares_.add(slot.value, true);
+            sum_of_weights_.remove(slot.weight);
+            weighted_sum_.remove(slot.weighted);
+        }
+
+        slot = entry {val, weight, val * weight};
+
+        sum_.add(slot.value);
+        squares_.add(slot.value, false);
+        sum_of_weights_.add(slot.weight);
+        weighted_sum_.add(slot.weighted);
+
+        min_.push(count_, val);
+        max_.push(count_, val);
+
+        ++count_;
+    }
+
+    auto clear() noexcept -> void
+    {
+        count_ = 0U;
+        sum_ = detail::rolling_sum<DecimalType> {};
+        squares_.clear();
+        sum_of_weights_ = detail::rolling_sum<DecimalType> {};
+        weighted_sum_ = detail::rolling_sum<DecimalType> {};
+        min_.clear();
+        max_.clear();
+    }
+
+    // The exact sum of the values in the window rounded once
+    auto sum() const noexcept -> DecimalType
+    {
+        return sum_.value();
+    }
+
+    auto mean() const noexcept -> DecimalType
+    {
+        return sum_.value() / DecimalType{size()};
+    }
+
+    // The window must not be empty
+    auto min() const noexcept -> DecimalType
+    {
+        BOOST_DECIMAL_ASSERT(!empty());
+        return min_.front();
+    }
+
+    // The window must not be empty
+    auto max() const noexcept -> DecimalType
+    {
+        BOOST_DECIMAL_ASSERT(!empty());
+        return max_.front();
+    }
+
+    // The population variance (n * sum of squares - sum^2) / n^2, formed from the exact sums
+    // of the values and of their exact squares and rounded once
+    auto variance() const noexcept -> DecimalType
+    {
+        if (empty() || !sum_.finite())
+        {
+            return std::numeric_limits<DecimalType>::quiet_NaN();
+        }
+
+        return squares_.variance(sum_.finite_sum(), size());
+    }
+
+    // The mean of the values weighted by their weights, i.e. the volume weighted average price
+    auto vwap() const noexcept -> DecimalType
+    {
+        return weighted_sum_.value() / sum_of_weights_.value();
+    }
+};
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_ROLLING_WINDOW_HPP
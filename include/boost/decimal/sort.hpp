@@ -0,0 +1,248 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_SORT_HPP
+#define BOOST_DECIMAL_SORT_HPP
+
+#include <boost/decimal/ordered_key.hpp>
+#include <boost/decimal/detail/parallel.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// Each pass of the radix sort distributes the elements by one byte of their key
+BOOST_DECIMAL_CONSTEXPR_VARIABLE std::size_t radix_sort_buckets {256U};
+
+// Below this the histograms cost more than an insertion sort of the keys
+BOOST_DECIMAL_CONSTEXPR_VARIABLE std::size_t radix_sort_min_size {64U};
+
+using radix_sort_histogram = std::array<std::size_t, radix_sort_buckets>;
+
+template <typename KeyType, typename DecimalType>
+struct radix_sort_item
+{
+    KeyType key;
+    DecimalType value;
+};
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto radix_sort_digit(const std::uint32_t key, const std::size_t pass) noexcept -> std::size_t
+{
+    return static_cast<std::size_t>((key >> (8U * pass)) & 0xFFU);
+}
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto radix_sort_digit(const std::uint64_t key, const std::size_t pass) noexcept -> std::size_t
+{
+    return static_cast<std::size_t>((key >> (8U * pass)) & 0xFFU);
+}
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto radix_sort_digit(const int128::uint128_t& key, const std::size_t pass) noexcept -> std::size_t
+{
+    return pass < 8U ? radix_sort_digit(key.low, pass) : radix_sort_digit(key.high, pass - 8U);
+}
+
+// Stable LSD radix sort of the order-preserving keys.
+// Every value is converted to its key exactly once, and the passes then only move (key, value) pairs.
+// Bytes that are the same in every key (e.g. the sign and exponent of prices of similar magnitude) are skipped.
+//
+// With several threads each one owns a contiguous chunk of the source of every pass.
+// The chunks are scattered to offsets computed from the histograms of all of them,
+// with lower chunks first in each bucket, so the result does not depend on the number of threads.
+template <typename DecimalType>
+auto radix_sort_impl(DecimalType* first, const std::size_t n, std::size_t threads) -> void
+{
+    using key_type = decltype(to_ordered_key(std::declval<DecimalType>()));
+    using item_type = radix_sort_item<key_type, DecimalType>;
+
+    constexpr std::size_t passes {sizeof(key_type)};
+
+    if (n < 2U)
+    {
+        return;
+    }
+
+    std::unique_ptr<item_type[]> items {new item_type[n]};
+
+    if (n < radix_sort_min_size)
+    {
+        // Only moves past strictly greater keys, so it is stable as well
+        for (std::size_t i {}; i < n; ++i)
+        {
+            const item_type item {to_ordered_key(first[i]), first[i]};
+
+            auto j {i};
+            for (; j > 0U && item.key < items[j - 1U].key; --j)
+            {
+                items[j] = items[j - 1U];
+            }
+
+            items[j] = item;
+        }
+
+        for (std::size_t i {}; i < n; ++i)
+        {
+            first[i] = items[i].value;
+        }
+
+        return;
+    }
+
+    threads = parallel_threads(n, threads);
+
+    std::unique_ptr<item_type[]> buffer {new item_type[n]};
+
+    // counts[t * passes + p] is the histogram of byte p of the keys in chunk t
+    std::vector<radix_sort_histogram> counts(threads * passes, radix_sort_histogram{});
+
+    const auto chunk_begin = [n, threads](const std::size_t t) { return parallel_chunk_begin(n, threads, t); };
+
+    parallel_for_each_chunk(threads, [&](const std::size_t t)
+    {
+        auto* histograms {counts.data() + t * passes};
+
+        for (std::size_t i {chunk_begin(t)}; i < chunk_begin(t + 1U); ++i)
+        {
+            const auto key {to_ordered_key(first[i])};
+            items[i] = item_type{key, first[i]};
+
+            for (std::size_t p {}; p < passes; ++p)
+            {
+                ++histograms[p][radix_sort_digit(key, p)];
+            }
+        }
+    });
+
+    auto* src {items.get()};
+    auto* dst {buffer.get()};
+    bool chunks_moved {false};
+
+    std::vector<radix_sort_histogram> offsets(threads);
+
+    for (std::size_t p {}; p < passes; ++p)
+    {
+        // The totals do not depend on the order of the elements, so the ones counted up front stay valid
+        std::size_t digit_total {};
+        const auto first_digit {radix_sort_digit(src[0].key, p)};
+        for (std::size_t t {}; t < threads; ++t)
+        {
+            digit_total += counts[t * passes + p][first_digit];
+        }
+
+        if (digit_total == n)
+        {
+            continue;
+        }
+
+        // The chunks hold different elements after a pass, so their own histograms have to be counted again
+        if (chunks_moved && threads > 1U)
+        {
+            parallel_for_each_chunk(threads, [&](const std::size_t t)
+            {
+                auto& histogram {counts[t * passes + p]};
+                histogram.fill(0U);
+
+                for (std::size_t i {chunk_begin(t)}; i < chunk_begin(t + 1U); ++i)
+                {
+                    ++histogram[radix_sort_digit(src[i].key, p)];
+                }
+            });
+        }
+
+        std::size_t running {};
+        for (std::size_t digit {}; digit < radix_sort_buckets; ++digit)
+        {
+            for (std::size_t t {}; t < threads; ++t)
+            {
+                offsets[t][digit] = running;
+                running += counts[t * passes + p][digit];
+            }
+        }
+
+        parallel_for_each_chunk(threads, [&](const std::size_t t)
+        {
+            auto& offset {offsets[t]};
+
+            for (std::size_t i {chunk_begin(t)}; i < chunk_begin(t + 1U); ++i)
+            {
+                dst[offset[radix_sort_digit(src[i].key, p)]++] = src[i];
+            }
+        });
+
+        std::swap(src, dst);
+        chunks_moved = true;
+    }
+
+    parallel_for_each_chunk(threads, [&](const std::size_t t)
+    {
+        for (std::size_t i {chunk_begin(t)}; i < chunk_begin(t + 1U); ++i)
+        {
+            first[i] = src[i].value;
+        }
+    });
+}
+
+} // namespace detail
+
+// Sorts n contiguous values into ascending order with a radix sort of their ordered keys (see ordered_key.hpp).
+// The sort is stable, and orders -0 before +0 and NaNs beyond the infinity of the same sign.
+// Needs temporary storage for two copies of the values together with their keys
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto sort(DecimalType* first, const std::size_t n)
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    detail::radix_sort_impl(first, n, 1U);
+}
+
+#ifndef BOOST_DECIMAL_DISABLE_CLIB
+
+// As above, using up to the given number of threads, or one per hardware thread when it is 0.
+// Small inputs use fewer threads than requested. The result is the same for any number of threads
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto sort(DecimalType* first, const std::size_t n, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    detail::radix_sort_impl(first, n, detail::parallel_requested_threads(threads));
+}
+
+#endif // BOOST_DECIMAL_DISABLE_CLIB
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto sort(std::span<DecimalType> values)
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    sort(values.data(), values.size());
+}
+
+#ifndef BOOST_DECIMAL_DISABLE_CLIB
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto sort(std::span<DecimalType> values, const unsigned threads)
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    sort(values.data(), values.size(), threads);
+}
+
+#endif // BOOST_DECIMAL_DISABLE_CLIB
+
+#endif // BOOST_DECIMAL_HAS_STD_SPAN
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_SORT_HPP
@@ -31,6 +31,8 @@ module;
 #include <compare>
 #include <charconv>
 #include <string_view>
+#include <span>
+#include <vector>
 
 // <stdfloat> is a C++23 feature that is not everywhere yet
 #if __has_include(<stdfloat>)
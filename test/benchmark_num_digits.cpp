@@ -0,0 +1,127 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <iostream>
+
+#ifdef BOOST_DECIMAL_RUN_BENCHMARKS
+
+#include <boost/decimal/detail/u256.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iomanip>
+#include <cstdint>
+
+constexpr std::size_t N = 20'000'000;
+constexpr std::size_t K = 5;
+
+using namespace boost::decimal;
+
+#ifdef __clang__
+#  define BOOST_DECIMAL_NO_INLINE __attribute__ ((__noinline__))
+#elif defined(_MSC_VER)
+#  define BOOST_DECIMAL_NO_INLINE __declspec(noinline)
+#elif defined(__GNUC__)
+#  define BOOST_DECIMAL_NO_INLINE __attribute__ ((__noinline__))
+#endif
+
+// Each word is shifted right by a random amount so that every digit count of the width is exercised,
+// rather than nearly all values having the maximum number of digits
+template <typename T>
+T random_value(std::mt19937_64& gen);
+
+template <>
+std::uint32_t random_value<std::uint32_t>(std::mt19937_64& gen)
+{
+    return static_cast<std::uint32_t>(gen() >> (32U + gen() % 32U));
+}
+
+template <>
+std::uint64_t random_value<std::uint64_t>(std::mt19937_64& gen)
+{
+    return gen() >> (gen() % 64U);
+}
+
+template <>
+boost::int128::uint128_t random_value<boost::int128::uint128_t>(std::mt19937_64& gen)
+{
+    const auto high {gen() % 2U == 0U ? gen() >> (gen() % 64U) : UINT64_C(0)};
+    return boost::int128::uint128_t{high, gen() >> (gen() % 64U)};
+}
+
+template <>
+detail::u256 random_value<detail::u256>(std::mt19937_64& gen)
+{
+    detail::u256 result {};
+    const auto words {static_cast<std::size_t>(gen() % 4U) + 1U};
+    for (std::size_t i {}; i < words; ++i)
+    {
+        result[i] = gen();
+    }
+    result[words - 1U] >>= gen() % 64U;
+
+    return result;
+}
+
+template <typename T>
+std::vector<T> generate_random_vector(std::size_t size = N, unsigned seed = 42U)
+{
+    std::mt19937_64 gen(seed);
+
+    std::vector<T> result(size);
+    for (auto& val : result)
+    {
+        val = random_value<T>(gen);
+    }
+
+    return result;
+}
+
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_num_digits(const std::vector<T>& data_vec, const char* label)
+{
+    const auto t1 = std::chrono::steady_clock::now();
+    std::size_t s = 0; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        for (const auto& val : data_vec)
+        {
+            s += static_cast<std::size_t>(detail::num_digits(val));
+        }
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    const std::chrono::duration<double> elapsed {t2 - t1};
+    const auto rate {static_cast<double>(K * data_vec.size()) / elapsed.count()};
+
+    std::cout << "num_digits<" << std::left << std::setw(8) << label << ">: "
+              << std::setw(10) << std::fixed << std::setprecision(1) << rate / 1e6 << " M digits/sec (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << "\n---------------------------\n";
+    std::cout << "Digit Counting\n";
+    std::cout << "---------------------------\n\n";
+
+    test_num_digits(generate_random_vector<std::uint32_t>(), "32");
+    test_num_digits(generate_random_vector<std::uint64_t>(), "64");
+    test_num_digits(generate_random_vector<boost::int128::uint128_t>(), "128");
+    test_num_digits(generate_random_vector<detail::u256>(), "256");
+
+    return 1;
+}
+
+#else
+
+int main()
+{
+    std::cerr << "Benchmarks not run" << std::endl;
+    return 1;
+}
+
+#endif // BOOST_DECIMAL_RUN_BENCHMARKS
@@ -61,7 +61,7 @@ std::vector<detail::u256> generate_random_vector_new(std::size_t size = N, unsig
     for (std::size_t i = 0; i < size; ++i)
     {
         auto current_words = words;
-        BOOST_INT128_IF_CONSTEXPR (words == 5)
+        BOOST_DECIMAL_IF_CONSTEXPR (words == 5)
         {
             // Alternating 4/2
             current_words = i % 2 == 0 ? 4 : 2;
@@ -206,7 +206,7 @@ BOOST_DECIMAL_NO_INLINE void test_umul256(const std::vector<T>& data_vec, const
 }
 
 template <typename T>
-BOOST_DECIMAL_NO_INLINE void test_umul256_new(const std::vector<T>& data_vec, const char* label)
+BOOST_DECIMAL_NO_INLINE void test_mul_uint128(const std::vector<T>& data_vec, const char* label)
 {
     const auto t1 = std::chrono::steady_clock::now();
     std::size_t s = 0; // discard variable
@@ -215,15 +215,15 @@ BOOST_DECIMAL_NO_INLINE void test_umul256_new(const std::vector<T>& data_vec, co
     {
         for (std::size_t i {}; i < data_vec.size() - 1U; ++i)
         {
-            const auto val1 = static_cast<boost::int128::uint128_t>(data_vec[i]);
+            const auto val1 = data_vec[i];
             const auto val2 = static_cast<boost::int128::uint128_t>(data_vec[i + 1]);
-            s += static_cast<std::size_t>(boost::decimal::detail::umul256_new(val1, val2));
+            s += static_cast<std::size_t>(val1 * val2);
         }
     }
 
     const auto t2 = std::chrono::steady_clock::now();
 
-    std::cout << "umul<" << std::left << std::setw(11) << label << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+    std::cout << "mul128<" << std::left << std::setw(11) << label << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
 }
 
 int main()
@@ -246,6 +246,10 @@ int main()
 
         std::cout << std::endl;
 
+        test_two_element_operation(new_vector, std::multiplies<>(), "mul", "New");
+
+        std::cout << std::endl;
+
         test_two_element_operation(new_vector, std::divides<>(), "div", "New");
 
         std::cout << std::endl;
@@ -268,6 +272,10 @@ int main()
 
         std::cout << std::endl;
 
+        test_two_element_operation(new_vector, std::multiplies<>(), "mul", "New");
+
+        std::cout << std::endl;
+
         test_two_element_operation(new_vector, std::divides<>(), "div", "New");
 
         std::cout << std::endl;
@@ -276,7 +284,7 @@ int main()
 
         std::cout << std::endl;
 
-        test_umul256_new(new_vector, "new");
+        test_umul256(new_vector, "new");
     }
 
     // 4 x 2 word operations
@@ -291,10 +299,18 @@ int main()
 
         std::cout << std::endl;
 
+        test_mul_uint128(new_vector, "new");
+
+        std::cout << std::endl;
+
         test_two_element_operation(new_vector, std::plus<>(), "add", "New");
 
         std::cout << std::endl;
 
+        test_two_element_operation(new_vector, std::multiplies<>(), "mul", "New");
+
+        std::cout << std::endl;
+
         test_two_element_operation(new_vector, std::divides<>(), "div", "New");
 
         std::cout << std::endl;
@@ -7,6 +7,9 @@
 #define BOOST_DECIMAL_DETAIL_INT128_ALLOW_SIGN_COMPARE
 
 #include <boost/decimal.hpp>
+#include <boost/decimal/batch.hpp>
+#include <boost/decimal/decimal_column.hpp>
+#include <algorithm>
 #include <chrono>
 #include <random>
 #include <vector>
@@ -16,6 +19,8 @@
 #include <string>
 #include <cmath>
 #include <cstring>
+#include <fstream>
+#include <sstream>
 
 #if defined(__clang__)
 #  pragma clang diagnostic push
@@ -42,6 +47,8 @@
 
 #ifdef BOOST_DECIMAL_RUN_BENCHMARKS
 
+#include "../examples/where_file.hpp"
+
 #if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
 #if __has_include(<charconv>)
 #  include <charconv>
@@ -198,6 +205,357 @@ BOOST_DECIMAL_NO_INLINE void test_one_element_operation(const std::vector<T>& da
     std::cerr << operation << "<" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
 }
 
+template <typename T, typename ScalarFunc, typename BatchFunc>
+BOOST_DECIMAL_NO_INLINE void test_batch_operation(const std::vector<T>& data_vec, ScalarFunc scalar_op, BatchFunc batch_op, const char* operation, const char* type)
+{
+    const auto size {data_vec.size() - 1U};
+    std::vector<T> res(size);
+
+    const auto t1 = std::chrono::steady_clock::now();
+    std::size_t s = 0; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        for (std::size_t i {}; i < size; ++i)
+        {
+            res[i] = scalar_op(data_vec[i], data_vec[i + 1]);
+        }
+        s += static_cast<std::size_t>(res[k] > res[size - 1U]);
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        batch_op(data_vec.data(), data_vec.data() + 1, res.data(), size);
+        s += static_cast<std::size_t>(res[k] > res[size - 1U]);
+    }
+
+    const auto t3 = std::chrono::steady_clock::now();
+
+    std::cerr << operation << "<" << std::left << std::setw(13) << type << ">: scalar " << std::setw( 10 ) << ( t2 - t1 ) / 1us
+              << " us, batch " << std::setw( 10 ) << ( t3 - t2 ) / 1us << " us (s=" << s << ")\n";
+}
+
+template <typename T, typename ScalarFunc, typename ColumnFunc>
+BOOST_DECIMAL_NO_INLINE void test_column_operation(const std::vector<T>& data_vec, ScalarFunc scalar_op, ColumnFunc column_op, const char* operation, const char* type)
+{
+    const auto size {data_vec.size() - 1U};
+    std::vector<T> res(size);
+
+    const decimal_column<T> lhs_column(data_vec.begin(), data_vec.end() - 1);
+    const decimal_column<T> rhs_column(data_vec.begin() + 1, data_vec.end());
+    decimal_column<T> res_column;
+
+    const auto t1 = std::chrono::steady_clock::now();
+    std::size_t s = 0; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        for (std::size_t i {}; i < size; ++i)
+        {
+            res[i] = scalar_op(data_vec[i], data_vec[i + 1]);
+        }
+        s += static_cast<std::size_t>(res[k] > res[size - 1U]);
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        column_op(lhs_column, rhs_column, res_column);
+        s += static_cast<std::size_t>(res_column[k] > res_column[size - 1U]);
+    }
+
+    const auto t3 = std::chrono::steady_clock::now();
+
+    std::cerr << operation << "<" << std::left << std::setw(13) << type << ">: vector " << std::setw( 10 ) << ( t2 - t1 ) / 1us
+              << " us, column " << std::setw( 10 ) << ( t3 - t2 ) / 1us << " us (s=" << s << ")\n";
+}
+
+// A scan that only needs the signs reads one byte per value from the column instead of the whole value
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_column_sign_scan(const std::vector<T>& data_vec, const char* type)
+{
+    const decimal_column<T> column(data_vec.begin(), data_vec.end());
+
+    const auto t1 = std::chrono::steady_clock::now();
+    std::size_t s = 0; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        s += static_cast<std::size_t>(std::count_if(data_vec.begin(), data_vec.end(), [](const T& val) { return signbit(val); }));
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        s += static_cast<std::size_t>(std::count(column.sign_data(), column.sign_data() + column.size(), 1U));
+    }
+
+    const auto t3 = std::chrono::steady_clock::now();
+
+    std::cerr << "Count Negative<" << std::left << std::setw(13) << type << ">: vector " << std::setw( 10 ) << ( t2 - t1 ) / 1us
+              << " us, column " << std::setw( 10 ) << ( t3 - t2 ) / 1us << " us (s=" << s << ")\n";
+}
+
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_sort(const std::vector<T>& data_vec, const char* type)
+{
+    std::size_t s = 0; // discard variable
+    auto sorted {data_vec};
+
+    const auto t1 = std::chrono::steady_clock::now();
+
+    std::sort(sorted.begin(), sorted.end());
+    s += static_cast<std::size_t>(sorted.front() < sorted.back());
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    sorted = data_vec;
+    const auto t3 = std::chrono::steady_clock::now();
+
+    boost::decimal::sort(sorted.data(), sorted.size());
+    s += static_cast<std::size_t>(sorted.front() < sorted.back());
+
+    const auto t4 = std::chrono::steady_clock::now();
+
+    sorted = data_vec;
+    const auto t5 = std::chrono::steady_clock::now();
+
+    boost::decimal::sort(sorted.data(), sorted.size(), 0U);
+    s += static_cast<std::size_t>(sorted.front() < sorted.back());
+
+    const auto t6 = std::chrono::steady_clock::now();
+
+    std::cerr << "Sort<" << std::left << std::setw(13) << type << ">: std::sort " << std::setw( 10 ) << ( t2 - t1 ) / 1us
+              << " us, radix " << std::setw( 10 ) << ( t4 - t3 ) / 1us
+              << " us, parallel radix " << std::setw( 10 ) << ( t6 - t5 ) / 1us << " us (s=" << s << ")\n";
+}
+
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_reduce(const std::vector<T>& data_vec, const char* type)
+{
+    const auto t1 = std::chrono::steady_clock::now();
+
+    T naive {0};
+    for (std::size_t k {}; k < K; ++k)
+    {
+        for (const auto& val : data_vec)
+        {
+            naive += val;
+        }
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    T exact {0};
+    for (std::size_t k {}; k < K; ++k)
+    {
+        exact += boost::decimal::reduce(data_vec.data(), data_vec.size());
+    }
+
+    const auto t3 = std::chrono::steady_clock::now();
+
+    T parallel {0};
+    for (std::size_t k {}; k < K; ++k)
+    {
+        parallel += boost::decimal::reduce(data_vec.data(), data_vec.size(), 0U);
+    }
+
+    const auto t4 = std::chrono::steady_clock::now();
+
+    const auto s {static_cast<std::size_t>(naive == exact) + static_cast<std::size_t>(exact == parallel)};
+
+    std::cerr << "Reduce<" << std::left << std::setw(11) << type << ">: loop " << std::setw( 10 ) << ( t2 - t1 ) / 1us
+              << " us, exact " << std::setw( 10 ) << ( t3 - t2 ) / 1us
+              << " us, parallel exact " << std::setw( 10 ) << ( t4 - t3 ) / 1us << " us (s=" << s << ")\n";
+}
+
+// Bulk DPD encoding and decoding in declets per second, with the bulk BID conversions of the same data for reference
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_interchange(const std::vector<T>& data_vec, const char* type)
+{
+    using bits_type = boost::decimal::detail::interchange_bits_t<T>;
+
+    const auto n {data_vec.size()};
+    std::vector<bits_type> bits(n);
+    std::vector<T> values(n);
+    std::size_t s = 0; // discard variable
+
+    const auto t1 = std::chrono::steady_clock::now();
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        to_dpd(data_vec.data(), bits.data(), n);
+        s += static_cast<std::size_t>(bits[k] & 1U);
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        from_dpd(bits.data(), values.data(), n);
+        s += static_cast<std::size_t>(values[k] == data_vec[k]);
+    }
+
+    const auto t3 = std::chrono::steady_clock::now();
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        to_bid(data_vec.data(), bits.data(), n);
+        s += static_cast<std::size_t>(bits[k] & 1U);
+    }
+
+    const auto t4 = std::chrono::steady_clock::now();
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        from_bid(bits.data(), values.data(), n);
+        s += static_cast<std::size_t>(values[k] == data_vec[k]);
+    }
+
+    const auto t5 = std::chrono::steady_clock::now();
+
+    // 7, 16 and 34 digits are the leading digit followed by 2, 5 and 11 declets
+    const auto declets {static_cast<double>(K * n * static_cast<std::size_t>(std::numeric_limits<T>::digits10 / 3))};
+    const auto declet_rate = [declets](const auto& duration) { return declets / std::chrono::duration<double>(duration).count() / 1e6; };
+
+    std::cerr << "Interchange<" << std::left << std::setw(13) << type << ">: to_dpd " << std::setw( 8 ) << declet_rate(t2 - t1)
+              << " M declets/s, from_dpd " << std::setw( 8 ) << declet_rate(t3 - t2)
+              << " M declets/s, to_bid " << std::setw( 10 ) << ( t4 - t3 ) / 1us
+              << " us, from_bid " << std::setw( 10 ) << ( t5 - t4 ) / 1us << " us (s=" << s << ")\n";
+}
+
+// The closing prices of examples/AAPL.csv, which is also used by examples/moving_average.cpp
+static auto load_closing_prices() -> std::vector<decimal64_t>
+{
+    std::vector<decimal64_t> closes;
+
+    std::ifstream file(where_file("AAPL.csv"));
+    std::string line;
+    std::getline(file, line);
+
+    while (std::getline(file, line))
+    {
+        std::stringstream ss(line);
+        std::string token;
+        for (int column {}; column < 5; ++column)
+        {
+            std::getline(ss, token, ',');
+        }
+
+        decimal64_t close;
+        from_chars(token.c_str(), token.c_str() + token.size(), close);
+        closes.emplace_back(close);
+    }
+
+    return closes;
+}
+
+// Statistics of every window of the closing prices, recomputed from the whole window at each day
+// as in the original examples/moving_average.cpp, and updated one day at a time by rolling_window
+BOOST_DECIMAL_NO_INLINE void test_rolling_window(const std::vector<decimal64_t>& closes, const std::size_t window_size)
+{
+    // The file only has a year of prices
+    constexpr std::size_t passes {2000};
+    const decimal64_t n {window_size};
+
+    const auto t1 = std::chrono::steady_clock::now();
+
+    decimal64_t naive_mean {0};
+    for (std::size_t k {}; k < passes; ++k)
+    {
+        for (auto i {window_size - 1U}; i < closes.size(); ++i)
+        {
+            decimal64_t sum {0};
+            for (std::size_t j {}; j < window_size; ++j)
+            {
+                sum += closes[i - j];
+            }
+
+            naive_mean += sum / n;
+        }
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    decimal64_t rolling_mean {0};
+    for (std::size_t k {}; k < passes; ++k)
+    {
+        rolling_window<decimal64_t> window {window_size};
+        for (const auto close : closes)
+        {
+            window.push(close);
+            if (window.full())
+            {
+                rolling_mean += window.mean();
+            }
+        }
+    }
+
+    const auto t3 = std::chrono::steady_clock::now();
+
+    decimal64_t naive_stats {0};
+    for (std::size_t k {}; k < passes; ++k)
+    {
+        for (auto i {window_size - 1U}; i < closes.size(); ++i)
+        {
+            decimal64_t sum {0};
+            decimal64_t sum_of_squares {0};
+            auto min {closes[i]};
+            auto max {closes[i]};
+            for (std::size_t j {}; j < window_size; ++j)
+            {
+                const auto close {closes[i - j]};
+                sum += close;
+                sum_of_squares += close * close;
+                min = close < min ? close : min;
+                max = max < close ? close : max;
+            }
+
+            const auto mean {sum / n};
+            naive_stats += mean + (sum_of_squares / n - mean * mean) + min + max;
+        }
+    }
+
+    const auto t4 = std::chrono::steady_clock::now();
+
+    decimal64_t rolling_stats {0};
+    for (std::size_t k {}; k < passes; ++k)
+    {
+        rolling_window<decimal64_t> window {window_size};
+        for (const auto close : closes)
+        {
+            window.push(close);
+            if (window.full())
+            {
+                rolling_stats += window.mean() + window.variance() + window.min() + window.max();
+            }
+        }
+    }
+
+    const auto t5 = std::chrono::steady_clock::now();
+
+    std::cerr << "Window " << std::left << std::setw(3) << window_size
+              << " mean: naive " << std::setw( 10 ) << ( t2 - t1 ) / 1us
+              << " us, rolling " << std::setw( 10 ) << ( t3 - t2 ) / 1us << " us (s=" << (naive_mean == rolling_mean) << ")\n"
+              << "Window " << std::left << std::setw(3) << window_size
+              << " mean, variance, min, max: naive " << std::setw( 10 ) << ( t4 - t3 ) / 1us
+              << " us, rolling " << std::setw( 10 ) << ( t5 - t4 ) / 1us << " us (s=" << (naive_stats == rolling_stats) << ")\n";
+}
+
+// The previous std::hash specializations, which hashed the bit pattern
+template <typename T>
+std::size_t bits_hash(const T& x)
+{
+    std::uint64_t words[2] {};
+    std::memcpy(words, &x, sizeof(T));
+
+    return std::hash<std::uint64_t>{}(words[0] ^ words[1]);
+}
+
 template <typename T>
 static BOOST_DECIMAL_NO_INLINE void init_input_data( std::vector<T>& data )
 {
@@ -398,6 +756,109 @@ void test_from_chars(bool general, const char* type)
     test_boost_from_chars<T>( data, general, label, type );
 }
 
+// Quotes the way they appear in market data feeds: a handful of integer digits and 2-4 decimal places
+BOOST_DECIMAL_NO_INLINE void init_price_input_data( std::vector<std::string>& data )
+{
+    data.reserve( N );
+
+    std::mt19937_64 rng;
+    std::uniform_int_distribution<int> places_dist( 2, 4 );
+    std::uniform_int_distribution<std::uint64_t> cents_dist( 1U, 999'999U );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        const int places = places_dist( rng );
+        const auto str = std::to_string( cents_dist( rng ) * ( places == 2 ? 1U : places == 3 ? 10U : 100U ) + static_cast<std::uint64_t>( i % 10U ) );
+
+        data.push_back( str.size() > static_cast<std::size_t>( places ) ?
+                        str.substr( 0, str.size() - static_cast<std::size_t>( places ) ) + '.' + str.substr( str.size() - static_cast<std::size_t>( places ) ) :
+                        "0." + std::string( static_cast<std::size_t>( places ) - str.size(), '0' ) + str );
+    }
+}
+
+BOOST_DECIMAL_NO_INLINE void test_parser_prices( std::vector<std::string> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+    std::uint64_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto const& x: data )
+        {
+            bool sign {};
+            std::uint64_t significand {};
+            std::int32_t exponent {};
+            boost::decimal::detail::parser( x.data(), x.data() + x.size(), sign, significand, exponent );
+
+            s += significand + static_cast<std::uint64_t>( exponent );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "   boost::decimal::detail::parser<std::uint64_t>, prices    : " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+}
+
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_from_chars_prices( std::vector<std::string> const& data, char const* type )
+{
+    test_boost_from_chars<T>( data, true, "prices    ", type );
+}
+
+// Writes every value followed by a comma into an arena, once one value at a time and once with to_chars_bulk.
+// The values are written in chunks so that the arena stays in cache
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_to_chars_bulk( std::vector<T> const& data, char const* type )
+{
+    constexpr std::size_t chunk = 4096;
+    std::vector<char> arena( chunk * 64 );
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( std::size_t first = 0; first < data.size(); first += chunk )
+        {
+            const std::size_t n = std::min( chunk, data.size() - first );
+            char* current = arena.data();
+            char* const last = arena.data() + arena.size();
+
+            for( std::size_t j = 0; j < n; ++j )
+            {
+                auto r = boost::decimal::to_chars( current, last, data[first + j] );
+                current = r.ptr;
+                *current++ = ',';
+            }
+
+            s += static_cast<std::size_t>( current - arena.data() );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "      to_chars loop<" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+
+    t1 = std::chrono::steady_clock::now();
+
+    s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( std::size_t first = 0; first < data.size(); first += chunk )
+        {
+            const std::size_t n = std::min( chunk, data.size() - first );
+            auto r = boost::decimal::to_chars_bulk( arena.data(), arena.data() + arena.size(), data.data() + first, n );
+            s += static_cast<std::size_t>( r.ptr - arena.data() );
+        }
+    }
+
+    t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "      to_chars_bulk<" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+}
+
 #endif
 
 int main()
@@ -468,6 +929,156 @@ int main()
     test_two_element_operation(dec64_fast_vector, std::divides<>(), "Division", "dec64_fast");
     test_two_element_operation(dec128_fast_vector, std::divides<>(), "Division", "dec128_fast");
 
+    std::cerr << "\n===== Batch Operations =====\n";
+
+    test_batch_operation(dec32_vector, std::plus<>(), [](const auto* x, const auto* y, auto* r, std::size_t n) { add(x, y, r, n); }, "Batch Addition", "decimal32_t");
+    test_batch_operation(dec32_fast_vector, std::plus<>(), [](const auto* x, const auto* y, auto* r, std::size_t n) { add(x, y, r, n); }, "Batch Addition", "dec32_fast");
+    test_batch_operation(dec32_vector, std::multiplies<>(), [](const auto* x, const auto* y, auto* r, std::size_t n) { mul(x, y, r, n); }, "Batch Multiplication", "decimal32_t");
+    test_batch_operation(dec32_fast_vector, std::multiplies<>(), [](const auto* x, const auto* y, auto* r, std::size_t n) { mul(x, y, r, n); }, "Batch Multiplication", "dec32_fast");
+    test_batch_operation(dec64_vector, std::plus<>(), [](const auto* x, const auto* y, auto* r, std::size_t n) { add(x, y, r, n); }, "Batch Addition", "decimal64_t");
+    test_batch_operation(dec64_fast_vector, std::plus<>(), [](const auto* x, const auto* y, auto* r, std::size_t n) { add(x, y, r, n); }, "Batch Addition", "dec64_fast");
+    test_batch_operation(dec64_vector, std::minus<>(), [](const auto* x, const auto* y, auto* r, std::size_t n) { sub(x, y, r, n); }, "Batch Subtraction", "decimal64_t");
+    test_batch_operation(dec64_fast_vector, std::minus<>(), [](const auto* x, const auto* y, auto* r, std::size_t n) { sub(x, y, r, n); }, "Batch Subtraction", "dec64_fast");
+    test_batch_operation(dec64_vector, std::multiplies<>(), [](const auto* x, const auto* y, auto* r, std::size_t n) { mul(x, y, r, n); }, "Batch Multiplication", "decimal64_t");
+    test_batch_operation(dec64_fast_vector, std::multiplies<>(), [](const auto* x, const auto* y, auto* r, std::size_t n) { mul(x, y, r, n); }, "Batch Multiplication", "dec64_fast");
+    test_batch_operation(dec64_vector, std::divides<>(), [](const auto* x, const auto* y, auto* r, std::size_t n) { div(x, y, r, n); }, "Batch Division", "decimal64_t");
+    test_batch_operation(dec64_fast_vector, std::divides<>(), [](const auto* x, const auto* y, auto* r, std::size_t n) { div(x, y, r, n); }, "Batch Division", "dec64_fast");
+
+    std::cerr << "\n===== Column Operations =====\n";
+
+    test_column_operation(dec64_fast_vector, std::plus<>(), [](const auto& x, const auto& y, auto& r) { add(x, y, r); }, "Column Addition", "dec64_fast");
+    test_column_operation(dec64_fast_vector, std::minus<>(), [](const auto& x, const auto& y, auto& r) { sub(x, y, r); }, "Column Subtraction", "dec64_fast");
+    test_column_operation(dec64_fast_vector, std::multiplies<>(), [](const auto& x, const auto& y, auto& r) { mul(x, y, r); }, "Column Multiplication", "dec64_fast");
+    test_column_operation(dec64_fast_vector, std::divides<>(), [](const auto& x, const auto& y, auto& r) { div(x, y, r); }, "Column Division", "dec64_fast");
+    test_column_sign_scan(dec64_fast_vector, "dec64_fast");
+
+    // Multiplication rounds almost every result, so it reads the rounding mode on the hot path.
+    // Build once with and once without BOOST_DECIMAL_THREAD_LOCAL_ROUNDING_MODE to compare the storage
+    #ifdef BOOST_DECIMAL_THREAD_LOCAL_ROUNDING_MODE
+    std::cerr << "\n===== Rounding Mode (thread_local) =====\n";
+    #else
+    std::cerr << "\n===== Rounding Mode (global) =====\n";
+    #endif
+
+    {
+        const rounding_scope scope {rounding_mode::fe_dec_toward_zero};
+        test_two_element_operation(dec32_vector, std::multiplies<>(), "Multiplication", "decimal32_t");
+        test_two_element_operation(dec64_vector, std::multiplies<>(), "Multiplication", "decimal64_t");
+        test_two_element_operation(dec32_fast_vector, std::multiplies<>(), "Multiplication", "dec32_fast");
+        test_two_element_operation(dec64_fast_vector, std::multiplies<>(), "Multiplication", "dec64_fast");
+    }
+
+    // Same operations with the mode fixed at compile time instead of read from fegetround
+    std::cerr << "\n===== Rounding Mode (compile time) =====\n";
+
+    const auto fixed_mul = [](const auto& x, const auto& y) { return mul<rounding_mode::fe_dec_toward_zero>(x, y); };
+    const auto fixed_div = [](const auto& x, const auto& y) { return div<rounding_mode::fe_dec_toward_zero>(x, y); };
+
+    test_two_element_operation(dec32_vector, fixed_mul, "Multiplication", "decimal32_t");
+    test_two_element_operation(dec64_vector, fixed_mul, "Multiplication", "decimal64_t");
+    test_two_element_operation(dec128_vector, fixed_mul, "Multiplication", "decimal128_t");
+    test_two_element_operation(dec32_vector, fixed_div, "Division", "decimal32_t");
+    test_two_element_operation(dec64_vector, fixed_div, "Division", "decimal64_t");
+    test_two_element_operation(dec128_vector, fixed_div, "Division", "decimal128_t");
+
+    // Prices with four fractional digits, as the scaled integers and as the equal decimal64_t values
+    std::cerr << "\n===== Fixed Point =====\n";
+
+    std::vector<fixed_decimal<4>> fixed_price_vector(N);
+    std::vector<decimal64_t> dec64_price_vector(N);
+    {
+        std::mt19937_64 price_rng(42);
+        std::uniform_int_distribution<std::int64_t> price_dist(1, INT64_C(10'000'000));
+        for (std::size_t i {}; i < N; ++i)
+        {
+            fixed_price_vector[i] = fixed_decimal<4>::from_scaled(price_dist(price_rng));
+            dec64_price_vector[i] = static_cast<decimal64_t>(fixed_price_vector[i]);
+        }
+    }
+
+    const auto fixed_plus = [](const auto& x, const auto& y) { return (x + y).scaled_value(); };
+    const auto fixed_multiplies = [](const auto& x, const auto& y) { return (x * y).scaled_value(); };
+    const auto fixed_divides = [](const auto& x, const auto& y) { return (x / y).scaled_value(); };
+
+    test_two_element_operation(dec64_price_vector, std::plus<>(), "Addition", "decimal64_t");
+    test_two_element_operation(fixed_price_vector, fixed_plus, "Addition", "fixed<4>");
+    test_two_element_operation(dec64_price_vector, std::multiplies<>(), "Multiplication", "decimal64_t");
+    test_two_element_operation(fixed_price_vector, fixed_multiplies, "Multiplication", "fixed<4>");
+    test_two_element_operation(dec64_price_vector, std::divides<>(), "Division", "decimal64_t");
+    test_two_element_operation(fixed_price_vector, fixed_divides, "Division", "fixed<4>");
+
+    std::cerr << "\n===== Sort =====\n";
+
+    test_sort(dec32_vector, "decimal32_t");
+    test_sort(dec64_vector, "decimal64_t");
+    test_sort(dec128_vector, "decimal128_t");
+    test_sort(dec32_fast_vector, "dec32_fast");
+    test_sort(dec64_fast_vector, "dec64_fast");
+    test_sort(dec128_fast_vector, "dec128_fast");
+
+    std::cerr << "\n===== Reduce =====\n";
+
+    test_reduce(dec32_vector, "decimal32_t");
+    test_reduce(dec64_vector, "decimal64_t");
+    test_reduce(dec128_vector, "decimal128_t");
+    test_reduce(dec32_fast_vector, "dec32_fast");
+    test_reduce(dec64_fast_vector, "dec64_fast");
+    test_reduce(dec128_fast_vector, "dec128_fast");
+
+    // a * b + c * d - e rounded after every operator, and rounded once
+    std::cerr << "\n===== Fused Expressions =====\n";
+
+    const auto rounded_expression = [](const auto& x, const auto& y) { return x * y + y * y - x; };
+    const auto fused_expression = [](const auto& x, const auto& y) { return static_cast<std::decay_t<decltype(x)>>(fused(x) * y + fused(y) * y - x); };
+
+    test_two_element_operation(dec32_vector, rounded_expression, "Rounded", "decimal32_t");
+    test_two_element_operation(dec32_vector, fused_expression, "Fused", "decimal32_t");
+    test_two_element_operation(dec64_vector, rounded_expression, "Rounded", "decimal64_t");
+    test_two_element_operation(dec64_vector, fused_expression, "Fused", "decimal64_t");
+    test_two_element_operation(dec32_fast_vector, rounded_expression, "Rounded", "dec32_fast");
+    test_two_element_operation(dec32_fast_vector, fused_expression, "Fused", "dec32_fast");
+    test_two_element_operation(dec64_fast_vector, rounded_expression, "Rounded", "dec64_fast");
+    test_two_element_operation(dec64_fast_vector, fused_expression, "Fused", "dec64_fast");
+
+    std::cerr << "\n===== DPD and BID Interchange =====\n";
+
+    test_interchange(dec32_vector, "decimal32_t");
+    test_interchange(dec64_vector, "decimal64_t");
+    test_interchange(dec128_vector, "decimal128_t");
+    test_interchange(dec32_fast_vector, "dec32_fast");
+    test_interchange(dec64_fast_vector, "dec64_fast");
+    test_interchange(dec128_fast_vector, "dec128_fast");
+
+    std::cerr << "\n===== Rolling Window =====\n";
+
+    const auto closing_prices {load_closing_prices()};
+    test_rolling_window(closing_prices, 10U);
+    test_rolling_window(closing_prices, 30U);
+    test_rolling_window(closing_prices, 100U);
+
+    // Hashing the bit pattern only agrees with operator== when the keys are normalized first
+    std::cerr << "\n===== Hash =====\n";
+
+    const auto raw_bits_hash = [](const auto& x) { return bits_hash(x); };
+    const auto normalized_bits_hash = [](const auto& x)
+    {
+        int exp {};
+        const auto sig {frexp10(x, &exp)};
+        return bits_hash(std::decay_t<decltype(x)>{sig, exp, signbit(x)});
+    };
+    const auto canonical_hash = [](const auto& x) { return std::hash<std::decay_t<decltype(x)>>{}(x); };
+
+    test_one_element_operation(dec32_vector, raw_bits_hash, "Bits Hash", "decimal32_t");
+    test_one_element_operation(dec32_vector, normalized_bits_hash, "Normalized Bits Hash", "decimal32_t");
+    test_one_element_operation(dec32_vector, canonical_hash, "Canonical Hash", "decimal32_t");
+    test_one_element_operation(dec64_vector, raw_bits_hash, "Bits Hash", "decimal64_t");
+    test_one_element_operation(dec64_vector, normalized_bits_hash, "Normalized Bits Hash", "decimal64_t");
+    test_one_element_operation(dec64_vector, canonical_hash, "Canonical Hash", "decimal64_t");
+    test_one_element_operation(dec128_vector, raw_bits_hash, "Bits Hash", "decimal128_t");
+    test_one_element_operation(dec128_vector, normalized_bits_hash, "Normalized Bits Hash", "decimal128_t");
+    test_one_element_operation(dec128_vector, canonical_hash, "Canonical Hash", "decimal128_t");
+    test_one_element_operation(dec64_fast_vector, canonical_hash, "Canonical Hash", "dec64_fast");
+
 #if 0
     std::cerr << "\n===== sqrt =====\n";
 
@@ -505,6 +1116,26 @@ int main()
     test_from_chars<decimal_fast64_t>(true, "dec64_fast");
     test_from_chars<decimal_fast128_t>(false, "dec128_fast");
     test_from_chars<decimal_fast128_t>(true, "dec128_fast");
+
+    std::cerr << "\n===== Price Parsing =====\n";
+
+    std::vector<std::string> price_strings;
+    init_price_input_data(price_strings);
+    test_parser_prices(price_strings);
+    test_from_chars_prices<decimal32_t>(price_strings, "decimal32_t");
+    test_from_chars_prices<decimal64_t>(price_strings, "decimal64_t");
+    test_from_chars_prices<decimal128_t>(price_strings, "decimal128_t");
+    test_from_chars_prices<decimal_fast32_t>(price_strings, "dec32_fast");
+    test_from_chars_prices<decimal_fast64_t>(price_strings, "dec64_fast");
+    test_from_chars_prices<decimal_fast128_t>(price_strings, "dec128_fast");
+
+    std::cerr << "\n===== Bulk to_chars =====\n";
+    test_to_chars_bulk(dec32_vector, "decimal32_t");
+    test_to_chars_bulk(dec64_vector, "decimal64_t");
+    test_to_chars_bulk(dec128_vector, "decimal128_t");
+    test_to_chars_bulk(dec32_fast_vector, "dec32_fast");
+    test_to_chars_bulk(dec64_fast_vector, "dec64_fast");
+    test_to_chars_bulk(dec128_fast_vector, "dec128_fast");
 #endif
     std::cerr << std::endl;
 
@@ -57,6 +57,13 @@ void test_add()
         const decimal_fast128_t dec128_fast_2 {val2};
         const decimal_fast128_t dec128_fast_res {dec128_fast_1 + dec128_fast_2};
 
+        // The range of the distribution overflows so the values are infinite,
+        // and inf - inf and inf / inf are NaN in both types
+        if (isnan(dec128_res) && isnan(dec128_fast_res))
+        {
+            continue;
+        }
+
         if (!BOOST_TEST_EQ(static_cast<double>(dec128_res), static_cast<double>(dec128_fast_res)))
         {
             // LCOV_EXCL_START
@@ -128,7 +135,14 @@ void test_sub()
 
         const decimal_fast128_t dec128_fast_1 {val1};
         const decimal_fast128_t dec128_fast_2 {val2};
-        const decimal_fast128_t dec128_fast_res {dec128_fast_1 + dec128_fast_2};
+        const decimal_fast128_t dec128_fast_res {dec128_fast_1 - dec128_fast_2};
+
+        // The range of the distribution overflows so the values are infinite,
+        // and inf - inf and inf / inf are NaN in both types
+        if (isnan(dec128_res) && isnan(dec128_fast_res))
+        {
+            continue;
+        }
 
         if (!BOOST_TEST_EQ(static_cast<double>(dec128_res), static_cast<double>(dec128_fast_res)))
         {
@@ -272,6 +286,13 @@ void test_div()
         const decimal_fast128_t dec128_fast_2 {val2};
         const decimal_fast128_t dec128_fast_res {dec128_fast_1 / dec128_fast_2};
 
+        // The range of the distribution overflows so the values are infinite,
+        // and inf - inf and inf / inf are NaN in both types
+        if (isnan(dec128_res) && isnan(dec128_fast_res))
+        {
+            continue;
+        }
+
         if (!BOOST_TEST_EQ(static_cast<double>(dec128_res), static_cast<double>(dec128_fast_res)))
         {
             // LCOV_EXCL_START
@@ -0,0 +1,331 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+using namespace boost::decimal;
+using boost::int128::int128_t;
+using boost::int128::uint128_t;
+
+static std::mt19937_64 rng(42);
+
+#ifdef BOOST_DECIMAL_REDUCE_TEST_DEPTH
+static constexpr std::size_t N {128};
+#else
+static constexpr std::size_t N {1024};
+#endif
+
+// The buffers are built byte by byte in the little-endian layout of an Arrow array
+#if BOOST_DECIMAL_ENDIAN_LITTLE_BYTE
+
+// Appends the 16 byte two's complement form of val
+void push_decimal128(std::vector<std::uint8_t>& buffer, const std::int64_t val)
+{
+    for (int i {}; i < 16; ++i)
+    {
+        const auto byte {i < 8 ? static_cast<std::uint64_t>(val) >> (8 * i) : (val < 0 ? UINT64_C(0xFF) : UINT64_C(0))};
+        buffer.push_back(static_cast<std::uint8_t>(byte));
+    }
+}
+
+void push_decimal256(std::vector<std::uint8_t>& buffer, const std::uint64_t (&words)[4])
+{
+    for (const auto word : words)
+    {
+        for (int i {}; i < 8; ++i)
+        {
+            buffer.push_back(static_cast<std::uint8_t>(word >> (8 * i)));
+        }
+    }
+}
+
+template <typename T>
+auto as_values(const std::vector<std::uint8_t>& buffer) -> std::vector<T>
+{
+    std::vector<T> values(buffer.size() / sizeof(T));
+    std::memcpy(values.data(), buffer.data(), buffer.size());
+    return values;
+}
+
+template <typename T>
+auto as_bytes(const std::vector<T>& values) -> std::vector<std::uint8_t>
+{
+    std::vector<std::uint8_t> buffer(values.size() * sizeof(T));
+    std::memcpy(buffer.data(), values.data(), buffer.size());
+    return buffer;
+}
+
+// decimal128(7, 2): [123.45, -0.01, null, 0, 99999.99, -99999.99, null, 1, 42]
+template <typename T>
+void test_decimal128_read()
+{
+    std::vector<std::uint8_t> buffer;
+    push_decimal128(buffer, 12345);
+    push_decimal128(buffer, -1);
+    push_decimal128(buffer, 0x5A5A5A5A);
+    push_decimal128(buffer, 0);
+    push_decimal128(buffer, 9999999);
+    push_decimal128(buffer, -9999999);
+    push_decimal128(buffer, -0x5A5A5A5A);
+    push_decimal128(buffer, 100);
+    push_decimal128(buffer, 4200);
+
+    const std::uint8_t validity[] {0xBB, 0x01};
+    const auto values {as_values<int128_t>(buffer)};
+
+    std::vector<T> out(values.size());
+    BOOST_TEST_EQ(from_arrow_decimal128(validity, values.data(), out.data(), out.size(), 2), 2U);
+
+    BOOST_TEST_EQ(out[0], T(12345, -2));
+    BOOST_TEST_EQ(out[1], T(-1, -2));
+    BOOST_TEST(isnan(out[2]));
+    BOOST_TEST_EQ(out[3], T(0));
+    BOOST_TEST_EQ(out[4], T(9999999, -2));
+    BOOST_TEST_EQ(out[5], T(-9999999, -2));
+    BOOST_TEST(isnan(out[6]));
+    BOOST_TEST_EQ(out[7], T(1));
+    BOOST_TEST_EQ(out[8], T(42));
+
+    // A slice of the array starting at element 3
+    std::vector<T> slice(4);
+    BOOST_TEST_EQ(from_arrow_decimal128(validity, values.data(), slice.data(), slice.size(), 2, 3U), 1U);
+    BOOST_TEST_EQ(slice[0], T(0));
+    BOOST_TEST_EQ(slice[2], T(-9999999, -2));
+    BOOST_TEST(isnan(slice[3]));
+
+    // No validity bitmap means no nulls
+    BOOST_TEST_EQ(from_arrow_decimal128(nullptr, values.data(), slice.data(), slice.size(), 2, 4U), 0U);
+    BOOST_TEST_EQ(slice[2], T(-0x5A5A5A5A, -2));
+
+    // A negative scale multiplies by a power of ten
+    BOOST_TEST_EQ(from_arrow_decimal128(nullptr, values.data(), slice.data(), 1U, -3), 0U);
+    BOOST_TEST_EQ(slice[0], T(12345, 3));
+}
+
+// [123.45, -0.01, NaN, 0, inf, 1000.006, 123456.78, -1.0049] as decimal128(7, 2)
+template <typename T>
+void test_decimal128_write()
+{
+    const std::vector<T> values {T(12345, -2), T(-1, -2), std::numeric_limits<T>::quiet_NaN(), T(0),
+                                 std::numeric_limits<T>::infinity(), T(1000006, -3), T(12345678, -2), T(-10049, -4)};
+
+    std::vector<int128_t> out(values.size());
+    std::uint8_t validity[] {0xFF};
+
+    const auto res {to_arrow_decimal128(values.data(), validity, out.data(), out.size(), 7, 2)};
+    BOOST_TEST(!res);
+    BOOST_TEST_EQ(res.null_count, 3U);
+    BOOST_TEST_EQ(res.error_count, 2U);
+    BOOST_TEST_EQ(res.first_error, 4U);
+    BOOST_TEST_EQ(validity[0], 0xABU);
+
+    std::vector<std::uint8_t> expected;
+    push_decimal128(expected, 12345);
+    push_decimal128(expected, -1);
+    push_decimal128(expected, 0);
+    push_decimal128(expected, 0);
+    push_decimal128(expected, 0);
+    push_decimal128(expected, 100001);
+    push_decimal128(expected, 0);
+    push_decimal128(expected, -100);
+    BOOST_TEST(as_bytes(out) == expected);
+
+    // The last partial byte of the bitmap has its unused bits cleared
+    std::uint8_t partial[] {0xFF, 0xFF};
+    BOOST_TEST(to_arrow_decimal128(values.data(), partial, out.data(), 2U, 7, 2));
+    BOOST_TEST_EQ(partial[0], 0x03U);
+    BOOST_TEST_EQ(partial[1], 0xFFU);
+
+    // Rounding to scale follows the current rounding mode
+    const T one_and_a_bit {1001, -3};
+    {
+        rounding_scope round {rounding_mode::fe_dec_upward};
+        BOOST_TEST(to_arrow_decimal128(&one_and_a_bit, partial, out.data(), 1U, 7, 2));
+        BOOST_TEST(out[0] == 101);
+    }
+    {
+        rounding_scope round {rounding_mode::fe_dec_downward};
+        BOOST_TEST(to_arrow_decimal128(&one_and_a_bit, partial, out.data(), 1U, 7, 2));
+        BOOST_TEST(out[0] == 100);
+    }
+}
+
+// decimal256 values beyond 128 bits round to the precision of decimal128_t
+void test_decimal256_read()
+{
+    std::vector<std::uint8_t> buffer;
+    push_decimal256(buffer, {UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX});
+    push_decimal256(buffer, {UINT64_C(0xB9F5610000000000), UINT64_C(0x6329F1C35CA4BFAB), UINT64_C(0x000000000000001D), 0U});
+    push_decimal256(buffer, {UINT64_C(0x4A9BFFFFFFFFFFFF), UINT64_C(0x6D99782D3BFACB02), UINT64_C(0xFFFFFFBB93C4EA06), UINT64_MAX});
+    push_decimal256(buffer, {UINT64_MAX, UINT64_C(0x7775A5F171950FFF), UINT64_C(0x0764B4ABE8652979), UINT64_C(0x161BCCA7119915B5)});
+    push_decimal256(buffer, {UINT64_C(0xA3D9E4001DCD6500), UINT64_C(0xBC627050305ADF14), UINT64_C(0x0000000000000B7A), 0U});
+    push_decimal256(buffer, {UINT64_C(0xA3D9E4001DCD6501), UINT64_C(0xBC627050305ADF14), UINT64_C(0x0000000000000B7A), 0U});
+
+    const auto values {as_values<arrow_int256_t>(buffer)};
+    std::vector<decimal128_t> out(values.size());
+    BOOST_TEST_EQ(from_arrow_decimal256(nullptr, values.data(), out.data(), out.size(), 0), 0U);
+
+    // -1, 10^40, -(10^50 + 1), 10^76 - 1
+    BOOST_TEST_EQ(out[0], decimal128_t(-1));
+    BOOST_TEST_EQ(out[1], decimal128_t(1, 40));
+    BOOST_TEST_EQ(out[2], decimal128_t(-1, 50));
+    BOOST_TEST_EQ(out[3], decimal128_t(1, 76));
+
+    // 10^42 + 5 * 10^8 is a tie, which rounds to even, and one more is above it
+    BOOST_TEST_EQ(out[4], decimal128_t(1, 42));
+    const uint128_t above_tie {uint128_t{1U} + detail::pow10(uint128_t{33U})};
+    BOOST_TEST_EQ(out[5], decimal128_t(above_tie, 9));
+
+    // 10^40 at scale 2
+    BOOST_TEST_EQ(from_arrow_decimal256(nullptr, values.data(), out.data(), 1U, 2, 1U), 0U);
+    BOOST_TEST_EQ(out[0], decimal128_t(1, 38));
+}
+
+void test_decimal256_write()
+{
+    const decimal64_t values[] {decimal64_t(-15, -1), decimal64_t(1, 40), std::numeric_limits<decimal64_t>::quiet_NaN()};
+
+    arrow_int256_t out[3] {};
+    std::uint8_t validity[1] {};
+    const auto res {to_arrow_decimal256(values, validity, out, 3U, 76, 1)};
+    BOOST_TEST(res);
+    BOOST_TEST_EQ(res.null_count, 1U);
+    BOOST_TEST_EQ(validity[0], 0x03U);
+
+    // -15 and 10^41
+    std::vector<std::uint8_t> expected;
+    push_decimal256(expected, {UINT64_C(0xFFFFFFFFFFFFFFF1), UINT64_MAX, UINT64_MAX, UINT64_MAX});
+    push_decimal256(expected, {UINT64_C(0x4395CA0000000000), UINT64_C(0xDFA371A19E6F7CB5), UINT64_C(0x0000000000000125), 0U});
+    push_decimal256(expected, {0U, 0U, 0U, 0U});
+    BOOST_TEST(as_bytes(std::vector<arrow_int256_t>(out, out + 3)) == expected);
+
+    // 10^41 has 42 digits
+    BOOST_TEST(!to_arrow_decimal256(values + 1, validity, out, 1U, 41, 1));
+}
+
+#endif // BOOST_DECIMAL_ENDIAN_LITTLE_BYTE
+
+// Values of at most precision digits at the scale of the array survive the trip unchanged
+template <typename T>
+void test_round_trip()
+{
+    constexpr int precision {std::numeric_limits<T>::digits10};
+    const auto max_sig {detail::pow10(uint128_t{static_cast<unsigned>(precision)})};
+
+    std::uniform_int_distribution<int> exp_dist(-8, 8);
+    std::uniform_int_distribution<int> digits_dist(1, precision);
+
+    std::vector<T> values(N);
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto digits {digits_dist(rng)};
+        const auto sig {uint128_t{rng(), rng()} % detail::pow10(uint128_t{static_cast<unsigned>(digits)})};
+        values[i] = T(sig < max_sig ? sig : max_sig - 1U, exp_dist(rng), rng() % 2U == 0U);
+    }
+    values[N / 2] = std::numeric_limits<T>::quiet_NaN();
+
+    std::vector<std::uint8_t> validity((N + 7U) / 8U);
+    std::vector<T> back(N);
+
+    std::vector<int128_t> narrow(N);
+    if (precision + 16 <= 38)
+    {
+        const auto res {to_arrow_decimal128(values.data(), validity.data(), narrow.data(), N, precision + 16, 8)};
+        BOOST_TEST(res);
+        BOOST_TEST_EQ(res.null_count, 1U);
+        BOOST_TEST_EQ(from_arrow_decimal128(validity.data(), narrow.data(), back.data(), N, 8), 1U);
+
+        for (std::size_t i {}; i < N; ++i)
+        {
+            BOOST_TEST(back[i] == values[i] || (isnan(back[i]) && isnan(values[i])));
+        }
+    }
+
+    std::vector<arrow_int256_t> wide(N);
+    const auto res {to_arrow_decimal256(values.data(), validity.data(), wide.data(), N, precision + 16, 8)};
+    BOOST_TEST(res);
+    BOOST_TEST_EQ(res.null_count, 1U);
+    BOOST_TEST_EQ(from_arrow_decimal256(validity.data(), wide.data(), back.data(), N, 8), 1U);
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(back[i] == values[i] || (isnan(back[i]) && isnan(values[i])));
+    }
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+void test_span()
+{
+    std::vector<decimal64_t> values {decimal64_t{12345, -2}, std::numeric_limits<decimal64_t>::quiet_NaN(), decimal64_t{-25, -1}};
+    const std::vector<decimal64_t> const_values {values};
+
+    std::vector<std::uint8_t> validity(1U);
+    std::vector<int128_t> narrow(values.size());
+    std::vector<arrow_int256_t> wide(values.size());
+
+    auto res {to_arrow_decimal128(std::span<const decimal64_t>{const_values}, std::span<std::uint8_t>{validity}, std::span<int128_t>{narrow}, 9, 2)};
+    BOOST_TEST(res);
+    BOOST_TEST_EQ(res.null_count, 1U);
+    BOOST_TEST_EQ(validity[0], 0b101U);
+    BOOST_TEST(narrow[0] == 12345);
+    BOOST_TEST(narrow[2] == -250);
+
+    // A span of non-const values
+    std::fill(narrow.begin(), narrow.end(), int128_t{});
+    res = to_arrow_decimal128(std::span<decimal64_t>{values}, std::span<std::uint8_t>{validity}, std::span<int128_t>{narrow}, 9, 2);
+    BOOST_TEST(res);
+    BOOST_TEST(narrow[0] == 12345);
+    BOOST_TEST(narrow[2] == -250);
+
+    res = to_arrow_decimal256(std::span<decimal64_t>{values}, std::span<std::uint8_t>{validity}, std::span<arrow_int256_t>{wide}, 9, 2);
+    BOOST_TEST(res);
+
+    std::vector<decimal64_t> back(values.size());
+    BOOST_TEST_EQ(from_arrow_decimal256(validity.data(), std::span<const arrow_int256_t>{wide}, std::span<decimal64_t>{back}, 2), 1U);
+    BOOST_TEST_EQ(back[0], values[0]);
+    BOOST_TEST_EQ(back[2], values[2]);
+}
+
+#endif
+
+int main()
+{
+    #if BOOST_DECIMAL_ENDIAN_LITTLE_BYTE
+    test_decimal128_read<decimal32_t>();
+    test_decimal128_read<decimal64_t>();
+    test_decimal128_read<decimal128_t>();
+    test_decimal128_read<decimal_fast64_t>();
+    test_decimal128_read<decimal_fast128_t>();
+
+    test_decimal128_write<decimal32_t>();
+    test_decimal128_write<decimal64_t>();
+    test_decimal128_write<decimal128_t>();
+    test_decimal128_write<decimal_fast64_t>();
+    test_decimal128_write<decimal_fast128_t>();
+
+    test_decimal256_read();
+    test_decimal256_write();
+    #endif
+
+    test_round_trip<decimal32_t>();
+    test_round_trip<decimal64_t>();
+    test_round_trip<decimal128_t>();
+    test_round_trip<decimal_fast32_t>();
+    test_round_trip<decimal_fast64_t>();
+    test_round_trip<decimal_fast128_t>();
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+    test_span();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,323 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/decimal/batch.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <vector>
+
+using namespace boost::decimal;
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024U); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024U >> 4U); // Number of trials
+#endif
+
+static std::mt19937_64 rng(42);
+
+// The batch functions must give bit-identical results to the scalar operators,
+// so fill the inputs with a mix of cohorts, zeros and non-finite values
+template <typename T>
+std::vector<T> generate_values(const std::size_t size)
+{
+    std::uniform_int_distribution<std::int64_t> sig_dist(-9'999'999'999'999'999, 9'999'999'999'999'999);
+    std::uniform_int_distribution<int> exp_dist(-50, 50);
+    std::uniform_int_distribution<int> special_dist(0, 31);
+
+    std::vector<T> values(size);
+    for (auto& val : values)
+    {
+        switch (special_dist(rng))
+        {
+            case 0:
+                val = std::numeric_limits<T>::infinity();
+                break;
+            case 1:
+                val = -std::numeric_limits<T>::infinity();
+                break;
+            case 2:
+                val = std::numeric_limits<T>::quiet_NaN();
+                break;
+            case 3:
+                val = T{0, exp_dist(rng)};
+                break;
+            case 4:
+                val = T{sig_dist(rng) % 1000, exp_dist(rng)};
+                break;
+            default:
+                val = T{sig_dist(rng), exp_dist(rng)};
+                break;
+        }
+    }
+
+    return values;
+}
+
+template <typename T>
+void check_same(const std::vector<T>& batch_res, const std::vector<T>& scalar_res)
+{
+    BOOST_TEST_EQ(batch_res.size(), scalar_res.size());
+
+    for (std::size_t i {}; i < batch_res.size(); ++i)
+    {
+        if (!BOOST_TEST(to_bid(batch_res[i]) == to_bid(scalar_res[i])))
+        {
+            // LCOV_EXCL_START
+            std::cerr << "Index: " << i
+                      << "\nBatch: " << batch_res[i]
+                      << "\nScalar: " << scalar_res[i] << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    }
+}
+
+template <typename T>
+void test_binary_ops()
+{
+    // Use a size that is not a multiple of the block size to exercise the tail
+    const auto lhs {generate_values<T>(N + 3U)};
+    const auto rhs {generate_values<T>(N + 3U)};
+    const auto size {lhs.size()};
+
+    std::vector<T> batch_res(size);
+    std::vector<T> scalar_res(size);
+
+    add(lhs.data(), rhs.data(), batch_res.data(), size);
+    for (std::size_t i {}; i < size; ++i)
+    {
+        scalar_res[i] = lhs[i] + rhs[i];
+    }
+    check_same(batch_res, scalar_res);
+
+    sub(lhs.data(), rhs.data(), batch_res.data(), size);
+    for (std::size_t i {}; i < size; ++i)
+    {
+        scalar_res[i] = lhs[i] - rhs[i];
+    }
+    check_same(batch_res, scalar_res);
+
+    mul(lhs.data(), rhs.data(), batch_res.data(), size);
+    for (std::size_t i {}; i < size; ++i)
+    {
+        scalar_res[i] = lhs[i] * rhs[i];
+    }
+    check_same(batch_res, scalar_res);
+
+    div(lhs.data(), rhs.data(), batch_res.data(), size);
+    for (std::size_t i {}; i < size; ++i)
+    {
+        scalar_res[i] = lhs[i] / rhs[i];
+    }
+    check_same(batch_res, scalar_res);
+
+    const auto addend {generate_values<T>(size)};
+    fma(lhs.data(), rhs.data(), addend.data(), batch_res.data(), size);
+    for (std::size_t i {}; i < size; ++i)
+    {
+        scalar_res[i] = fma(lhs[i], rhs[i], addend[i]);
+    }
+    check_same(batch_res, scalar_res);
+}
+
+// Mostly 7-digit values with nearby exponents, which the 32-bit types run through the SIMD kernels
+template <typename T>
+void test_price_grid()
+{
+    std::uniform_int_distribution<std::int32_t> sig_dist(-9'999'999, 9'999'999);
+    std::uniform_int_distribution<int> exp_dist(-8, 2);
+    std::uniform_int_distribution<int> special_dist(0, 63);
+
+    std::vector<T> lhs(N + 5U);
+    std::vector<T> rhs(lhs.size());
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        lhs[i] = T{sig_dist(rng), exp_dist(rng)};
+        rhs[i] = special_dist(rng) == 0 ? T{sig_dist(rng), exp_dist(rng) + 20} : T{sig_dist(rng), exp_dist(rng)};
+    }
+
+    std::vector<T> batch_res(lhs.size());
+    std::vector<T> scalar_res(lhs.size());
+
+    add(lhs.data(), rhs.data(), batch_res.data(), lhs.size());
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        scalar_res[i] = lhs[i] + rhs[i];
+    }
+    check_same(batch_res, scalar_res);
+
+    mul(lhs.data(), rhs.data(), batch_res.data(), lhs.size());
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        scalar_res[i] = lhs[i] * rhs[i];
+    }
+    check_same(batch_res, scalar_res);
+}
+
+// Results near the ends of the exponent range are left to the scalar operators
+template <typename T>
+void test_exponent_limits()
+{
+    std::uniform_int_distribution<std::int32_t> sig_dist(-9'999'999, 9'999'999);
+    std::uniform_int_distribution<int> exp_dist(-107, 90);
+
+    std::vector<T> lhs(N);
+    std::vector<T> rhs(lhs.size());
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        const auto exp {exp_dist(rng)};
+        lhs[i] = T{sig_dist(rng), exp};
+        rhs[i] = T{sig_dist(rng), exp + (i % 2U == 0U ? 1 : -exp - 3)};
+    }
+
+    std::vector<T> batch_res(lhs.size());
+
+    add(lhs.data(), rhs.data(), batch_res.data(), lhs.size());
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        BOOST_TEST(to_bid(batch_res[i]) == to_bid(lhs[i] + rhs[i]));
+    }
+
+    mul(lhs.data(), rhs.data(), batch_res.data(), lhs.size());
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        BOOST_TEST(to_bid(batch_res[i]) == to_bid(lhs[i] * rhs[i]));
+    }
+}
+
+// The SIMD kernels round with the current rounding mode, which has to match the scalar operators
+template <typename T>
+void test_rounding_modes()
+{
+    for (const auto round : {rounding_mode::fe_dec_downward, rounding_mode::fe_dec_to_nearest,
+                             rounding_mode::fe_dec_to_nearest_from_zero, rounding_mode::fe_dec_toward_zero,
+                             rounding_mode::fe_dec_upward})
+    {
+        fesetround(round);
+        test_price_grid<T>();
+        test_exponent_limits<T>();
+    }
+
+    fesetround(rounding_mode::fe_dec_default);
+}
+
+// Non-canonical significands are larger than 9'999'999 and have to be rounded when decoded
+void test_non_canonical()
+{
+    std::vector<decimal32_t> lhs(16U, from_bits(UINT32_C(0x6CBFFFFF)));
+    std::vector<decimal32_t> rhs(16U, decimal32_t{1234567, -3});
+    lhs[3] = decimal32_t{7654321, 0};
+
+    std::vector<decimal32_t> batch_res(lhs.size());
+
+    add(lhs.data(), rhs.data(), batch_res.data(), lhs.size());
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        BOOST_TEST(to_bid(batch_res[i]) == to_bid(lhs[i] + rhs[i]));
+    }
+
+    mul(lhs.data(), rhs.data(), batch_res.data(), lhs.size());
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        BOOST_TEST(to_bid(batch_res[i]) == to_bid(lhs[i] * rhs[i]));
+    }
+}
+
+template <typename T>
+void test_in_place()
+{
+    auto lhs {generate_values<T>(N)};
+    const auto rhs {generate_values<T>(N)};
+
+    std::vector<T> scalar_res(lhs.size());
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        scalar_res[i] = lhs[i] + rhs[i];
+    }
+
+    add(lhs.data(), rhs.data(), lhs.data(), lhs.size());
+    check_same(lhs, scalar_res);
+}
+
+template <typename T>
+void test_empty()
+{
+    T val {1, 0};
+    add(&val, &val, &val, 0U);
+    BOOST_TEST_EQ(val, T(1, 0));
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+template <typename T>
+void test_span()
+{
+    const auto lhs {generate_values<T>(N)};
+    const auto rhs {generate_values<T>(N)};
+
+    std::vector<T> batch_res(lhs.size());
+    std::vector<T> scalar_res(lhs.size());
+
+    mul<T>(lhs, rhs, batch_res);
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        scalar_res[i] = lhs[i] * rhs[i];
+    }
+    check_same(batch_res, scalar_res);
+
+    // Spans of non-const values for the inputs, with DecimalType deduced from the result
+    auto x {generate_values<T>(N)};
+    auto y {generate_values<T>(N)};
+    add(std::span<T>{x}, std::span<T>{y}, std::span<T>{batch_res});
+    for (std::size_t i {}; i < x.size(); ++i)
+    {
+        scalar_res[i] = x[i] + y[i];
+    }
+    check_same(batch_res, scalar_res);
+
+    fma(std::span<T>{x}, std::span<const T>{lhs}, std::span<T>{y}, std::span<T>{batch_res});
+    for (std::size_t i {}; i < x.size(); ++i)
+    {
+        scalar_res[i] = fma(x[i], lhs[i], y[i]);
+    }
+    check_same(batch_res, scalar_res);
+}
+
+#endif
+
+int main()
+{
+    test_binary_ops<decimal32_t>();
+    test_binary_ops<decimal64_t>();
+    test_binary_ops<decimal128_t>();
+    test_binary_ops<decimal_fast32_t>();
+    test_binary_ops<decimal_fast64_t>();
+    test_binary_ops<decimal_fast128_t>();
+
+    test_price_grid<decimal32_t>();
+    test_price_grid<decimal_fast32_t>();
+    test_exponent_limits<decimal32_t>();
+    test_exponent_limits<decimal_fast32_t>();
+    test_non_canonical();
+
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    test_rounding_modes<decimal32_t>();
+    test_rounding_modes<decimal_fast32_t>();
+    #endif
+
+    test_in_place<decimal64_t>();
+    test_in_place<decimal_fast64_t>();
+
+    test_empty<decimal32_t>();
+    test_empty<decimal64_t>();
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+    test_span<decimal64_t>();
+    test_span<decimal_fast64_t>();
+    #endif
+
+    return boost::report_errors();
+}
@@ -5,6 +5,7 @@
 #include <boost/decimal.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include <random>
+#include <vector>
 
 using namespace boost::decimal;
 
@@ -24,8 +25,58 @@ void test()
     }
 }
 
+template <typename T>
+void test_bulk()
+{
+    using bits_type = detail::interchange_bits_t<T>;
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<std::int64_t> dist(std::numeric_limits<std::int64_t>::min(),
+                                                     std::numeric_limits<std::int64_t>::max());
+
+    std::vector<T> values(1024U);
+    for (auto& val : values)
+    {
+        val = T{dist(rng)};
+    }
+
+    std::vector<bits_type> bits(values.size());
+    to_bid(values.data(), bits.data(), values.size());
+
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        BOOST_TEST(bits[i] == to_bid(values[i]));
+    }
+
+    std::vector<T> return_values(values.size());
+    from_bid(bits.data(), return_values.data(), bits.size());
+    BOOST_TEST(values == return_values);
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+    std::vector<bits_type> span_bits(values.size());
+    to_bid(std::span<const T>(values), std::span<bits_type>(span_bits));
+    BOOST_TEST(span_bits == bits);
+
+    std::vector<T> mutable_values(values);
+    std::vector<bits_type> mutable_bits(values.size());
+    to_bid(std::span<T>(mutable_values), std::span<bits_type>(mutable_bits));
+    BOOST_TEST(mutable_bits == bits);
+
+    std::vector<T> span_values(values.size());
+    from_bid(std::span<const bits_type>(span_bits), std::span<T>(span_values));
+    BOOST_TEST(values == span_values);
+    #endif
+}
+
 int main()
 {
+    test_bulk<decimal_fast32_t>();
+    test_bulk<decimal_fast64_t>();
+    test_bulk<decimal32_t>();
+    test_bulk<decimal64_t>();
+    test_bulk<decimal128_t>();
+    test_bulk<decimal_fast128_t>();
+
     test<decimal_fast32_t>();
     test<decimal_fast64_t>();
 
@@ -468,6 +468,107 @@ auto test_big_uints_shl() -> void
   }
 }
 
+auto test_div_uint256_by_uint128() -> void
+{
+  using boost_ctrl_uint_type = boost::multiprecision::uint256_t;
+  using dec_intern_uint_type = boost::decimal::detail::u256;
+  using local_uint128_type   = boost::int128::uint128_t;
+
+  using random_engine_type = std::mt19937_64;
+
+  random_engine_type rng(local::time_point<typename random_engine_type::result_type>());
+
+  std::uniform_int_distribution<int> width_dist(0, 64);
+
+  // Words of every width so that both the one and two word divisor paths
+  // and all of the normalization shifts get exercised
+  const auto random_word =
+    [&rng, &width_dist]() -> std::uint64_t
+    {
+      const auto width = width_dist(rng);
+
+      return (width == 64) ? rng() : (rng() & ((UINT64_C(1) << width) - 1U));
+    };
+
+  for(auto trials = static_cast<int>(INT8_C(0)); trials < static_cast<int>(INT16_C(0x1000)); ++trials)
+  {
+    const std::uint64_t lhs_words[4U] = { random_word(), random_word(), random_word(), random_word() };
+
+    local_uint128_type rhs { random_word(), random_word() };
+
+    if(rhs == 0U) { rhs = 1U; }
+
+    const dec_intern_uint_type dec_intern_uint_lhs { lhs_words[3U], lhs_words[2U], lhs_words[1U], lhs_words[0U] };
+    const dec_intern_uint_type dec_intern_uint_rhs { local_uint128_type { }, rhs };
+
+    boost_ctrl_uint_type boost_ctrl_uint_lhs { };
+    for(auto i = static_cast<int>(INT8_C(3)); i >= 0; --i) { boost_ctrl_uint_lhs <<= 64; boost_ctrl_uint_lhs |= lhs_words[i]; }
+
+    boost_ctrl_uint_type boost_ctrl_uint_rhs { rhs.high };
+    boost_ctrl_uint_rhs <<= 64;
+    boost_ctrl_uint_rhs |= rhs.low;
+
+    const auto dec_intern_div = dec_intern_uint_lhs / rhs;
+    const auto dec_intern_mod = dec_intern_uint_lhs % rhs;
+
+    const auto boost_ctrl_div = boost_ctrl_uint_lhs / boost_ctrl_uint_rhs;
+    const auto boost_ctrl_mod = boost_ctrl_uint_lhs % boost_ctrl_uint_rhs;
+
+    BOOST_TEST(local::declexical_cast(dec_intern_div) == local::declexical_cast(boost_ctrl_div));
+    BOOST_TEST(local::declexical_cast(dec_intern_mod) == local::declexical_cast(boost_ctrl_mod));
+
+    // The generic u256 divisor must agree
+    BOOST_TEST(dec_intern_div == dec_intern_uint_lhs / dec_intern_uint_rhs);
+  }
+}
+
+auto test_mul_uint256_by_narrower() -> void
+{
+  using boost_ctrl_uint_type = boost::multiprecision::uint256_t;
+  using dec_intern_uint_type = boost::decimal::detail::u256;
+  using local_uint128_type   = boost::int128::uint128_t;
+
+  using random_engine_type = std::mt19937_64;
+
+  random_engine_type rng(local::time_point<typename random_engine_type::result_type>());
+
+  std::uniform_int_distribution<int> width_dist(0, 64);
+
+  const auto random_word =
+    [&rng, &width_dist]() -> std::uint64_t
+    {
+      const auto width = width_dist(rng);
+
+      return (width == 64) ? rng() : (rng() & ((UINT64_C(1) << width) - 1U));
+    };
+
+  // The products wrap at 256 bits in both types
+  for(auto trials = static_cast<int>(INT8_C(0)); trials < static_cast<int>(INT16_C(0x1000)); ++trials)
+  {
+    const std::uint64_t lhs_words[4U] = { random_word(), random_word(), random_word(), random_word() };
+
+    const local_uint128_type rhs128 { random_word(), random_word() };
+    const std::uint64_t      rhs64  { random_word() };
+    const std::uint32_t      rhs32  { static_cast<std::uint32_t>(random_word()) };
+
+    const dec_intern_uint_type dec_intern_uint_lhs { lhs_words[3U], lhs_words[2U], lhs_words[1U], lhs_words[0U] };
+
+    boost_ctrl_uint_type boost_ctrl_uint_lhs { };
+    for(auto i = static_cast<int>(INT8_C(3)); i >= 0; --i) { boost_ctrl_uint_lhs <<= 64; boost_ctrl_uint_lhs |= lhs_words[i]; }
+
+    boost_ctrl_uint_type boost_ctrl_uint_rhs128 { rhs128.high };
+    boost_ctrl_uint_rhs128 <<= 64;
+    boost_ctrl_uint_rhs128 |= rhs128.low;
+
+    BOOST_TEST(local::declexical_cast(dec_intern_uint_lhs * rhs128) == local::declexical_cast(boost_ctrl_uint_type(boost_ctrl_uint_lhs * boost_ctrl_uint_rhs128)));
+    BOOST_TEST(local::declexical_cast(dec_intern_uint_lhs * rhs64)  == local::declexical_cast(boost_ctrl_uint_type(boost_ctrl_uint_lhs * rhs64)));
+    BOOST_TEST(local::declexical_cast(dec_intern_uint_lhs * rhs32)  == local::declexical_cast(boost_ctrl_uint_type(boost_ctrl_uint_lhs * rhs32)));
+
+    // All of the widths must agree with the full 256-bit multiplication
+    BOOST_TEST((dec_intern_uint_lhs * rhs128 == dec_intern_uint_lhs * dec_intern_uint_type { local_uint128_type { }, rhs128 }));
+  }
+}
+
 template <typename T>
 void test_digit_counting()
 {
@@ -503,6 +604,10 @@ int main()
 
   test_spot_div_uint256_t<boost::decimal::detail::u256>();
 
+  test_div_uint256_by_uint128();
+
+  test_mul_uint256_by_narrower();
+
   test_big_uints_shl<boost::multiprecision::uint128_t, boost::int128::uint128_t  >();
   test_big_uints_shl<boost::multiprecision::uint256_t, boost::decimal::detail::u256>();
 
@@ -0,0 +1,403 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <random>
+#include <limits>
+#include <vector>
+#include <cstdint>
+
+using namespace boost::decimal;
+
+static std::mt19937_64 rng(42);
+
+#ifdef BOOST_DECIMAL_REDUCE_TEST_DEPTH
+static constexpr std::size_t N {128};
+#else
+static constexpr std::size_t N {1024};
+#endif
+
+// Values whose exact sum fits in the 34 digits of decimal128_t
+template <typename T>
+auto random_values(const std::size_t n, const int max_exp) -> std::vector<T>
+{
+    std::uniform_int_distribution<std::uint64_t> sig_dist(0U, UINT64_C(9'999'999'999'999'999));
+    std::uniform_int_distribution<int> exp_dist(-max_exp, max_exp);
+    std::uniform_int_distribution<int> sign_dist(0, 1);
+
+    std::vector<T> values;
+    values.reserve(n);
+    for (std::size_t i {}; i < n; ++i)
+    {
+        auto sig {sig_dist(rng)};
+        while (sig > static_cast<std::uint64_t>(detail::max_significand_v<T>))
+        {
+            sig /= 10U;
+        }
+
+        values.emplace_back(sig, exp_dist(rng), sign_dist(rng) == 1);
+    }
+
+    return values;
+}
+
+template <typename T>
+auto accumulate(const std::vector<T>& values) -> decimal_accumulator<T>
+{
+    decimal_accumulator<T> acc;
+    for (const auto& val : values)
+    {
+        acc += val;
+    }
+
+    return acc;
+}
+
+// Rounds the exact value to the precision of T in the current rounding mode
+template <typename T>
+auto round_exact(const decimal128_t exact) -> T
+{
+    int exp {};
+    auto sig {frexp10(exact, &exp)};
+    const bool is_neg {signbit(exact)};
+
+    const auto removed {std::numeric_limits<decimal128_t>::digits10 - std::numeric_limits<T>::digits10};
+    boost::int128::uint128_t divisor {1U};
+    for (int i {}; i < removed; ++i)
+    {
+        divisor *= 10U;
+    }
+
+    const auto remainder {sig % divisor};
+    sig /= divisor;
+
+    bool round_up {};
+    switch (boost::decimal::fegetround())
+    {
+        case rounding_mode::fe_dec_downward:
+            round_up = is_neg && remainder != 0U;
+            break;
+        case rounding_mode::fe_dec_upward:
+            round_up = !is_neg && remainder != 0U;
+            break;
+        case rounding_mode::fe_dec_toward_zero:
+            break;
+        case rounding_mode::fe_dec_to_nearest_from_zero:
+            round_up = remainder >= divisor / 2U;
+            break;
+        default:
+            round_up = remainder > divisor / 2U || (remainder == divisor / 2U && sig % 2U == 1U);
+            break;
+    }
+
+    if (round_up)
+    {
+        ++sig;
+    }
+
+    return T{sig, exp + removed, is_neg};
+}
+
+// The sum rounded once must be the exact sum in decimal128_t rounded to T.
+// The conversions of the library are not used as the reference,
+// since they can lose the digits beyond the rounding digit in the directed rounding modes
+template <typename T>
+void test_against_decimal128(const int max_exp)
+{
+    for (const std::size_t n : {std::size_t{1}, std::size_t{2}, std::size_t{10}, N})
+    {
+        const auto values {random_values<T>(n, max_exp)};
+
+        decimal128_t exact {};
+        for (const auto& val : values)
+        {
+            exact += static_cast<decimal128_t>(val);
+        }
+
+        const auto sum {accumulate(values).value()};
+        if (!BOOST_TEST_EQ(sum, round_exact<T>(exact)))
+        {
+            // LCOV_EXCL_START
+            std::cerr << "Mode: " << static_cast<int>(boost::decimal::fegetround())
+                      << "\nSum: " << sum
+                      << "\nExact: " << exact << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    }
+}
+
+template <typename T>
+void test_order_independence()
+{
+    auto values {random_values<T>(N, std::numeric_limits<T>::max_exponent10 / 2)};
+    const auto sum {accumulate(values).value()};
+
+    for (int i {}; i < 5; ++i)
+    {
+        std::shuffle(values.begin(), values.end(), rng);
+        BOOST_TEST_EQ(accumulate(values).value(), sum);
+    }
+
+    // Any split of the range into parts gives the same sum as well
+    const auto split {values.size() / 3U};
+    decimal_accumulator<T> first;
+    decimal_accumulator<T> second;
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        if (i < split)
+        {
+            first += values[i];
+        }
+        else
+        {
+            second += values[i];
+        }
+    }
+
+    second += first;
+    BOOST_TEST_EQ(second.value(), sum);
+
+    first += decimal_accumulator<T>{};
+    decimal_accumulator<T> empty;
+    empty += first;
+    BOOST_TEST_EQ(empty.value(), first.value());
+}
+
+template <typename T>
+void test_cancellation()
+{
+    const auto values {random_values<T>(N, std::numeric_limits<T>::max_exponent10 - 20)};
+    const auto small {random_values<T>(N, 5)};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        decimal_accumulator<T> acc;
+        acc += values[i];
+        acc += small[i];
+        acc -= values[i];
+        BOOST_TEST_EQ(acc.value(), small[i]);
+    }
+
+    // Naive summation loses the 1 entirely
+    const auto big {std::numeric_limits<T>::max()};
+    decimal_accumulator<T> acc;
+    acc += big;
+    acc += T{1};
+    acc -= big;
+    BOOST_TEST_EQ(acc.value(), T{1});
+    BOOST_TEST_EQ(big + T{1} - big, T{0});
+
+    // The sum of many values of opposite sign
+    decimal_accumulator<T> alternating;
+    for (std::size_t i {}; i < N; ++i)
+    {
+        alternating += T{1, -1};
+        alternating -= T{3, -1};
+    }
+    BOOST_TEST_EQ(alternating.value(), T(-2, -1) * static_cast<int>(N));
+}
+
+template <typename T>
+void test_limits()
+{
+    decimal_accumulator<T> acc;
+    acc += std::numeric_limits<T>::max();
+    BOOST_TEST_EQ(acc.value(), std::numeric_limits<T>::max());
+
+    acc -= std::numeric_limits<T>::max();
+    acc -= std::numeric_limits<T>::min();
+    BOOST_TEST_EQ(acc.value(), -std::numeric_limits<T>::min());
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    decimal_accumulator<T> overflow;
+    overflow += std::numeric_limits<T>::max();
+    overflow += std::numeric_limits<T>::max();
+    BOOST_TEST(isinf(overflow.value()));
+
+    overflow -= std::numeric_limits<T>::max();
+    BOOST_TEST_EQ(overflow.value(), std::numeric_limits<T>::max());
+    #endif
+}
+
+template <typename T>
+void test_subnormals()
+{
+    const auto denorm_min {std::numeric_limits<T>::denorm_min()};
+
+    decimal_accumulator<T> acc;
+    for (int i {}; i < 10; ++i)
+    {
+        acc += denorm_min;
+    }
+    BOOST_TEST_EQ(acc.value(), T(1, detail::etiny_v<T> + 1));
+
+    // Digits below denorm_min are rounded off
+    acc += std::numeric_limits<T>::max();
+    acc -= std::numeric_limits<T>::max();
+    BOOST_TEST_EQ(acc.value(), T(1, detail::etiny_v<T> + 1));
+}
+
+template <typename T>
+void test_special_values()
+{
+    BOOST_TEST_EQ(decimal_accumulator<T>{}.value(), T{0});
+    BOOST_TEST(!signbit(decimal_accumulator<T>{}.value()));
+
+    decimal_accumulator<T> negative_zero;
+    negative_zero += -T{0};
+    negative_zero -= T{0};
+    BOOST_TEST(signbit(negative_zero.value()));
+
+    negative_zero += T{0};
+    BOOST_TEST(!signbit(negative_zero.value()));
+
+    decimal_accumulator<T> cancelled;
+    cancelled += T{5};
+    cancelled -= T{5};
+    BOOST_TEST_EQ(cancelled.value(), T{0});
+    BOOST_TEST(!signbit(cancelled.value()));
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    decimal_accumulator<T> acc;
+    acc += T{1};
+    acc += std::numeric_limits<T>::infinity();
+    BOOST_TEST(isinf(acc.value()) && !signbit(acc.value()));
+
+    acc -= std::numeric_limits<T>::infinity();
+    BOOST_TEST(isnan(acc.value()));
+
+    decimal_accumulator<T> negative_infinity;
+    negative_infinity -= std::numeric_limits<T>::infinity();
+    BOOST_TEST(isinf(negative_infinity.value()) && signbit(negative_infinity.value()));
+
+    decimal_accumulator<T> nan;
+    nan += std::numeric_limits<T>::quiet_NaN();
+    nan += T{1};
+    BOOST_TEST(isnan(nan.value()));
+
+    negative_infinity += nan;
+    BOOST_TEST(isnan(negative_infinity.value()));
+    #endif
+}
+
+// Each doubling doubles the count of pending additions as well,
+// so this passes the point where the carries have to be propagated
+void test_carry_propagation()
+{
+    for (const bool is_neg : {false, true})
+    {
+        decimal_accumulator<decimal128_t> acc;
+        acc += decimal128_t{123456789U, -3, is_neg};
+        acc += decimal128_t{1, -6170};
+        acc -= decimal128_t{1, -6170};
+
+        boost::int128::uint128_t expected {123456789U};
+        for (int i {}; i < 40; ++i)
+        {
+            acc += acc;
+            expected *= 2U;
+        }
+
+        BOOST_TEST_EQ(acc.value(), (decimal128_t{expected, -3, is_neg}));
+    }
+}
+
+// Borrows that run through many limbs, and sticky digits far below the ones that are kept
+void test_borrows()
+{
+    // 10^45 - 999999999 * 10^36 - 999999999 * 10^27 - 1 = 10^27 - 1, so the two most significant limbs cancel
+    decimal_accumulator<decimal64_t> chain;
+    chain += decimal64_t{1, 45};
+    chain -= decimal64_t{999999999, 36};
+    chain -= decimal64_t{999999999, 27};
+    chain -= decimal64_t{1};
+    BOOST_TEST_EQ(chain.value(), decimal64_t(1, 27));
+
+    chain += decimal64_t{1};
+    chain -= decimal64_t{1, 12};
+    BOOST_TEST_EQ(chain.value(), decimal64_t(UINT64_C(999999999999999), 12));
+
+    chain -= decimal64_t{1, 50};
+    BOOST_TEST_EQ(chain.value(), decimal64_t(-1, 50));
+
+    decimal_accumulator<decimal32_t> tie;
+    tie += decimal32_t{1234567, 50};
+    tie += decimal32_t{5, 49};
+    BOOST_TEST_EQ(tie.value(), decimal32_t(1234568, 50));
+
+    tie -= decimal32_t{1, -50};
+    BOOST_TEST_EQ(tie.value(), decimal32_t(1234567, 50));
+
+    tie += decimal32_t{2, -50};
+    BOOST_TEST_EQ(tie.value(), decimal32_t(1234568, 50));
+
+    tie -= decimal32_t{1234568, 50};
+    BOOST_TEST_EQ(tie.value(), decimal32_t(-5, 49));
+}
+
+template <typename T>
+void test_type()
+{
+    test_order_independence<T>();
+    test_cancellation<T>();
+    test_limits<T>();
+    test_special_values<T>();
+}
+
+void test_rounding_modes()
+{
+    for (const auto mode : {rounding_mode::fe_dec_downward, rounding_mode::fe_dec_to_nearest, rounding_mode::fe_dec_to_nearest_from_zero,
+                            rounding_mode::fe_dec_toward_zero, rounding_mode::fe_dec_upward})
+    {
+        const rounding_scope scope {mode};
+
+        test_against_decimal128<decimal32_t>(8);
+        test_against_decimal128<decimal64_t>(4);
+        test_against_decimal128<decimal_fast32_t>(8);
+        test_against_decimal128<decimal_fast64_t>(4);
+    }
+}
+
+constexpr auto constexpr_sum() noexcept -> decimal32_t
+{
+    decimal_accumulator<decimal32_t> acc;
+    acc += decimal32_t{1, -1};
+    acc += decimal32_t{2, -1};
+    acc -= decimal32_t{3, -1};
+    acc += decimal32_t{1234567};
+    acc += decimal32_t{5, -1};
+
+    return acc.value();
+}
+
+int main()
+{
+    test_type<decimal32_t>();
+    test_type<decimal64_t>();
+    test_type<decimal128_t>();
+    test_type<decimal_fast32_t>();
+    test_type<decimal_fast64_t>();
+    test_type<decimal_fast128_t>();
+
+    test_carry_propagation();
+    test_borrows();
+
+    // The fast types have no subnormals
+    test_subnormals<decimal32_t>();
+    test_subnormals<decimal64_t>();
+    test_subnormals<decimal128_t>();
+
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    test_rounding_modes();
+    #else
+    test_against_decimal128<decimal32_t>(8);
+    test_against_decimal128<decimal64_t>(4);
+    #endif
+
+    static_assert(constexpr_sum() == decimal32_t{1234568}, "Wrong value");
+
+    return boost::report_errors();
+}
@@ -0,0 +1,266 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/decimal/decimal_column.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace boost::decimal;
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024U); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024U >> 4U); // Number of trials
+#endif
+
+static std::mt19937_64 rng(42);
+
+using column = decimal_column<decimal_fast64_t>;
+
+std::vector<decimal_fast64_t> generate_values(const std::size_t size)
+{
+    std::uniform_int_distribution<std::int64_t> sig_dist(-9'999'999'999'999'999, 9'999'999'999'999'999);
+    std::uniform_int_distribution<int> exp_dist(-50, 50);
+    std::uniform_int_distribution<int> special_dist(0, 31);
+
+    std::vector<decimal_fast64_t> values(size);
+    for (auto& val : values)
+    {
+        switch (special_dist(rng))
+        {
+            case 0:
+                val = -std::numeric_limits<decimal_fast64_t>::infinity();
+                break;
+            case 1:
+                val = std::numeric_limits<decimal_fast64_t>::quiet_NaN();
+                break;
+            case 2:
+                val = decimal_fast64_t{0, exp_dist(rng)};
+                break;
+            default:
+                val = decimal_fast64_t{sig_dist(rng), exp_dist(rng)};
+                break;
+        }
+    }
+
+    return values;
+}
+
+void check_same(const column& col, const std::vector<decimal_fast64_t>& values)
+{
+    BOOST_TEST_EQ(col.size(), values.size());
+
+    for (std::size_t i {}; i < col.size(); ++i)
+    {
+        if (!BOOST_TEST(to_bid(col[i]) == to_bid(values[i])))
+        {
+            // LCOV_EXCL_START
+            std::cerr << "Index: " << i
+                      << "\nColumn: " << col[i]
+                      << "\nVector: " << values[i] << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    }
+}
+
+void test_construction()
+{
+    const column empty_col;
+    BOOST_TEST(empty_col.empty());
+    BOOST_TEST(empty_col.begin() == empty_col.end());
+
+    const column zeros(5U);
+    BOOST_TEST_EQ(zeros.size(), 5U);
+    for (const auto val : zeros)
+    {
+        BOOST_TEST_EQ(to_bid(val), to_bid(decimal_fast64_t{}));
+    }
+
+    const column filled(3U, decimal_fast64_t{-25, -1});
+    check_same(filled, {decimal_fast64_t{-25, -1}, decimal_fast64_t{-25, -1}, decimal_fast64_t{-25, -1}});
+
+    const column listed {decimal_fast64_t{1}, decimal_fast64_t{2}, decimal_fast64_t{3}};
+    BOOST_TEST_EQ(listed.front(), decimal_fast64_t{1});
+    BOOST_TEST_EQ(listed.back(), decimal_fast64_t{3});
+
+    // Non-finite values and signed zeros have to round trip through the arrays
+    const auto values {generate_values(N)};
+    const column from_range(values.begin(), values.end());
+    check_same(from_range, values);
+    BOOST_TEST(signbit(column(1U, -decimal_fast64_t{0})[0]));
+    BOOST_TEST(issignaling(column(1U, std::numeric_limits<decimal_fast64_t>::signaling_NaN())[0]));
+}
+
+void test_modifiers()
+{
+    column col;
+    col.reserve(4U);
+    BOOST_TEST(col.capacity() >= 4U);
+
+    col.push_back(decimal_fast64_t{15, -1});
+    col.push_back(decimal_fast64_t{-3});
+    BOOST_TEST_EQ(col.size(), 2U);
+
+    col.resize(4U, decimal_fast64_t{7});
+    check_same(col, {decimal_fast64_t{15, -1}, decimal_fast64_t{-3}, decimal_fast64_t{7}, decimal_fast64_t{7}});
+
+    col.pop_back();
+    BOOST_TEST_EQ(col.size(), 3U);
+
+    column other {decimal_fast64_t{1}};
+    swap(col, other);
+    BOOST_TEST_EQ(col.size(), 1U);
+    BOOST_TEST_EQ(other.size(), 3U);
+
+    col.clear();
+    BOOST_TEST(col.empty());
+}
+
+void test_proxy()
+{
+    column col(4U);
+
+    col[0] = decimal_fast64_t{5, -1};
+    col[1] = col[0];
+    col[1] += decimal_fast64_t{1};
+    col[2] = decimal_fast64_t{3};
+    col[2] *= col[1];
+    col[3] = decimal_fast64_t{9};
+    col[3] -= decimal_fast64_t{4};
+    col[3] /= decimal_fast64_t{2};
+
+    BOOST_TEST_EQ(col[0], decimal_fast64_t(5, -1));
+    BOOST_TEST_EQ(col[1], decimal_fast64_t(15, -1));
+    BOOST_TEST_EQ(col[2], decimal_fast64_t(45, -1));
+    BOOST_TEST_EQ(col[3], decimal_fast64_t(25, -1));
+
+    // The proxies work with the operators of decimal_fast64_t
+    BOOST_TEST_EQ(col[0] + col[1], decimal_fast64_t{2});
+    BOOST_TEST_EQ(col[2] * decimal_fast64_t{2}, decimal_fast64_t{9});
+    BOOST_TEST(col[0] < col[1]);
+    BOOST_TEST(col[3] > col[1]);
+
+    const decimal_fast64_t val {col[2]};
+    BOOST_TEST_EQ(val, decimal_fast64_t(45, -1));
+
+    swap(col[0], col[3]);
+    BOOST_TEST_EQ(col[0], decimal_fast64_t(25, -1));
+    BOOST_TEST_EQ(col[3], decimal_fast64_t(5, -1));
+}
+
+void test_iterators()
+{
+    std::uniform_int_distribution<std::int64_t> sig_dist(-999'999, 999'999);
+    std::uniform_int_distribution<int> exp_dist(-3, 3);
+
+    std::vector<decimal_fast64_t> values(N);
+    for (auto& val : values)
+    {
+        val = decimal_fast64_t{sig_dist(rng), exp_dist(rng)};
+    }
+
+    column col(values.begin(), values.end());
+
+    BOOST_TEST_EQ(std::distance(col.begin(), col.end()), static_cast<std::ptrdiff_t>(N));
+    BOOST_TEST_EQ(std::accumulate(col.cbegin(), col.cend(), decimal_fast64_t{}),
+                  std::accumulate(values.begin(), values.end(), decimal_fast64_t{}));
+
+    std::sort(col.begin(), col.end());
+    std::sort(values.begin(), values.end());
+    BOOST_TEST(std::is_sorted(col.begin(), col.end()));
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST_EQ(col[i], values[i]);
+    }
+
+    std::reverse(col.begin(), col.end());
+    BOOST_TEST_EQ(col.front(), values.back());
+
+    auto it {col.begin() + 3};
+    *it = decimal_fast64_t{42};
+    BOOST_TEST_EQ(col.begin()[3], decimal_fast64_t{42});
+
+    column::const_iterator cit {it};
+    BOOST_TEST(cit == col.cbegin() + 3);
+    BOOST_TEST_EQ(*cit, decimal_fast64_t{42});
+    BOOST_TEST(col.cend() - cit == static_cast<std::ptrdiff_t>(N - 3U));
+}
+
+template <typename Op>
+void test_transform(Op op)
+{
+    const auto lhs_values {generate_values(N + 3U)};
+    const auto rhs_values {generate_values(N + 3U)};
+
+    const column lhs(lhs_values.begin(), lhs_values.end());
+    const column rhs(rhs_values.begin(), rhs_values.end());
+
+    std::vector<decimal_fast64_t> expected(lhs_values.size());
+    std::transform(lhs_values.begin(), lhs_values.end(), rhs_values.begin(), expected.begin(), op);
+
+    column result(lhs.size());
+    std::transform(lhs.begin(), lhs.end(), rhs.begin(), result.begin(), op);
+    check_same(result, expected);
+
+    // In place
+    column in_place {lhs};
+    std::transform(in_place.begin(), in_place.end(), rhs.begin(), in_place.begin(), op);
+    check_same(in_place, expected);
+}
+
+template <typename ColumnFunc, typename ScalarFunc>
+void test_kernel(ColumnFunc column_op, ScalarFunc scalar_op)
+{
+    const auto lhs_values {generate_values(N + 3U)};
+    const auto rhs_values {generate_values(N + 3U)};
+
+    const column lhs(lhs_values.begin(), lhs_values.end());
+    const column rhs(rhs_values.begin(), rhs_values.end());
+
+    std::vector<decimal_fast64_t> expected(lhs_values.size());
+    for (std::size_t i {}; i < expected.size(); ++i)
+    {
+        expected[i] = scalar_op(lhs_values[i], rhs_values[i]);
+    }
+
+    column result;
+    column_op(lhs, rhs, result);
+    check_same(result, expected);
+
+    // In place on either side
+    column in_place {lhs};
+    column_op(in_place, rhs, in_place);
+    check_same(in_place, expected);
+
+    in_place = rhs;
+    column_op(lhs, in_place, in_place);
+    check_same(in_place, expected);
+}
+
+int main()
+{
+    test_construction();
+    test_modifiers();
+    test_proxy();
+    test_iterators();
+
+    test_transform(std::plus<>());
+    test_transform(std::minus<>());
+    test_transform(std::multiplies<>());
+    test_transform(std::divides<>());
+
+    test_kernel([](const column& lhs, const column& rhs, column& res) { add(lhs, rhs, res); }, std::plus<>());
+    test_kernel([](const column& lhs, const column& rhs, column& res) { sub(lhs, rhs, res); }, std::minus<>());
+    test_kernel([](const column& lhs, const column& rhs, column& res) { mul(lhs, rhs, res); }, std::multiplies<>());
+    test_kernel([](const column& lhs, const column& rhs, column& res) { div(lhs, rhs, res); }, std::divides<>());
+
+    return boost::report_errors();
+}
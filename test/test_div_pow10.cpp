@@ -0,0 +1,143 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::decimal;
+using detail::div_pow10;
+using detail::u256;
+
+static std::mt19937_64 rng(42);
+
+#ifdef BOOST_DECIMAL_REDUCE_TEST_DEPTH
+static constexpr std::size_t N {128};
+#else
+static constexpr std::size_t N {1024};
+#endif
+
+// Random values of every bit width, so that all the words are exercised
+auto random_u64() -> std::uint64_t
+{
+    std::uniform_int_distribution<int> width_dist(1, 64);
+    const auto width {width_dist(rng)};
+    return width == 64 ? rng() : rng() & ((UINT64_C(1) << width) - 1U);
+}
+
+template <typename T>
+void check(const T& n, const int k, const T& divisor)
+{
+    const auto quotient {n / divisor};
+    BOOST_TEST(div_pow10(n, k) == quotient);
+
+    bool sticky {false};
+    BOOST_TEST(div_pow10(n, k, sticky) == quotient);
+    BOOST_TEST_EQ(sticky, quotient * divisor != n);
+
+    // Sticky is only ever set
+    sticky = true;
+    div_pow10(n, k, sticky);
+    BOOST_TEST(sticky);
+}
+
+void test_u32()
+{
+    constexpr auto max {(std::numeric_limits<std::uint32_t>::max)()};
+
+    for (int k {}; k < 10; ++k)
+    {
+        const auto divisor {detail::pow10(static_cast<std::uint32_t>(k))};
+
+        check(std::uint32_t{0}, k, divisor);
+        check(max, k, divisor);
+        check(divisor, k, divisor);
+        check(static_cast<std::uint32_t>(divisor - 1U), k, divisor);
+
+        for (std::size_t i {}; i < N; ++i)
+        {
+            check(static_cast<std::uint32_t>(random_u64()), k, divisor);
+        }
+    }
+}
+
+void test_u64()
+{
+    constexpr auto max {(std::numeric_limits<std::uint64_t>::max)()};
+
+    for (int k {}; k < 20; ++k)
+    {
+        const auto divisor {detail::pow10(static_cast<std::uint64_t>(k))};
+
+        check(std::uint64_t{0}, k, divisor);
+        check(max, k, divisor);
+        check(divisor, k, divisor);
+        check(divisor - 1U, k, divisor);
+        check(max - max % divisor, k, divisor);
+
+        for (std::size_t i {}; i < N; ++i)
+        {
+            check(random_u64(), k, divisor);
+        }
+    }
+}
+
+void test_u128()
+{
+    using boost::int128::uint128_t;
+    constexpr auto max {(std::numeric_limits<uint128_t>::max)()};
+
+    for (int k {}; k < 39; ++k)
+    {
+        const auto divisor {detail::pow10(static_cast<uint128_t>(k))};
+
+        check(uint128_t{0}, k, divisor);
+        check(max, k, divisor);
+        check(divisor, k, divisor);
+        check(divisor - 1U, k, divisor);
+        check(max - max % divisor, k, divisor);
+
+        for (std::size_t i {}; i < N; ++i)
+        {
+            check(uint128_t{random_u64(), random_u64()}, k, divisor);
+        }
+    }
+}
+
+void test_u256()
+{
+    constexpr auto max {(std::numeric_limits<u256>::max)()};
+
+    for (int k {}; k < 78; ++k)
+    {
+        const auto divisor {detail::impl::u256_pow_10[k]};
+
+        check(u256{}, k, divisor);
+        check(max, k, divisor);
+        check(divisor, k, divisor);
+
+        for (std::size_t i {}; i < N / 8U; ++i)
+        {
+            check(u256{random_u64(), random_u64(), random_u64(), random_u64()}, k, divisor);
+        }
+    }
+}
+
+static_assert(div_pow10(UINT32_C(4294967295), 9) == UINT32_C(4), "Wrong value");
+static_assert(div_pow10(UINT64_C(18446744073709551615), 19) == UINT64_C(1), "Wrong value");
+static_assert(div_pow10(UINT64_C(12345678901234567), 5) == UINT64_C(123456789012), "Wrong value");
+static_assert(div_pow10(boost::int128::uint128_t{UINT64_C(0x4B3B4CA85A86C47A), UINT64_C(0x098A224000000000)}, 38) == 1U, "Wrong value");
+
+int main()
+{
+    test_u32();
+    test_u64();
+    test_u128();
+    test_u256();
+
+    return boost::report_errors();
+}
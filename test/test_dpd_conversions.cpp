@@ -12,6 +12,7 @@
 #include <boost/decimal/iostream.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include <random>
+#include <vector>
 
 using namespace boost::decimal;
 
@@ -63,8 +64,115 @@ void test_float_range()
     }
 }
 
+// Every entry of the lookup tables against the bitwise encoder and decoder
+void test_tables()
+{
+    for (std::uint32_t declet {}; declet < 1024U; ++declet)
+    {
+        std::uint8_t d1 {};
+        std::uint8_t d2 {};
+        std::uint8_t d3 {};
+        detail::decode_dpd(declet, d3, d2, d1);
+        BOOST_TEST_EQ(detail::dpd_table.declet_to_binary[declet], d1 * 100U + d2 * 10U + d3);
+    }
+
+    for (std::uint32_t value {}; value < 1000U; ++value)
+    {
+        const auto declet {detail::dpd_table.binary_to_declet[value]};
+        BOOST_TEST_EQ(declet, detail::encode_dpd(static_cast<std::uint8_t>(value / 100U),
+                                                 static_cast<std::uint8_t>((value / 10U) % 10U),
+                                                 static_cast<std::uint8_t>(value % 10U)));
+        BOOST_TEST_EQ(detail::dpd_table.declet_to_binary[declet], value);
+    }
+}
+
+void test_known_encodings()
+{
+    static_assert(to_dpd(decimal32_t{1, 0}) == UINT32_C(0x22500001), "Wrong encoding");
+    static_assert(to_dpd(decimal64_t{1, 0}) == UINT64_C(0x2238000000000001), "Wrong encoding");
+
+    BOOST_TEST_EQ(to_dpd(decimal32_t{9999999, 0}), UINT32_C(0x6E53FCFF));
+    BOOST_TEST_EQ(to_dpd(decimal64_t{UINT64_C(9999999999999999), 0}), UINT64_C(0x6E38FF3FCFF3FCFF));
+    const auto negative_64 {-decimal64_t{UINT64_C(1234567890123456), -5}};
+    BOOST_TEST_EQ(to_dpd(negative_64), UINT64_C(0xA62534B9C1E28E56));
+    constexpr boost::int128::uint128_t dpd_128_one {UINT64_C(0x2208000000000000), UINT64_C(1)};
+    BOOST_TEST(to_dpd(decimal128_t{1, 0}) == dpd_128_one);
+
+    BOOST_TEST_EQ(from_dpd<decimal64_t>(UINT64_C(0xA62534B9C1E28E56)), negative_64);
+    BOOST_TEST_EQ(from_dpd<decimal128_t>(dpd_128_one), decimal128_t{1});
+
+    // 0x3FF is a non-canonical encoding of 999
+    BOOST_TEST_EQ(from_dpd<decimal32_t>(UINT32_C(0x225003FF)), decimal32_t{999});
+}
+
+template <typename T>
+void test_bulk()
+{
+    using bits_type = detail::interchange_bits_t<T>;
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<std::int64_t> dist(std::numeric_limits<std::int64_t>::min(),
+                                                     std::numeric_limits<std::int64_t>::max());
+    std::uniform_int_distribution<int> exp_dist(-50, 50);
+
+    std::vector<T> values(1024U);
+    for (auto& val : values)
+    {
+        val = T{dist(rng), exp_dist(rng)};
+    }
+    values[0] = std::numeric_limits<T>::infinity();
+    values[1] = -std::numeric_limits<T>::quiet_NaN();
+    values[2] = T{0};
+
+    std::vector<bits_type> bits(values.size());
+    to_dpd(values.data(), bits.data(), values.size());
+
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        BOOST_TEST(bits[i] == to_dpd(values[i]));
+    }
+
+    std::vector<T> return_values(values.size());
+    from_dpd(bits.data(), return_values.data(), bits.size());
+
+    BOOST_TEST(isinf(return_values[0]));
+    BOOST_TEST(isnan(return_values[1]));
+    for (std::size_t i {2}; i < values.size(); ++i)
+    {
+        BOOST_TEST_EQ(values[i], return_values[i]);
+    }
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+    std::vector<bits_type> span_bits(values.size());
+    to_dpd(std::span<const T>(values), std::span<bits_type>(span_bits));
+    BOOST_TEST(span_bits == bits);
+
+    std::vector<T> mutable_values(values);
+    std::vector<bits_type> mutable_bits(values.size());
+    to_dpd(std::span<T>(mutable_values), std::span<bits_type>(mutable_bits));
+    BOOST_TEST(mutable_bits == bits);
+
+    std::vector<T> span_values(values.size());
+    from_dpd(std::span<const bits_type>(span_bits), std::span<T>(span_values));
+    for (std::size_t i {2}; i < values.size(); ++i)
+    {
+        BOOST_TEST_EQ(values[i], span_values[i]);
+    }
+    #endif
+}
+
 int main()
 {
+    test_tables();
+    test_known_encodings();
+
+    test_bulk<decimal32_t>();
+    test_bulk<decimal_fast32_t>();
+    test_bulk<decimal64_t>();
+    test_bulk<decimal_fast64_t>();
+    test_bulk<decimal128_t>();
+    test_bulk<decimal_fast128_t>();
+
     test<decimal32_t>();
     test<decimal_fast32_t>();
 
@@ -0,0 +1,257 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_DECIMAL_ENABLE_EXCEPTION_FLAGS
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <thread>
+
+using namespace boost::decimal;
+
+// Without constant evaluation detection the flags can not be recorded at all
+#ifdef BOOST_DECIMAL_HAS_EXCEPTION_FLAGS
+
+template <typename T>
+void test_flags(const T& value, const exception_flag expected)
+{
+    const auto raised {boost::decimal::fetestexcept(exception_flag::fe_dec_all_except)};
+    if (!BOOST_TEST(raised == expected))
+    {
+        // LCOV_EXCL_START
+        std::cerr << "Value: " << value
+                  << "\nRaised: " << static_cast<unsigned>(raised)
+                  << "\nExpected: " << static_cast<unsigned>(expected) << std::endl;
+        // LCOV_EXCL_STOP
+    }
+
+    boost::decimal::feclearexcept(exception_flag::fe_dec_all_except);
+}
+
+template <typename T>
+void test_exact()
+{
+    const T one {1};
+    const T two {2};
+    const T four {4};
+
+    test_flags(one + two, exception_flag::fe_dec_none);
+    test_flags(one - four, exception_flag::fe_dec_none);
+    test_flags(two * four, exception_flag::fe_dec_none);
+    test_flags(one / four, exception_flag::fe_dec_none);
+    test_flags(T{25, -2}, exception_flag::fe_dec_none);
+}
+
+template <typename T>
+void test_inexact()
+{
+    const T one {1};
+    const T three {3};
+
+    test_flags(one / three, exception_flag::fe_dec_inexact);
+
+    // 1/3 times 3 needs more digits than the significand has
+    const T third {one / three};
+    boost::decimal::feclearexcept(exception_flag::fe_dec_all_except);
+    test_flags(third * third, exception_flag::fe_dec_inexact);
+
+    // The smaller addend is dropped entirely
+    test_flags(T{1, 20} + T{1, -20}, exception_flag::fe_dec_inexact);
+    test_flags(T{1, 20} - T{1, -20}, exception_flag::fe_dec_inexact);
+
+    // Only some of the digits of the smaller addend survive
+    test_flags(T{1, 0} + T{123'456, -std::numeric_limits<T>::digits10}, exception_flag::fe_dec_inexact);
+
+    // The constructor has to drop digits of the significand
+    using sig_type = typename T::significand_type;
+    sig_type too_long {1};
+    for (int i {}; i < std::numeric_limits<T>::digits10; ++i)
+    {
+        too_long *= 10U;
+    }
+
+    test_flags(T{too_long, 0}, exception_flag::fe_dec_none);
+    test_flags(T{too_long + 1U, 0}, exception_flag::fe_dec_inexact);
+}
+
+template <typename T>
+void test_overflow_underflow()
+{
+    test_flags(std::numeric_limits<T>::max() * T{10}, exception_flag::fe_dec_overflow | exception_flag::fe_dec_inexact);
+    test_flags(T{1, std::numeric_limits<T>::max_exponent10 * 2}, exception_flag::fe_dec_overflow | exception_flag::fe_dec_inexact);
+
+    const auto underflowed {std::numeric_limits<T>::denorm_min() / T{1, 10}};
+    BOOST_TEST(boost::decimal::fetestexcept(exception_flag::fe_dec_underflow) == exception_flag::fe_dec_underflow);
+    test_flags(underflowed, boost::decimal::fetestexcept(exception_flag::fe_dec_all_except));
+}
+
+template <typename T>
+void test_divbyzero()
+{
+    test_flags(T{1} / T{0}, exception_flag::fe_dec_divbyzero);
+    test_flags(T{-5} / T{0}, exception_flag::fe_dec_divbyzero);
+}
+
+template <typename T>
+void test_invalid()
+{
+    const T one {1};
+    const T snan {std::numeric_limits<T>::signaling_NaN()};
+    const T qnan {std::numeric_limits<T>::quiet_NaN()};
+    const T inf {std::numeric_limits<T>::infinity()};
+
+    test_flags(snan + one, exception_flag::fe_dec_invalid);
+    test_flags(one * snan, exception_flag::fe_dec_invalid);
+    test_flags(snan / one, exception_flag::fe_dec_invalid);
+    test_flags(qnan + one, exception_flag::fe_dec_none);
+    test_flags(qnan / one, exception_flag::fe_dec_none);
+    test_flags(inf + one, exception_flag::fe_dec_none);
+
+    // Operations without a meaningful result return qNaN
+    const T zero {0};
+    const T results[] {inf - inf, inf + -inf, inf * zero, zero * -inf, zero / zero, inf / -inf,
+                       fma(inf, one, -inf), fma(inf, zero, one)};
+    BOOST_TEST(boost::decimal::fetestexcept(exception_flag::fe_dec_invalid) == exception_flag::fe_dec_invalid);
+    boost::decimal::feclearexcept(exception_flag::fe_dec_all_except);
+
+    for (const auto& res : results)
+    {
+        BOOST_TEST(isnan(res));
+        BOOST_TEST(!issignaling(res));
+    }
+
+    test_flags(inf + inf, exception_flag::fe_dec_none);
+    test_flags(inf - -inf, exception_flag::fe_dec_none);
+    test_flags(inf * inf, exception_flag::fe_dec_none);
+    test_flags(zero / one, exception_flag::fe_dec_none);
+}
+
+template <typename T>
+void test_quantize_invalid()
+{
+    test_flags(quantize(std::numeric_limits<T>::infinity(), T{1}), exception_flag::fe_dec_invalid);
+    test_flags(quantize(T{1}, T{2}), exception_flag::fe_dec_none);
+}
+
+template <typename T>
+void test_fixed_rounding_invalid()
+{
+    const T inf {std::numeric_limits<T>::infinity()};
+
+    BOOST_TEST(isnan(add<rounding_mode::fe_dec_downward>(inf, -inf)));
+    BOOST_TEST(isnan(sub<rounding_mode::fe_dec_upward>(inf, inf)));
+    BOOST_TEST(isnan(mul<rounding_mode::fe_dec_to_nearest>(inf, T{0})));
+    BOOST_TEST(isnan(div<rounding_mode::fe_dec_toward_zero>(T{0}, T{0})));
+    test_flags(inf, exception_flag::fe_dec_invalid);
+}
+
+void test_interface()
+{
+    BOOST_TEST(boost::decimal::fetestexcept(exception_flag::fe_dec_all_except) == exception_flag::fe_dec_none);
+
+    boost::decimal::feraiseexcept(exception_flag::fe_dec_overflow | exception_flag::fe_dec_inexact);
+    BOOST_TEST(boost::decimal::fetestexcept(exception_flag::fe_dec_overflow) == exception_flag::fe_dec_overflow);
+    BOOST_TEST(boost::decimal::fetestexcept(exception_flag::fe_dec_underflow) == exception_flag::fe_dec_none);
+    BOOST_TEST(boost::decimal::fetestexcept(exception_flag::fe_dec_all_except) == (exception_flag::fe_dec_overflow | exception_flag::fe_dec_inexact));
+
+    // Flags are sticky until they are cleared
+    const decimal64_t sum {decimal64_t{1} + decimal64_t{2}};
+    BOOST_TEST_EQ(sum, decimal64_t{3});
+    BOOST_TEST(boost::decimal::fetestexcept(exception_flag::fe_dec_overflow) == exception_flag::fe_dec_overflow);
+
+    boost::decimal::feclearexcept(exception_flag::fe_dec_overflow);
+    BOOST_TEST(boost::decimal::fetestexcept(exception_flag::fe_dec_all_except) == exception_flag::fe_dec_inexact);
+
+    boost::decimal::feclearexcept(exception_flag::fe_dec_all_except);
+    BOOST_TEST(boost::decimal::fetestexcept(exception_flag::fe_dec_all_except) == exception_flag::fe_dec_none);
+}
+
+void test_constexpr()
+{
+    // Operations evaluated at compile time do not touch the flags
+    constexpr decimal32_t third {decimal32_t{1} / decimal32_t{3}};
+    static_assert(third > decimal32_t{0}, "Wrong result");
+
+    BOOST_TEST(boost::decimal::fetestexcept(exception_flag::fe_dec_all_except) == exception_flag::fe_dec_none);
+}
+
+void test_threads()
+{
+    boost::decimal::feraiseexcept(exception_flag::fe_dec_invalid);
+
+    exception_flag seen_by_thread {exception_flag::fe_dec_all_except};
+    exception_flag left_by_thread {exception_flag::fe_dec_none};
+
+    std::thread thread {[&seen_by_thread, &left_by_thread]
+    {
+        // A new thread starts with all flags clear
+        seen_by_thread = boost::decimal::fetestexcept(exception_flag::fe_dec_all_except);
+
+        const decimal64_t res {decimal64_t{1} / decimal64_t{3}};
+        static_cast<void>(res);
+        left_by_thread = boost::decimal::fetestexcept(exception_flag::fe_dec_all_except);
+    }};
+
+    thread.join();
+
+    BOOST_TEST(seen_by_thread == exception_flag::fe_dec_none);
+    BOOST_TEST(left_by_thread == exception_flag::fe_dec_inexact);
+
+    // The inexact division in the other thread is not visible here
+    BOOST_TEST(boost::decimal::fetestexcept(exception_flag::fe_dec_all_except) == exception_flag::fe_dec_invalid);
+    boost::decimal::feclearexcept(exception_flag::fe_dec_all_except);
+}
+
+template <typename T>
+void test_type()
+{
+    test_exact<T>();
+    test_inexact<T>();
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    test_overflow_underflow<T>();
+    test_divbyzero<T>();
+    test_invalid<T>();
+    #endif
+}
+
+int main()
+{
+    test_interface();
+    test_constexpr();
+
+    test_type<decimal32_t>();
+    test_type<decimal64_t>();
+    test_type<decimal128_t>();
+    test_type<decimal_fast32_t>();
+    test_type<decimal_fast64_t>();
+    test_type<decimal_fast128_t>();
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    test_quantize_invalid<decimal32_t>();
+    test_quantize_invalid<decimal64_t>();
+    test_quantize_invalid<decimal128_t>();
+    test_fixed_rounding_invalid<decimal32_t>();
+    test_fixed_rounding_invalid<decimal64_t>();
+    test_fixed_rounding_invalid<decimal128_t>();
+    #endif
+
+    test_threads();
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    // The functions are still available, but never report anything
+    boost::decimal::feraiseexcept(exception_flag::fe_dec_all_except);
+    BOOST_TEST(boost::decimal::fetestexcept(exception_flag::fe_dec_all_except) == exception_flag::fe_dec_none);
+
+    return boost::report_errors();
+}
+
+#endif
@@ -67,9 +67,39 @@ void test_constructor_rounding()
     BOOST_TEST_EQ(decimal32_t(99'999'999), decimal32_t(1, 8));
 }
 
+void test_rounding_scope()
+{
+    boost::decimal::fesetround(rounding_mode::fe_dec_to_nearest);
+
+    {
+        const rounding_scope outer {rounding_mode::fe_dec_downward};
+        BOOST_TEST(boost::decimal::fegetround() == rounding_mode::fe_dec_downward);
+        BOOST_TEST(outer.previous() == rounding_mode::fe_dec_to_nearest);
+
+        {
+            const rounding_scope inner {rounding_mode::fe_dec_upward};
+            BOOST_TEST(boost::decimal::fegetround() == rounding_mode::fe_dec_upward);
+            BOOST_TEST(inner.previous() == rounding_mode::fe_dec_downward);
+
+            #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+            BOOST_TEST_EQ(decimal32_t(12'345'671, 0), decimal32_t(1'234'568, 1));
+            #endif
+        }
+
+        BOOST_TEST(boost::decimal::fegetround() == rounding_mode::fe_dec_downward);
+
+        #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+        BOOST_TEST_EQ(decimal32_t(12'345'679, 0), decimal32_t(1'234'567, 1));
+        #endif
+    }
+
+    BOOST_TEST(boost::decimal::fegetround() == rounding_mode::fe_dec_to_nearest);
+}
+
 int main()
 {
     test_environment();
+    test_rounding_scope();
     
     #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
     test_constructor_rounding();
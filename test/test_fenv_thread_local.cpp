@@ -0,0 +1,66 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_DECIMAL_THREAD_LOCAL_ROUNDING_MODE
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace boost::decimal;
+
+// Each thread rounds the same ties with its own mode, while the other threads run with theirs
+void round_with(const rounding_mode round, const decimal64_t expected, std::atomic<int>& failures)
+{
+    // A new thread starts with the default mode whatever the mode of the thread that created it
+    if (boost::decimal::fegetround() != rounding_mode::fe_dec_default)
+    {
+        ++failures; // LCOV_EXCL_LINE
+    }
+
+    const rounding_scope scope {round};
+
+    for (int i {}; i < 10000; ++i)
+    {
+        if (boost::decimal::fegetround() != round || decimal64_t(12'345'678'901'234'565, 0) != expected)
+        {
+            ++failures; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+void test_threads()
+{
+    boost::decimal::fesetround(rounding_mode::fe_dec_upward);
+
+    std::atomic<int> failures {0};
+    std::vector<std::thread> threads;
+
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    threads.emplace_back(round_with, rounding_mode::fe_dec_downward, decimal64_t(1'234'567'890'123'456, 1), std::ref(failures));
+    threads.emplace_back(round_with, rounding_mode::fe_dec_upward, decimal64_t(1'234'567'890'123'457, 1), std::ref(failures));
+    threads.emplace_back(round_with, rounding_mode::fe_dec_to_nearest, decimal64_t(1'234'567'890'123'456, 1), std::ref(failures));
+    threads.emplace_back(round_with, rounding_mode::fe_dec_to_nearest_from_zero, decimal64_t(1'234'567'890'123'457, 1), std::ref(failures));
+    #endif
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    BOOST_TEST_EQ(failures.load(), 0);
+
+    // Setting the mode in the other threads did not change it in this one
+    BOOST_TEST(boost::decimal::fegetround() == rounding_mode::fe_dec_upward);
+    boost::decimal::fesetround(rounding_mode::fe_dec_default);
+}
+
+int main()
+{
+    test_threads();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,275 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <cstdint>
+
+using namespace boost::decimal;
+
+static std::mt19937_64 rng(42);
+
+#ifdef BOOST_DECIMAL_REDUCE_TEST_DEPTH
+static constexpr std::size_t N {128};
+#else
+static constexpr std::size_t N {1024};
+#endif
+
+using money = fixed_decimal<2>;
+using rate = fixed_decimal<4>;
+
+template <typename T>
+auto random_value(const std::int64_t max_scaled) -> T
+{
+    std::uniform_int_distribution<std::int64_t> dist(-max_scaled, max_scaled);
+    return T::from_scaled(static_cast<typename T::storage_type>(dist(rng)));
+}
+
+template <typename T>
+auto to_string(const T& val) -> std::string
+{
+    std::stringstream ss;
+    ss << val;
+    return ss.str();
+}
+
+void test_construction()
+{
+    BOOST_TEST_EQ(money{}.scaled_value(), 0);
+    BOOST_TEST_EQ(money{12}.scaled_value(), 1200);
+    BOOST_TEST_EQ(money{-3}.scaled_value(), -300);
+    BOOST_TEST_EQ(rate{1}.scaled_value(), 10000);
+    BOOST_TEST_EQ(money::from_scaled(1234).scaled_value(), 1234);
+    BOOST_TEST_EQ(money::scale, 2);
+
+    BOOST_TEST_EQ(money(decimal64_t(1234, -2)).scaled_value(), 1234);
+    BOOST_TEST_EQ(money(decimal64_t(12340, -3)).scaled_value(), 1234);
+    BOOST_TEST_EQ(money(decimal32_t(5)).scaled_value(), 500);
+    BOOST_TEST_EQ(money(decimal128_t(-7, -2)).scaled_value(), -7);
+    BOOST_TEST_EQ(money(decimal_fast64_t(25, -1)).scaled_value(), 250);
+    BOOST_TEST_EQ(money(decimal64_t(0)).scaled_value(), 0);
+}
+
+void test_add_sub()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto lhs {random_value<money>(INT64_C(1'000'000'000'000))};
+        const auto rhs {random_value<money>(INT64_C(1'000'000'000'000))};
+
+        BOOST_TEST_EQ((lhs + rhs).scaled_value(), lhs.scaled_value() + rhs.scaled_value());
+        BOOST_TEST_EQ((lhs - rhs).scaled_value(), lhs.scaled_value() - rhs.scaled_value());
+
+        // Both are exact in decimal128_t
+        BOOST_TEST_EQ(static_cast<decimal128_t>(lhs + rhs), static_cast<decimal128_t>(lhs) + static_cast<decimal128_t>(rhs));
+        BOOST_TEST_EQ(static_cast<decimal128_t>(lhs - rhs), static_cast<decimal128_t>(lhs) - static_cast<decimal128_t>(rhs));
+    }
+
+    auto val {money{5}};
+    val += money::from_scaled(25);
+    BOOST_TEST_EQ(val.scaled_value(), 525);
+    val -= money{1};
+    BOOST_TEST_EQ(val.scaled_value(), 425);
+    BOOST_TEST_EQ((-val).scaled_value(), -425);
+    BOOST_TEST_EQ((+val).scaled_value(), 425);
+}
+
+// The exact product and quotient rounded by the conversion from decimal128_t
+// must be the same as the result of the fixed point operators in every rounding mode
+template <typename T>
+void test_mul_div_against_decimal128(const std::int64_t max_scaled)
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto lhs {random_value<T>(max_scaled)};
+        const auto rhs {random_value<T>(max_scaled)};
+
+        const auto product {static_cast<decimal128_t>(lhs) * static_cast<decimal128_t>(rhs)};
+        if (!BOOST_TEST(lhs * rhs == T{product}))
+        {
+            // LCOV_EXCL_START
+            std::cerr << "Mode: " << static_cast<int>(boost::decimal::fegetround())
+                      << "\nLHS: " << lhs
+                      << "\nRHS: " << rhs
+                      << "\nProduct: " << (lhs * rhs)
+                      << "\nExpected: " << product << std::endl;
+            // LCOV_EXCL_STOP
+        }
+
+        if (rhs == T{})
+        {
+            continue;
+        }
+
+        const auto quotient {static_cast<decimal128_t>(lhs) / static_cast<decimal128_t>(rhs)};
+        if (!BOOST_TEST(lhs / rhs == T{quotient}))
+        {
+            // LCOV_EXCL_START
+            std::cerr << "Mode: " << static_cast<int>(boost::decimal::fegetround())
+                      << "\nLHS: " << lhs
+                      << "\nRHS: " << rhs
+                      << "\nQuotient: " << (lhs / rhs)
+                      << "\nExpected: " << quotient << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    }
+}
+
+void test_rounding_modes()
+{
+    for (const auto mode : {rounding_mode::fe_dec_downward, rounding_mode::fe_dec_to_nearest, rounding_mode::fe_dec_to_nearest_from_zero,
+                            rounding_mode::fe_dec_toward_zero, rounding_mode::fe_dec_upward})
+    {
+        const rounding_scope scope {mode};
+
+        test_mul_div_against_decimal128<money>(INT64_C(1'000'000'000));
+        test_mul_div_against_decimal128<rate>(INT64_C(1'000'000'000));
+        test_mul_div_against_decimal128<fixed_decimal<0>>(INT64_C(1'000'000'000));
+
+        // Small enough that the products can not overflow
+        test_mul_div_against_decimal128<fixed_decimal<3, std::int32_t>>(INT64_C(46'000));
+    }
+}
+
+void test_mul_div_values()
+{
+    // 1.25 * 0.10 = 0.125 which is a tie
+    BOOST_TEST_EQ((money::from_scaled(125) * money::from_scaled(10)).scaled_value(), 12);
+    BOOST_TEST_EQ((money::from_scaled(135) * money::from_scaled(10)).scaled_value(), 14);
+    BOOST_TEST_EQ((money::from_scaled(-125) * money::from_scaled(10)).scaled_value(), -12);
+
+    {
+        const rounding_scope scope {rounding_mode::fe_dec_to_nearest_from_zero};
+        BOOST_TEST_EQ((money::from_scaled(125) * money::from_scaled(10)).scaled_value(), 13);
+        BOOST_TEST_EQ((money{1} / money{3}).scaled_value(), 33);
+        BOOST_TEST_EQ((money{2} / money{3}).scaled_value(), 67);
+    }
+
+    // 100.00 / 3 = 33.333...
+    BOOST_TEST_EQ((money{100} / money{3}).scaled_value(), 3333);
+    BOOST_TEST_EQ((money{100} / 3).scaled_value(), 3333);
+    BOOST_TEST_EQ((money{-100} / 3).scaled_value(), -3333);
+    BOOST_TEST_EQ((money::from_scaled(1) / 2).scaled_value(), 0);
+    BOOST_TEST_EQ((money::from_scaled(3) / 2).scaled_value(), 2);
+
+    BOOST_TEST_EQ((money::from_scaled(1999) * 3).scaled_value(), 5997);
+    BOOST_TEST_EQ((3 * money::from_scaled(1999)).scaled_value(), 5997);
+    BOOST_TEST_EQ((money{1} * money{1}).scaled_value(), 100);
+
+    auto val {money{10}};
+    val *= money::from_scaled(150);
+    BOOST_TEST_EQ(val.scaled_value(), 1500);
+    val /= money{4};
+    BOOST_TEST_EQ(val.scaled_value(), 375);
+    val *= 2;
+    BOOST_TEST_EQ(val.scaled_value(), 750);
+    val /= 3;
+    BOOST_TEST_EQ(val.scaled_value(), 250);
+}
+
+void test_conversions()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto val {random_value<money>((std::numeric_limits<std::int64_t>::max)())};
+        BOOST_TEST(money{static_cast<decimal128_t>(val)} == val);
+        BOOST_TEST(money{static_cast<decimal_fast128_t>(val)} == val);
+
+        // decimal64_t has 16 digits
+        const auto small_val {random_value<money>(INT64_C(9'999'999'999'999'999))};
+        BOOST_TEST(money{static_cast<decimal64_t>(small_val)} == small_val);
+        BOOST_TEST(money{static_cast<decimal_fast64_t>(small_val)} == small_val);
+
+        const auto smaller_val {random_value<fixed_decimal<2, std::int32_t>>(INT64_C(9'999'999))};
+        BOOST_TEST((fixed_decimal<2, std::int32_t>{static_cast<decimal32_t>(smaller_val)} == smaller_val));
+    }
+
+    BOOST_TEST_EQ(static_cast<decimal64_t>(money::from_scaled(1234)), decimal64_t(1234, -2));
+    BOOST_TEST_EQ(static_cast<decimal64_t>(money::from_scaled(-5)), decimal64_t(-5, -2));
+
+    // Values with more fractional digits are rounded in the current rounding mode
+    BOOST_TEST_EQ(money(decimal64_t(12345, -4)).scaled_value(), 123);
+    BOOST_TEST_EQ(money(decimal64_t(12355, -4)).scaled_value(), 124);
+    BOOST_TEST_EQ(money(decimal64_t(1, -20)).scaled_value(), 0);
+    BOOST_TEST_EQ(money(decimal64_t(-1, -300)).scaled_value(), 0);
+    {
+        const rounding_scope scope {rounding_mode::fe_dec_upward};
+        BOOST_TEST_EQ(money(decimal64_t(1, -20)).scaled_value(), 1);
+        BOOST_TEST_EQ(money(decimal64_t(-1, -20)).scaled_value(), 0);
+        BOOST_TEST_EQ(money(decimal64_t(12341, -4)).scaled_value(), 124);
+    }
+
+    // Values out of range saturate
+    BOOST_TEST_EQ(money(decimal64_t(1, 20)).scaled_value(), (std::numeric_limits<std::int64_t>::max)());
+    BOOST_TEST_EQ(money(decimal64_t(-1, 300)).scaled_value(), (std::numeric_limits<std::int64_t>::min)());
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    BOOST_TEST_EQ(money{std::numeric_limits<decimal64_t>::quiet_NaN()}.scaled_value(), 0);
+    BOOST_TEST_EQ(money{std::numeric_limits<decimal64_t>::infinity()}.scaled_value(), (std::numeric_limits<std::int64_t>::max)());
+    BOOST_TEST_EQ(money{-std::numeric_limits<decimal64_t>::infinity()}.scaled_value(), (std::numeric_limits<std::int64_t>::min)());
+    #endif
+}
+
+void test_comparisons()
+{
+    const auto one {money{1}};
+    const auto two {money{2}};
+
+    BOOST_TEST(one < two);
+    BOOST_TEST(one <= two);
+    BOOST_TEST(two > one);
+    BOOST_TEST(two >= one);
+    BOOST_TEST(one != two);
+    BOOST_TEST(one == money::from_scaled(100));
+
+    #ifdef BOOST_DECIMAL_HAS_SPACESHIP_OPERATOR
+    BOOST_TEST((one <=> two) == std::strong_ordering::less);
+    #endif
+}
+
+void test_output()
+{
+    BOOST_TEST_EQ(to_string(money::from_scaled(1234)), "12.34");
+    BOOST_TEST_EQ(to_string(money::from_scaled(-5)), "-0.05");
+    BOOST_TEST_EQ(to_string(money::from_scaled(50)), "0.50");
+    BOOST_TEST_EQ(to_string(money{}), "0.00");
+    BOOST_TEST_EQ(to_string(rate::from_scaled(-12345678)), "-1234.5678");
+    BOOST_TEST_EQ(to_string(fixed_decimal<0>{42}), "42");
+    BOOST_TEST_EQ(to_string(fixed_decimal<0>{}), "0");
+    BOOST_TEST_EQ(to_string(money::from_scaled((std::numeric_limits<std::int64_t>::min)())), "-92233720368547758.08");
+    BOOST_TEST_EQ(to_string(fixed_decimal<18>::from_scaled((std::numeric_limits<std::int64_t>::max)())), "9.223372036854775807");
+}
+
+void test_constexpr()
+{
+    constexpr auto price {money::from_scaled(1999)};
+    constexpr auto total {price * 3 + money{1}};
+    static_assert(total.scaled_value() == 6097, "Wrong value");
+    static_assert((price * money::from_scaled(50)).scaled_value() == 1000, "Wrong value");
+    static_assert(money(decimal64_t(25, -1)).scaled_value() == 250, "Wrong value");
+}
+
+int main()
+{
+    test_construction();
+    test_add_sub();
+    test_mul_div_values();
+    test_conversions();
+    test_comparisons();
+    test_output();
+    test_constexpr();
+
+    // Without constant evaluation detection the rounding mode can not be changed
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    test_rounding_modes();
+    #else
+    test_mul_div_against_decimal128<money>(INT64_C(1'000'000'000));
+    #endif
+
+    return boost::report_errors();
+}
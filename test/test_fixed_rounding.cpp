@@ -0,0 +1,172 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::decimal;
+
+static std::mt19937_64 rng(42);
+
+#ifdef BOOST_DECIMAL_REDUCE_TEST_DEPTH
+static constexpr std::size_t N {128};
+#else
+static constexpr std::size_t N {1024};
+#endif
+
+// Full width significands so that nearly every operation is inexact,
+// and exponents which are close enough together for the operands to interact
+template <typename T>
+auto random_value(const int exp_range) -> T
+{
+    using sig_type = typename T::significand_type;
+
+    std::uniform_int_distribution<std::uint64_t> sig_dist(1U, UINT64_C(9'999'999'999'999'999));
+    std::uniform_int_distribution<int> exp_dist(-exp_range, exp_range);
+    std::uniform_int_distribution<int> sign_dist(0, 1);
+
+    sig_type sig {static_cast<sig_type>(sig_dist(rng))};
+    BOOST_DECIMAL_IF_CONSTEXPR (std::numeric_limits<sig_type>::digits > 64)
+    {
+        sig = sig * static_cast<sig_type>(UINT64_C(1'000'000'000'000'000'000)) + static_cast<sig_type>(sig_dist(rng));
+    }
+
+    return T{sig, exp_dist(rng), sign_dist(rng) == 1};
+}
+
+template <rounding_mode Mode, typename T>
+void test_against_fesetround(const T& lhs, const T& rhs)
+{
+    const auto previous {boost::decimal::fesetround(Mode)};
+
+    const T dynamic_add {lhs + rhs};
+    const T dynamic_sub {lhs - rhs};
+    const T dynamic_mul {lhs * rhs};
+    const T dynamic_div {lhs / rhs};
+
+    // The fixed policy must not depend on the current mode
+    boost::decimal::fesetround(Mode == rounding_mode::fe_dec_upward ? rounding_mode::fe_dec_downward : rounding_mode::fe_dec_upward);
+
+    const T fixed_add {add<Mode>(lhs, rhs)};
+    const T fixed_sub {sub<Mode>(lhs, rhs)};
+    const T fixed_mul {mul<Mode>(lhs, rhs)};
+    const T fixed_div {div<Mode>(lhs, rhs)};
+
+    boost::decimal::fesetround(previous);
+
+    if (!BOOST_TEST(to_bits(dynamic_add) == to_bits(fixed_add)) ||
+        !BOOST_TEST(to_bits(dynamic_sub) == to_bits(fixed_sub)) ||
+        !BOOST_TEST(to_bits(dynamic_mul) == to_bits(fixed_mul)) ||
+        !BOOST_TEST(to_bits(dynamic_div) == to_bits(fixed_div)))
+    {
+        // LCOV_EXCL_START
+        std::cerr << "Mode: " << static_cast<int>(Mode)
+                  << "\nLHS: " << lhs
+                  << "\nRHS: " << rhs << std::endl;
+        // LCOV_EXCL_STOP
+    }
+}
+
+template <typename T>
+void test_all_modes(const T& lhs, const T& rhs)
+{
+    test_against_fesetround<rounding_mode::fe_dec_downward>(lhs, rhs);
+    test_against_fesetround<rounding_mode::fe_dec_to_nearest>(lhs, rhs);
+    test_against_fesetround<rounding_mode::fe_dec_to_nearest_from_zero>(lhs, rhs);
+    test_against_fesetround<rounding_mode::fe_dec_toward_zero>(lhs, rhs);
+    test_against_fesetround<rounding_mode::fe_dec_upward>(lhs, rhs);
+}
+
+template <typename T>
+void test_random()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        // Overlapping operands exercise the rounding of the smaller addend
+        test_all_modes(random_value<T>(5), random_value<T>(5));
+        test_all_modes(random_value<T>(std::numeric_limits<T>::digits10), random_value<T>(std::numeric_limits<T>::digits10));
+    }
+}
+
+template <typename T>
+void test_boundaries()
+{
+    const T values[] = {
+        std::numeric_limits<T>::max(),
+        std::numeric_limits<T>::lowest(),
+        std::numeric_limits<T>::min(),
+        std::numeric_limits<T>::denorm_min(),
+        std::numeric_limits<T>::epsilon(),
+        std::numeric_limits<T>::infinity(),
+        -std::numeric_limits<T>::infinity(),
+        std::numeric_limits<T>::quiet_NaN(),
+        T{0},
+        T{1},
+        T{-1},
+        T{3},
+        T{7, -1},
+    };
+
+    for (const auto& lhs : values)
+    {
+        for (const auto& rhs : values)
+        {
+            test_all_modes(lhs, rhs);
+        }
+
+        test_all_modes(lhs, random_value<T>(3));
+    }
+}
+
+template <typename T>
+void test_values()
+{
+    constexpr T one {1};
+    constexpr T three {3};
+
+    BOOST_TEST_EQ(div<rounding_mode::fe_dec_downward>(one, three), div<rounding_mode::fe_dec_toward_zero>(one, three));
+    BOOST_TEST_EQ(div<rounding_mode::fe_dec_upward>(-one, three), div<rounding_mode::fe_dec_toward_zero>(-one, three));
+    BOOST_TEST_EQ(add<rounding_mode::fe_dec_upward>(one, three), T{4});
+}
+
+void test_constexpr()
+{
+    // The fixed mode is honored during constant evaluation as well
+    constexpr decimal32_t one {1};
+    constexpr decimal32_t three {3};
+    constexpr decimal32_t down {div<rounding_mode::fe_dec_downward>(one, three)};
+    constexpr decimal32_t up {div<rounding_mode::fe_dec_upward>(one, three)};
+
+    static_assert(down == decimal32_t{3'333'333, -7}, "Wrong rounding");
+    static_assert(up == decimal32_t{3'333'334, -7}, "Wrong rounding");
+}
+
+int main()
+{
+    // Without constant evaluation detection fesetround has no effect, so there is nothing to compare against
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+
+    test_random<decimal32_t>();
+    test_random<decimal64_t>();
+    test_random<decimal128_t>();
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    test_boundaries<decimal32_t>();
+    test_boundaries<decimal64_t>();
+    test_boundaries<decimal128_t>();
+    #endif
+
+    #endif
+
+    test_values<decimal32_t>();
+    test_values<decimal64_t>();
+    test_values<decimal128_t>();
+
+    test_constexpr();
+
+    return boost::report_errors();
+}
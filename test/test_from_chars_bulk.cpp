@@ -0,0 +1,255 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace boost::decimal;
+
+static std::mt19937_64 rng(42);
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024U); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024U >> 4U); // Number of trials
+#endif
+
+#if !defined(BOOST_DECIMAL_DISABLE_CLIB)
+
+// Every field has to parse to exactly what from_chars gives for it on its own
+template <typename T>
+void test_round_trip(const char delimiter)
+{
+    std::uniform_int_distribution<std::int64_t> sig_dist(-9'999'999'999'999'999, 9'999'999'999'999'999);
+    std::uniform_int_distribution<int> exp_dist(-20, 20);
+
+    std::vector<T> expected(N);
+    std::string buffer;
+    for (auto& val : expected)
+    {
+        val = T{sig_dist(rng), exp_dist(rng)};
+
+        char field[64] {};
+        const auto r {to_chars(field, field + sizeof(field), val)};
+        BOOST_TEST(r);
+        buffer.append(field, r.ptr);
+        buffer.push_back(delimiter);
+    }
+
+    const char delimiters[] {delimiter, '\0'};
+    std::vector<T> values(N);
+
+    const auto res {from_chars_bulk(buffer.data(), buffer.data() + buffer.size(), values.data(), values.size(), delimiters)};
+    BOOST_TEST(res);
+    BOOST_TEST_EQ(res.count, N);
+    BOOST_TEST_EQ(res.error_count, 0U);
+    BOOST_TEST_EQ(res.first_error, N);
+    BOOST_TEST(res.ptr == buffer.data() + buffer.size());
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST_EQ(values[i], expected[i]);
+    }
+}
+
+template <typename T>
+void test_delimiters()
+{
+    const char buffer[] {"1.5,2.25\n-3e2\r\n4,5"};
+    T values[8] {};
+
+    const auto res {from_chars_bulk(buffer, buffer + std::strlen(buffer), values, 8U)};
+    BOOST_TEST(res);
+    BOOST_TEST_EQ(res.count, 5U);
+    BOOST_TEST_EQ(values[0], T(15, -1));
+    BOOST_TEST_EQ(values[1], T(225, -2));
+    BOOST_TEST_EQ(values[2], T(-3, 2));
+    BOOST_TEST_EQ(values[3], T(4));
+    BOOST_TEST_EQ(values[4], T(5));
+
+    // Caller supplied delimiter set
+    const char pipes[] {"1|2;3|nan"};
+    const auto pipe_res {from_chars_bulk(pipes, pipes + std::strlen(pipes), values, 8U, "|;")};
+    BOOST_TEST(pipe_res);
+    BOOST_TEST_EQ(pipe_res.count, 4U);
+    BOOST_TEST_EQ(values[2], T(3));
+    BOOST_TEST(isnan(values[3]));
+
+    // Fixed format rejects exponents
+    const char fixed[] {"1.5\n1e5\n"};
+    const auto fixed_res {from_chars_bulk(fixed, fixed + std::strlen(fixed), values, 8U, "\n", chars_format::fixed)};
+    BOOST_TEST(!fixed_res);
+    BOOST_TEST_EQ(fixed_res.count, 2U);
+    BOOST_TEST_EQ(fixed_res.first_error, 1U);
+}
+
+template <typename T>
+void test_errors()
+{
+    // Fields 1 (trailing characters), 3 (empty), 4 (not a number), and 6 (exponent out of range) are errors
+    const char buffer[] {"1,2x,3,,abc,6,1e9999999999"};
+    T values[8] {};
+    std::uint64_t error_bits[1] {~UINT64_C(0)};
+
+    const auto res {from_chars_bulk(buffer, buffer + std::strlen(buffer), values, 8U, ",", chars_format::general, error_bits)};
+    BOOST_TEST(!res);
+    BOOST_TEST_EQ(res.count, 7U);
+    BOOST_TEST_EQ(res.error_count, 4U);
+    BOOST_TEST_EQ(res.first_error, 1U);
+    BOOST_TEST(res.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(error_bits[0] & UINT64_C(0b1111111), UINT64_C(0b1011010));
+
+    // Only the bits of the fields that were parsed are written
+    BOOST_TEST_EQ(error_bits[0] >> 7U, ~UINT64_C(0) >> 7U);
+
+    BOOST_TEST_EQ(values[0], T(1));
+    BOOST_TEST(issignaling(values[1]));
+    BOOST_TEST_EQ(values[2], T(3));
+    BOOST_TEST(issignaling(values[3]));
+    BOOST_TEST(issignaling(values[4]));
+    BOOST_TEST_EQ(values[5], T(6));
+    BOOST_TEST(isnan(values[6]));
+
+    const char range[] {"1e9999999999,2"};
+    const auto range_res {from_chars_bulk(range, range + std::strlen(range), values, 8U)};
+    BOOST_TEST(range_res.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(range_res.first_error, 0U);
+    BOOST_TEST_EQ(values[1], T(2));
+}
+
+template <typename T>
+void test_output_full()
+{
+    // Parsing stops once the output is full, and ptr points at the next field
+    const char buffer[] {"1\n2\n3\n4\n"};
+    T values[2] {};
+
+    const auto res {from_chars_bulk(buffer, buffer + std::strlen(buffer), values, 2U)};
+    BOOST_TEST(res);
+    BOOST_TEST_EQ(res.count, 2U);
+    BOOST_TEST(res.ptr == buffer + 4);
+
+    const auto rest {from_chars_bulk(res.ptr, buffer + std::strlen(buffer), values, 2U)};
+    BOOST_TEST_EQ(rest.count, 2U);
+    BOOST_TEST_EQ(values[0], T(3));
+    BOOST_TEST_EQ(values[1], T(4));
+    BOOST_TEST(rest.ptr == buffer + std::strlen(buffer));
+
+    // Nothing to parse
+    const auto empty {from_chars_bulk(buffer, buffer, values, 2U)};
+    BOOST_TEST(empty);
+    BOOST_TEST_EQ(empty.count, 0U);
+    BOOST_TEST(empty.ptr == buffer);
+}
+
+template <typename T>
+void test_chunks()
+{
+    // The second field is split across the chunks, so it is left for the next call
+    const std::string stream {"1.5,-42.125\r\n7"};
+    const std::size_t split {7U};
+    T values[4] {};
+
+    const auto first_res {from_chars_bulk(stream.data(), stream.data() + split, values, 4U, ",\r\n", chars_format::general, nullptr, false)};
+    BOOST_TEST(first_res);
+    BOOST_TEST_EQ(first_res.count, 1U);
+    BOOST_TEST(first_res.ptr == stream.data() + 4);
+    BOOST_TEST_EQ(values[0], T(15, -1));
+
+    std::string chunk {first_res.ptr, stream.data() + split};
+    chunk.append(stream, split, std::string::npos);
+
+    const auto second_res {from_chars_bulk(chunk.data(), chunk.data() + chunk.size(), values + 1, 3U)};
+    BOOST_TEST(second_res);
+    BOOST_TEST_EQ(second_res.count, 2U);
+    BOOST_TEST(second_res.ptr == chunk.data() + chunk.size());
+    BOOST_TEST_EQ(values[1], T(-42125, -3));
+    BOOST_TEST_EQ(values[2], T(7));
+
+    // A \r at the end of a chunk may be followed by \n in the next one, so it does not end the field yet
+    const char crlf[] {"3\r\n4"};
+    const auto crlf_res {from_chars_bulk(crlf, crlf + 2, values, 4U, ",\r\n", chars_format::general, nullptr, false)};
+    BOOST_TEST_EQ(crlf_res.count, 0U);
+    BOOST_TEST(crlf_res.ptr == crlf);
+
+    const auto rest_res {from_chars_bulk(crlf, crlf + std::strlen(crlf), values, 4U, ",\r\n", chars_format::general, nullptr, false)};
+    BOOST_TEST(rest_res);
+    BOOST_TEST_EQ(rest_res.count, 1U);
+    BOOST_TEST(rest_res.ptr == crlf + 3);
+    BOOST_TEST_EQ(values[0], T(3));
+
+    // A chunk that ends on a delimiter is consumed entirely
+    const char ended[] {"5,6\n"};
+    const auto ended_res {from_chars_bulk(ended, ended + std::strlen(ended), values, 4U, ",\r\n", chars_format::general, nullptr, false)};
+    BOOST_TEST(ended_res);
+    BOOST_TEST_EQ(ended_res.count, 2U);
+    BOOST_TEST(ended_res.ptr == ended + std::strlen(ended));
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+template <typename T>
+void test_span()
+{
+    std::vector<T> values(70U);
+    std::vector<std::uint64_t> error_bits(2U);
+
+    std::string buffer;
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        buffer += (i == 65U ? std::string("?") : std::to_string(i));
+        buffer += '\n';
+    }
+
+    const auto res {from_chars_bulk<T>(buffer, values, "\n", chars_format::general, error_bits)};
+    BOOST_TEST_EQ(res.count, values.size());
+    BOOST_TEST_EQ(res.error_count, 1U);
+    BOOST_TEST_EQ(res.first_error, 65U);
+    BOOST_TEST_EQ(error_bits[0], UINT64_C(0));
+    BOOST_TEST_EQ(error_bits[1], UINT64_C(0b10));
+    BOOST_TEST_EQ(values[69], T(69));
+}
+
+#endif
+
+template <typename T>
+void test()
+{
+    test_round_trip<T>('\n');
+    test_round_trip<T>(',');
+    test_delimiters<T>();
+    test_errors<T>();
+    test_output_full<T>();
+    test_chunks<T>();
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+    test_span<T>();
+    #endif
+}
+
+int main()
+{
+    test<decimal32_t>();
+    test<decimal64_t>();
+    test<decimal128_t>();
+    test<decimal_fast32_t>();
+    test<decimal_fast64_t>();
+    test<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,229 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <vector>
+#include <cstdint>
+
+using namespace boost::decimal;
+
+static std::mt19937_64 rng(42);
+
+#ifdef BOOST_DECIMAL_REDUCE_TEST_DEPTH
+static constexpr std::size_t N {128};
+#else
+static constexpr std::size_t N {1024};
+#endif
+
+// Values with few enough digits that the exact results below fit in the 34 digits of decimal128_t
+template <typename T>
+auto random_value(const std::uint64_t max_sig, const int max_exp) -> T
+{
+    std::uniform_int_distribution<std::uint64_t> sig_dist(0U, max_sig);
+    std::uniform_int_distribution<int> exp_dist(-max_exp, max_exp);
+    std::uniform_int_distribution<int> sign_dist(0, 1);
+
+    return T{sig_dist(rng), exp_dist(rng), sign_dist(rng) == 1};
+}
+
+// Rounds the exact value to the precision of T in the current rounding mode
+template <typename T>
+auto round_exact(const decimal128_t exact) -> T
+{
+    if (exact == 0)
+    {
+        return T{0};
+    }
+
+    int exp {};
+    auto sig {frexp10(exact, &exp)};
+    const bool is_neg {signbit(exact)};
+
+    const auto removed {std::numeric_limits<decimal128_t>::digits10 - std::numeric_limits<T>::digits10};
+    boost::int128::uint128_t divisor {1U};
+    for (int i {}; i < removed; ++i)
+    {
+        divisor *= 10U;
+    }
+
+    const auto remainder {sig % divisor};
+    sig /= divisor;
+
+    bool round_up {};
+    switch (boost::decimal::fegetround())
+    {
+        case rounding_mode::fe_dec_downward:
+            round_up = is_neg && remainder != 0U;
+            break;
+        case rounding_mode::fe_dec_upward:
+            round_up = !is_neg && remainder != 0U;
+            break;
+        case rounding_mode::fe_dec_toward_zero:
+            break;
+        case rounding_mode::fe_dec_to_nearest_from_zero:
+            round_up = remainder >= divisor / 2U;
+            break;
+        default:
+            round_up = remainder > divisor / 2U || (remainder == divisor / 2U && sig % 2U == 1U);
+            break;
+    }
+
+    if (round_up)
+    {
+        ++sig;
+    }
+
+    return T{sig, exp + removed, is_neg};
+}
+
+// a * b + c and a * b + c * d are exact before the final rounding, so must be correctly rounded
+template <typename T>
+void test_correct_rounding(const std::uint64_t max_sig, const int max_exp)
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto a {random_value<T>(max_sig, max_exp)};
+        const auto b {random_value<T>(max_sig, max_exp)};
+        const auto c {random_value<T>(max_sig, max_exp)};
+        const auto d {random_value<T>(max_sig, max_exp)};
+
+        const auto wide_a {static_cast<decimal128_t>(a)};
+        const auto wide_b {static_cast<decimal128_t>(b)};
+        const auto wide_c {static_cast<decimal128_t>(c)};
+        const auto wide_d {static_cast<decimal128_t>(d)};
+
+        const T fma_like {fused(a) * b + c};
+        BOOST_TEST_EQ(fma_like, round_exact<T>(wide_a * wide_b + wide_c));
+
+        const T dot {fused(a) * b + fused(c) * d};
+        BOOST_TEST_EQ(dot, round_exact<T>(wide_a * wide_b + wide_c * wide_d));
+
+        const T difference {fused(a) * b - c * fused(d)};
+        BOOST_TEST_EQ(difference, round_exact<T>(wide_a * wide_b - wide_c * wide_d));
+
+        const T negated {-(fused(a) - b)};
+        BOOST_TEST_EQ(negated, round_exact<T>(wide_b - wide_a));
+    }
+}
+
+// Evaluating a * b + c * d - e operator by operator rounds three times
+template <typename T>
+void test_accuracy(const std::uint64_t max_sig, const int max_exp)
+{
+    std::size_t fused_exact {};
+    std::size_t rounded_exact {};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto a {random_value<T>(max_sig, max_exp)};
+        const auto b {random_value<T>(max_sig, max_exp)};
+        const auto c {random_value<T>(max_sig, max_exp)};
+        const auto d {random_value<T>(max_sig, max_exp)};
+        const auto e {random_value<T>(max_sig, max_exp)};
+
+        const auto expected {round_exact<T>(static_cast<decimal128_t>(a) * static_cast<decimal128_t>(b) +
+                                            static_cast<decimal128_t>(c) * static_cast<decimal128_t>(d) -
+                                            static_cast<decimal128_t>(e))};
+
+        const T fused_result {fused(a) * b + fused(c) * d - e};
+        fused_exact += static_cast<std::size_t>(fused_result == expected);
+        rounded_exact += static_cast<std::size_t>(a * b + c * d - e == expected);
+    }
+
+    BOOST_TEST_EQ(fused_exact, N);
+    BOOST_TEST_LT(rounded_exact, N);
+}
+
+template <typename T>
+void test_special_values()
+{
+    const T one {1};
+    const T two {2};
+
+    // Chains of every operator, and expressions kept as objects
+    const auto expr {(fused(two) * two + one) * (fused(one) - two) - -fused(two)};
+    BOOST_TEST_EQ(expr.value(), T{-3});
+    BOOST_TEST_EQ(static_cast<T>(+expr), T{-3});
+    BOOST_TEST_EQ(static_cast<T>(fused(one)), one);
+    BOOST_TEST_EQ(static_cast<T>(one - fused(one)), T{0});
+    BOOST_TEST(!signbit(static_cast<T>(one - fused(one))));
+    BOOST_TEST(signbit(static_cast<T>(-fused(T{0}) + -T{0})));
+
+    // The largest value survives an intermediate result that would overflow
+    const auto max {std::numeric_limits<T>::max()};
+    BOOST_TEST_EQ(static_cast<T>(fused(max) * two - max), max);
+
+    // Results in the subnormal range are rounded once
+    const auto denorm_min {std::numeric_limits<T>::denorm_min()};
+    const auto subnormal_sum {static_cast<T>(fused(denorm_min) * T{5, -1} + fused(denorm_min) * T{6, -1})};
+    if (denorm_min < std::numeric_limits<T>::min())
+    {
+        BOOST_TEST_EQ(subnormal_sum, denorm_min);
+    }
+    else
+    {
+        BOOST_TEST_GT(subnormal_sum, denorm_min);
+    }
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    const auto inf {std::numeric_limits<T>::infinity()};
+    const auto nan {std::numeric_limits<T>::quiet_NaN()};
+    BOOST_TEST(isinf(static_cast<T>(fused(max) * two)));
+    BOOST_TEST(isinf(static_cast<T>(fused(inf) * two + one)));
+    BOOST_TEST(isnan(static_cast<T>(fused(nan) * two)));
+
+    // Expressions with non-finite operands give the same results as the operators
+    BOOST_TEST_EQ(isnan(static_cast<T>(fused(inf) - inf)), isnan(inf - inf));
+    BOOST_TEST_EQ(isnan(static_cast<T>(fused(inf) * T{0})), isnan(inf * T{0}));
+    #endif
+}
+
+constexpr auto constexpr_price() noexcept -> decimal64_t
+{
+    const decimal64_t quantity {3};
+    const decimal64_t price {1999, -2};
+    const decimal64_t fee {25, -2};
+
+    return fused(quantity) * price - fee;
+}
+
+template <typename T>
+void test_type(const std::uint64_t max_sig, const int max_exp, const std::uint64_t long_max_sig, const int long_max_exp)
+{
+    test_correct_rounding<T>(max_sig, max_exp);
+    test_accuracy<T>(long_max_sig, long_max_exp);
+    test_special_values<T>();
+}
+
+template <typename T>
+void test_rounding_modes(const std::uint64_t max_sig, const int max_exp)
+{
+    for (const auto mode : {rounding_mode::fe_dec_downward, rounding_mode::fe_dec_to_nearest, rounding_mode::fe_dec_to_nearest_from_zero,
+                            rounding_mode::fe_dec_toward_zero, rounding_mode::fe_dec_upward})
+    {
+        const rounding_scope scope {mode};
+        test_correct_rounding<T>(max_sig, max_exp);
+    }
+}
+
+int main()
+{
+    // The exact results span at most 34 digits, and the products have more digits than T
+    test_type<decimal32_t>(UINT64_C(9'999'999), 4, UINT64_C(9'999'999), 3);
+    test_type<decimal_fast32_t>(UINT64_C(9'999'999), 4, UINT64_C(9'999'999), 3);
+    test_type<decimal64_t>(UINT64_C(99'999'999), 4, UINT64_C(999'999'999), 2);
+    test_type<decimal_fast64_t>(UINT64_C(99'999'999), 4, UINT64_C(999'999'999), 2);
+
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    test_rounding_modes<decimal32_t>(UINT64_C(9'999'999), 4);
+    test_rounding_modes<decimal64_t>(UINT64_C(99'999'999), 4);
+    #endif
+
+    static_assert(constexpr_price() == decimal64_t{5972, -2}, "Wrong value");
+
+    return boost::report_errors();
+}
@@ -1,8 +1,6 @@
 // Copyright 2023 Matt Borland
 // Distributed under the Boost Software License, Version 1.0.
 // https://www.boost.org/LICENSE_1_0.txt
-//
-// This is a toy example to make sure that the hashing compiles correctly
 
 #include <boost/decimal/decimal32_t.hpp>
 #include <boost/decimal/decimal64_t.hpp>
@@ -14,6 +12,9 @@
 #include <boost/decimal/iostream.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include <functional>
+#include <limits>
+#include <random>
+#include <unordered_set>
 
 template <typename T>
 void test_hash()
@@ -26,6 +27,58 @@ void test_hash()
     }
 }
 
+// Members of the same cohort compare equal, so they have to hash the same
+template <typename T>
+void test_cohorts()
+{
+    std::hash<T> hasher;
+
+    BOOST_TEST_EQ(hasher(T{1}), hasher(T{10, -1}));
+    BOOST_TEST_EQ(hasher(T{1}), hasher(T{1000, -3}));
+    BOOST_TEST_EQ(hasher(T{-25, 3}), hasher(T{-2500, 1}));
+    BOOST_TEST_EQ(hasher(T{0}), hasher(T{0, 50}));
+    BOOST_TEST_EQ(hasher(T{0}), hasher(-T{0}));
+
+    BOOST_TEST_NE(hasher(T{1}), hasher(T{-1}));
+    BOOST_TEST_NE(hasher(T{1}), hasher(T{1, 1}));
+    BOOST_TEST_NE(hasher(T{1}), hasher(T{11, -1}));
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    BOOST_TEST_NE(hasher(std::numeric_limits<T>::infinity()), hasher(-std::numeric_limits<T>::infinity()));
+    #endif
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<std::uint32_t> sig_dist(1U, 999'999U);
+    std::uniform_int_distribution<int> exp_dist(-50, 50);
+
+    std::unordered_set<T> set;
+    for (int i {}; i < 1000; ++i)
+    {
+        const auto sig {sig_dist(rng)};
+        const auto exp {exp_dist(rng)};
+
+        set.insert(T{sig, exp});
+
+        // Lookups succeed with any member of the cohort
+        BOOST_TEST(set.find(T{sig * 10U, exp - 1}) != set.end());
+        BOOST_TEST_EQ(hasher(T{sig, exp}), hasher(T{sig * 10U, exp - 1}));
+    }
+}
+
+template <typename T, typename FastT>
+void test_fast_matches()
+{
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<std::uint32_t> sig_dist(0U, 9'999'999U);
+    std::uniform_int_distribution<int> exp_dist(-50, 50);
+
+    for (int i {}; i < 1000; ++i)
+    {
+        const T val {sig_dist(rng), exp_dist(rng)};
+        BOOST_TEST_EQ(std::hash<T>{}(val), std::hash<FastT>{}(static_cast<FastT>(val)));
+    }
+}
+
 int main()
 {
     test_hash<boost::decimal::decimal32_t>();
@@ -35,5 +88,16 @@ int main()
     test_hash<boost::decimal::decimal_fast64_t>();
     test_hash<boost::decimal::decimal_fast128_t>();
 
+    test_cohorts<boost::decimal::decimal32_t>();
+    test_cohorts<boost::decimal::decimal64_t>();
+    test_cohorts<boost::decimal::decimal128_t>();
+    test_cohorts<boost::decimal::decimal_fast32_t>();
+    test_cohorts<boost::decimal::decimal_fast64_t>();
+    test_cohorts<boost::decimal::decimal_fast128_t>();
+
+    test_fast_matches<boost::decimal::decimal32_t, boost::decimal::decimal_fast32_t>();
+    test_fast_matches<boost::decimal::decimal64_t, boost::decimal::decimal_fast64_t>();
+    test_fast_matches<boost::decimal::decimal128_t, boost::decimal::decimal_fast128_t>();
+
     return boost::report_errors();
 }
@@ -0,0 +1,141 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <cstdint>
+
+using namespace boost::decimal;
+using detail::num_digits;
+using detail::u256;
+
+static std::mt19937_64 rng(42);
+
+#ifdef BOOST_DECIMAL_REDUCE_TEST_DEPTH
+static constexpr std::size_t N {128};
+#else
+static constexpr std::size_t N {1024};
+#endif
+
+static_assert(num_digits(UINT32_C(0)) == 1, "Zero has one digit");
+static_assert(num_digits(UINT32_C(4294967295)) == 10, "Wrong number of digits");
+static_assert(num_digits(UINT64_C(9999999999999999999)) == 19, "Wrong number of digits");
+static_assert(num_digits(UINT64_C(18446744073709551615)) == 20, "Wrong number of digits");
+static_assert(num_digits(boost::int128::uint128_t{UINT64_MAX, UINT64_MAX}) == 39, "Wrong number of digits");
+
+// Counts the digits the slow way, treating zero as one digit like num_digits does
+template <typename T>
+auto reference_digits(T x) -> int
+{
+    int digits {1};
+    while (x >= T{10U})
+    {
+        x = x / T{10U};
+        ++digits;
+    }
+
+    return digits;
+}
+
+auto random_u64() -> std::uint64_t
+{
+    std::uniform_int_distribution<int> width_dist(1, 64);
+    const auto width {width_dist(rng)};
+    return width == 64 ? rng() : rng() & ((UINT64_C(1) << width) - 1U);
+}
+
+// Every power of ten, one less than it, and the powers of two on either side of it
+template <typename T>
+void test_boundaries(const int max_digits, const int bits)
+{
+    T power {1U};
+    for (int i {1}; i <= max_digits; ++i)
+    {
+        BOOST_TEST_EQ(num_digits(power), i);
+        if (i > 1)
+        {
+            BOOST_TEST_EQ(num_digits(static_cast<T>(power - 1U)), i - 1);
+        }
+
+        if (i < max_digits)
+        {
+            power = static_cast<T>(power * 10U);
+        }
+    }
+
+    T pow2 {1U};
+    for (int i {}; i < bits; ++i)
+    {
+        BOOST_TEST_EQ(num_digits(pow2), reference_digits(pow2));
+        BOOST_TEST_EQ(num_digits(static_cast<T>(pow2 - 1U)), reference_digits(static_cast<T>(pow2 - 1U)));
+        pow2 = static_cast<T>(pow2 * 2U);
+    }
+
+    BOOST_TEST_EQ(num_digits(static_cast<T>(pow2 - 1U)), max_digits);
+}
+
+void test_random()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto word {random_u64()};
+        BOOST_TEST_EQ(num_digits(word), reference_digits(word));
+
+        const auto half {static_cast<std::uint32_t>(word)};
+        BOOST_TEST_EQ(num_digits(half), reference_digits(half));
+
+        const boost::int128::uint128_t wide {i % 2U == 0U ? random_u64() : UINT64_C(0), random_u64()};
+        BOOST_TEST_EQ(num_digits(wide), reference_digits(wide));
+
+        #ifdef BOOST_DECIMAL_HAS_INT128
+        const auto builtin {static_cast<detail::builtin_uint128_t>(wide)};
+        BOOST_TEST_EQ(num_digits(builtin), num_digits(wide));
+        #endif
+
+        u256 big {};
+        const auto words {i % 4U + 1U};
+        for (std::size_t j {}; j < words; ++j)
+        {
+            big[j] = j == words - 1U ? random_u64() : rng();
+        }
+        BOOST_TEST_EQ(num_digits(big), reference_digits(big));
+    }
+}
+
+void test_u256_boundaries()
+{
+    for (int i {1}; i <= 78; ++i)
+    {
+        const auto power {detail::impl::u256_pow_10[i - 1]};
+        BOOST_TEST_EQ(num_digits(power), i);
+
+        // 10^k - 1 by decrementing through the words
+        auto below {power};
+        for (std::size_t j {}; j < 4U && below[j]-- == 0U; ++j)
+        {
+        }
+
+        if (i > 1)
+        {
+            BOOST_TEST_EQ(num_digits(below), i - 1);
+        }
+    }
+
+    BOOST_TEST_EQ(num_digits(u256{UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}), 78);
+    BOOST_TEST_EQ(num_digits(u256{}), 1);
+}
+
+int main()
+{
+    test_boundaries<std::uint32_t>(10, 32);
+    test_boundaries<std::uint64_t>(20, 64);
+    test_boundaries<boost::int128::uint128_t>(39, 128);
+
+    test_u256_boundaries();
+    test_random();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,242 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <random>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+using namespace boost::decimal;
+
+static std::mt19937_64 rng(42);
+
+#ifdef BOOST_DECIMAL_REDUCE_TEST_DEPTH
+static constexpr std::size_t N {128};
+#else
+static constexpr std::size_t N {1024};
+#endif
+
+// Spans the whole exponent range, including the subnormals
+template <typename T>
+auto random_value() -> T
+{
+    // Short significands produce values with many members in their cohort
+    std::uniform_int_distribution<int> digits_dist(0, (std::min)(std::numeric_limits<T>::digits10, 16));
+    std::uniform_int_distribution<std::uint64_t> sig_dist(0U, detail::pow10(static_cast<std::uint64_t>(digits_dist(rng))) - 1U);
+    std::uniform_int_distribution<int> exp_dist(std::numeric_limits<T>::min_exponent10 - std::numeric_limits<T>::digits10,
+                                                std::numeric_limits<T>::max_exponent10 - std::numeric_limits<T>::digits10);
+    std::uniform_int_distribution<int> sign_dist(0, 1);
+
+    return T{sig_dist(rng), exp_dist(rng), sign_dist(rng) == 1};
+}
+
+template <typename T>
+void test_round_trip()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const T val {random_value<T>()};
+        const auto key {to_ordered_key(val)};
+        const T return_val {from_ordered_key<T>(key)};
+
+        if (!BOOST_TEST_EQ(val, return_val) || !BOOST_TEST_EQ(signbit(val), signbit(return_val)))
+        {
+            // LCOV_EXCL_START
+            std::cerr << "Value: " << val
+                      << "\nReturned: " << return_val << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    }
+}
+
+template <typename T>
+void test_order()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const T lhs {random_value<T>()};
+        const T rhs {random_value<T>()};
+
+        const auto lhs_key {to_ordered_key(lhs)};
+        const auto rhs_key {to_ordered_key(rhs)};
+
+        // The keys order -0 below +0 even though the values compare equal
+        const bool signed_zeros {lhs == T{0} && rhs == T{0} && signbit(lhs) != signbit(rhs)};
+        const bool expected_less {signed_zeros ? signbit(lhs) : lhs < rhs};
+        const bool expected_equal {lhs == rhs && !signed_zeros};
+
+        if (!BOOST_TEST_EQ(expected_less, lhs_key < rhs_key) ||
+            !BOOST_TEST_EQ(expected_equal, lhs_key == rhs_key))
+        {
+            // LCOV_EXCL_START
+            std::cerr << "LHS: " << lhs
+                      << "\nRHS: " << rhs << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    }
+}
+
+template <typename T>
+void test_sorted()
+{
+    std::vector<T> values;
+    for (std::size_t i {}; i < N; ++i)
+    {
+        values.emplace_back(random_value<T>());
+    }
+
+    auto by_key {values};
+    std::sort(values.begin(), values.end());
+    std::sort(by_key.begin(), by_key.end(), [](const T& lhs, const T& rhs) { return to_ordered_key(lhs) < to_ordered_key(rhs); });
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST_EQ(values[i], by_key[i]);
+    }
+}
+
+template <typename T>
+void test_cohorts()
+{
+    // 1, 1.0, 1.00, ... all map to the same key
+    const auto one_key {to_ordered_key(T{1})};
+    typename T::significand_type sig {1};
+    for (int i {}; i < std::numeric_limits<T>::digits10; ++i)
+    {
+        BOOST_TEST(to_ordered_key(T{sig, -i}) == one_key);
+        sig *= 10U;
+    }
+
+    // Zeros of any exponent are the same zero
+    BOOST_TEST(to_ordered_key(T{0, 10}) == to_ordered_key(T{0}));
+    BOOST_TEST(to_ordered_key(T{0U, -10, true}) == to_ordered_key(-T{0}));
+}
+
+template <typename T>
+void test_special_values()
+{
+    constexpr auto key_max {(std::numeric_limits<decltype(to_ordered_key(T{}))>::max)()};
+
+    const auto pos_zero {to_ordered_key(T{0})};
+    const auto neg_zero {to_ordered_key(-T{0})};
+
+    BOOST_TEST(neg_zero < pos_zero);
+    BOOST_TEST(neg_zero + 1U == pos_zero);
+    BOOST_TEST(pos_zero == key_max / 2U + 1U);
+    BOOST_TEST(signbit(from_ordered_key<T>(neg_zero)));
+    BOOST_TEST(!signbit(from_ordered_key<T>(pos_zero)));
+
+    const auto denorm_min {to_ordered_key(std::numeric_limits<T>::denorm_min())};
+    BOOST_TEST(denorm_min > pos_zero);
+    BOOST_TEST(to_ordered_key(-std::numeric_limits<T>::denorm_min()) < neg_zero);
+    BOOST_TEST(to_ordered_key(std::numeric_limits<T>::min()) >= denorm_min);
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    const auto max {to_ordered_key(std::numeric_limits<T>::max())};
+    const auto inf {to_ordered_key(std::numeric_limits<T>::infinity())};
+    const auto snan {to_ordered_key(std::numeric_limits<T>::signaling_NaN())};
+    const auto qnan {to_ordered_key(std::numeric_limits<T>::quiet_NaN())};
+
+    BOOST_TEST(max < inf);
+    BOOST_TEST(inf < snan);
+    BOOST_TEST(snan < qnan);
+    BOOST_TEST(to_ordered_key(-std::numeric_limits<T>::infinity()) < to_ordered_key(std::numeric_limits<T>::lowest()));
+    BOOST_TEST(to_ordered_key(-std::numeric_limits<T>::quiet_NaN()) < to_ordered_key(-std::numeric_limits<T>::infinity()));
+
+    BOOST_TEST(isinf(from_ordered_key<T>(inf)));
+    BOOST_TEST(issignaling(from_ordered_key<T>(snan)));
+    BOOST_TEST(isnan(from_ordered_key<T>(qnan)) && !issignaling(from_ordered_key<T>(qnan)));
+    BOOST_TEST(signbit(from_ordered_key<T>(to_ordered_key(-std::numeric_limits<T>::quiet_NaN()))));
+    BOOST_TEST_EQ(from_ordered_key<T>(max), std::numeric_limits<T>::max());
+    #endif
+}
+
+// Stored big endian the keys sort correctly with memcmp, e.g. as keys of a B-tree
+template <typename T>
+void test_memcmp()
+{
+    std::uint8_t lhs_bytes[8] {};
+    std::uint8_t rhs_bytes[8] {};
+
+    const auto to_bytes = [](const std::uint64_t key, std::uint8_t* bytes)
+    {
+        for (int i {7}; i >= 0; --i)
+        {
+            bytes[i] = static_cast<std::uint8_t>(key >> (8 * (7 - i)));
+        }
+    };
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const T lhs {random_value<T>()};
+        const T rhs {random_value<T>()};
+
+        to_bytes(to_ordered_key(lhs), lhs_bytes);
+        to_bytes(to_ordered_key(rhs), rhs_bytes);
+
+        BOOST_TEST_EQ(lhs < rhs, std::memcmp(lhs_bytes, rhs_bytes, sizeof(lhs_bytes)) < 0);
+    }
+}
+
+template <typename T, typename FastT>
+void test_fast_matches()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const T val {random_value<T>()};
+
+        // The fast types do not have subnormals
+        if (val != 0 && abs(val) < static_cast<T>(std::numeric_limits<FastT>::min()))
+        {
+            continue;
+        }
+
+        const FastT fast_val {val};
+
+        BOOST_TEST(to_ordered_key(val) == to_ordered_key(fast_val));
+        BOOST_TEST_EQ(from_ordered_key<FastT>(to_ordered_key(fast_val)), fast_val);
+    }
+}
+
+void test_constexpr()
+{
+    static_assert(to_ordered_key(decimal32_t{1}) < to_ordered_key(decimal32_t{2}), "Wrong order");
+    static_assert(to_ordered_key(decimal32_t{-2}) < to_ordered_key(decimal32_t{-1}), "Wrong order");
+    static_assert(from_ordered_key<decimal32_t>(to_ordered_key(decimal32_t{5, -1})) == decimal32_t{5, -1}, "Wrong round trip");
+}
+
+template <typename T>
+void test_type()
+{
+    test_round_trip<T>();
+    test_order<T>();
+    test_sorted<T>();
+    test_cohorts<T>();
+    test_special_values<T>();
+}
+
+int main()
+{
+    test_type<decimal32_t>();
+    test_type<decimal64_t>();
+    test_type<decimal128_t>();
+    test_type<decimal_fast32_t>();
+    test_type<decimal_fast64_t>();
+    test_type<decimal_fast128_t>();
+
+    test_memcmp<decimal32_t>();
+    test_memcmp<decimal64_t>();
+
+    test_fast_matches<decimal32_t, decimal_fast32_t>();
+    test_fast_matches<decimal64_t, decimal_fast64_t>();
+    test_fast_matches<decimal128_t, decimal_fast128_t>();
+
+    test_constexpr();
+
+    return boost::report_errors();
+}
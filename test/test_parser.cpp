@@ -9,6 +9,10 @@
 #include <cstdint>
 #include <cstring>
 #include <cerrno>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
 
 template <typename T>
 void test_integer()
@@ -192,6 +196,156 @@ void invalid_test()
     BOOST_TEST(r5.ec == std::errc::invalid_argument);
 }
 
+// Plain [-]ddd.ddd[e[+-]ddd] strings take the SWAR path, and a five digit exponent forces the same string
+// through the general path, so the two have to agree up to the exponent offset
+template <typename Unsigned_Integer>
+void test_plain_fast_path()
+{
+    constexpr int max_digits {std::numeric_limits<Unsigned_Integer>::digits10};
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int> leading_zero_dist(0, 3);
+    std::uniform_int_distribution<int> digits_dist(0, max_digits - 1);
+    std::uniform_int_distribution<int> digit_dist(0, 9);
+    std::uniform_int_distribution<int> coin(0, 1);
+    std::uniform_int_distribution<int> exp_dist(-9999, 9999);
+    constexpr int exponent_offset {20000};
+
+    for (int trial {}; trial < 4096; ++trial)
+    {
+        std::string str;
+        if (coin(rng))
+        {
+            str += '-';
+        }
+
+        str.append(static_cast<std::size_t>(leading_zero_dist(rng)), '0');
+
+        const int total_digits {digits_dist(rng) + 1};
+        const int integer_digits {std::uniform_int_distribution<int>(0, total_digits)(rng)};
+        for (int i {}; i < total_digits; ++i)
+        {
+            if (i == integer_digits)
+            {
+                str += '.';
+                if (coin(rng))
+                {
+                    str.append(static_cast<std::size_t>(leading_zero_dist(rng)), '0');
+                }
+            }
+
+            // Keep the significand non-zero so neither path takes the zero shortcut
+            str += static_cast<char>('0' + (i == 0 ? 1 + digit_dist(rng) % 9 : digit_dist(rng)));
+        }
+
+        std::string general_str {str};
+        int exp {};
+        if (coin(rng))
+        {
+            exp = exp_dist(rng);
+            if (exp != 0)
+            {
+                str += (coin(rng) ? 'e' : 'E');
+                str += (exp > 0 && coin(rng) ? "+" : "");
+                str += std::to_string(exp);
+            }
+        }
+        general_str += 'e' + std::to_string(exp + exponent_offset);
+
+        const auto delimiter_pos {str.size()};
+        if (coin(rng))
+        {
+            str += ",42";
+            general_str += ",42";
+        }
+
+        bool fast_sign {};
+        Unsigned_Integer fast_significand {};
+        std::int32_t fast_exponent {};
+        const auto fast_r {boost::decimal::detail::parser(str.data(), str.data() + str.size(), fast_sign, fast_significand, fast_exponent)};
+
+        bool sign {};
+        Unsigned_Integer significand {};
+        std::int32_t exponent {};
+        const auto r {boost::decimal::detail::parser(general_str.data(), general_str.data() + general_str.size(), sign, significand, exponent)};
+
+        if (!(BOOST_TEST(fast_r.ec == r.ec) && BOOST_TEST_EQ(fast_sign, sign) &&
+              BOOST_TEST(fast_significand == significand) && BOOST_TEST_EQ(fast_exponent + exponent_offset, exponent) &&
+              BOOST_TEST_EQ(fast_r.ptr - str.data(), static_cast<std::ptrdiff_t>(delimiter_pos))))
+        {
+            // LCOV_EXCL_START
+            std::cerr << "String: " << str << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    }
+}
+
+void test_plain_values()
+{
+    std::uint64_t significand {};
+    std::int32_t exponent {};
+    bool sign {};
+
+    const char* val1 = "0012.3400";
+    auto r1 = boost::decimal::detail::parser(val1, val1 + std::strlen(val1), sign, significand, exponent);
+    BOOST_TEST(r1.ec == std::errc());
+    BOOST_TEST(r1.ptr == val1 + std::strlen(val1));
+    BOOST_TEST_EQ(sign, false);
+    BOOST_TEST_EQ(significand, UINT64_C(123400));
+    BOOST_TEST_EQ(exponent, -4);
+
+    const char* val2 = "-0.0050";
+    auto r2 = boost::decimal::detail::parser(val2, val2 + std::strlen(val2), sign, significand, exponent);
+    BOOST_TEST(r2.ec == std::errc());
+    BOOST_TEST_EQ(sign, true);
+    BOOST_TEST_EQ(significand, UINT64_C(50));
+    BOOST_TEST_EQ(exponent, -4);
+
+    const char* val3 = "1234567890123456.78";
+    auto r3 = boost::decimal::detail::parser(val3, val3 + std::strlen(val3), sign, significand, exponent, boost::decimal::chars_format::fixed);
+    BOOST_TEST(r3.ec == std::errc());
+    BOOST_TEST_EQ(sign, false);
+    BOOST_TEST_EQ(significand, UINT64_C(123456789012345678));
+    BOOST_TEST_EQ(exponent, -2);
+
+    // Stops at the first character that can not continue the number
+    const char* val4 = "1.2.3";
+    auto r4 = boost::decimal::detail::parser(val4, val4 + std::strlen(val4), sign, significand, exponent);
+    BOOST_TEST(r4.ec == std::errc());
+    BOOST_TEST(r4.ptr == val4 + 3);
+    BOOST_TEST_EQ(significand, UINT64_C(12));
+    BOOST_TEST_EQ(exponent, -1);
+
+    const char* val5 = "99.5,100";
+    auto r5 = boost::decimal::detail::parser(val5, val5 + std::strlen(val5), sign, significand, exponent);
+    BOOST_TEST(r5.ec == std::errc());
+    BOOST_TEST(r5.ptr == val5 + 4);
+    BOOST_TEST_EQ(significand, UINT64_C(995));
+    BOOST_TEST_EQ(exponent, -1);
+
+    const char* val7 = "-2.50E-3";
+    auto r7 = boost::decimal::detail::parser(val7, val7 + std::strlen(val7), sign, significand, exponent, boost::decimal::chars_format::scientific);
+    BOOST_TEST(r7.ec == std::errc());
+    BOOST_TEST_EQ(sign, true);
+    BOOST_TEST_EQ(significand, UINT64_C(250));
+    BOOST_TEST_EQ(exponent, -5);
+
+    // The fixed and scientific requirements still hold
+    const char* val8 = "2.5";
+    auto r8 = boost::decimal::detail::parser(val8, val8 + std::strlen(val8), sign, significand, exponent, boost::decimal::chars_format::scientific);
+    BOOST_TEST(r8.ec == std::errc::invalid_argument);
+
+    auto r9 = boost::decimal::detail::parser(val7, val7 + std::strlen(val7), sign, significand, exponent, boost::decimal::chars_format::fixed);
+    BOOST_TEST(r9.ec == std::errc::invalid_argument);
+
+    // More digits than the significand holds go through the general path
+    const char* val6 = "12345678901234567890123";
+    auto r6 = boost::decimal::detail::parser(val6, val6 + std::strlen(val6), sign, significand, exponent);
+    BOOST_TEST(r6.ec == std::errc());
+    BOOST_TEST_EQ(significand, UINT64_C(1234567890123456789));
+    BOOST_TEST_EQ(exponent, 4);
+}
+
 int main()
 {
     test_integer<float>();
@@ -214,5 +368,9 @@ int main()
     invalid_test<double>();
     invalid_test<long double>();
 
+    test_plain_fast_path<std::uint64_t>();
+    test_plain_fast_path<boost::int128::uint128_t>();
+    test_plain_values();
+
     return boost::report_errors();
 }
@@ -0,0 +1,200 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <random>
+#include <limits>
+#include <vector>
+#include <cstdint>
+
+using namespace boost::decimal;
+
+static std::mt19937_64 rng(42);
+
+#ifdef BOOST_DECIMAL_REDUCE_TEST_DEPTH
+static constexpr std::size_t N {1024};
+#else
+static constexpr std::size_t N {1024 * 16};
+#endif
+
+// Enough to be split between several threads
+static constexpr std::size_t large_n {std::size_t{1} << 18U};
+
+template <typename T>
+auto random_values(const std::size_t n) -> std::vector<T>
+{
+    std::uniform_int_distribution<std::uint64_t> sig_dist(0U, 9'999'999U);
+    std::uniform_int_distribution<int> exp_dist(-10, 10);
+    std::uniform_int_distribution<int> sign_dist(0, 1);
+
+    std::vector<T> values;
+    values.reserve(n);
+    for (std::size_t i {}; i < n; ++i)
+    {
+        values.emplace_back(sig_dist(rng), exp_dist(rng), sign_dist(rng) == 1);
+    }
+
+    return values;
+}
+
+template <typename T>
+void test_matches_accumulator()
+{
+    for (const std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{7}, std::size_t{8}, std::size_t{9}, N})
+    {
+        const auto x {random_values<T>(n)};
+        const auto y {random_values<T>(n)};
+
+        decimal_accumulator<T> sum;
+        decimal_accumulator<T> abs_sum;
+        decimal_accumulator<T> products;
+        decimal_accumulator<T> squares;
+        for (std::size_t i {}; i < n; ++i)
+        {
+            sum += x[i];
+            abs_sum += abs(x[i]);
+            products += x[i] * y[i];
+            squares += x[i] * x[i];
+        }
+
+        BOOST_TEST_EQ(reduce(x.data(), n), sum.value());
+        BOOST_TEST_EQ(transform_reduce(x.data(), n, [](const T val) { return abs(val); }), abs_sum.value());
+        BOOST_TEST_EQ(dot(x.data(), y.data(), n), products.value());
+        BOOST_TEST_EQ(sum_of_squares(x.data(), n), squares.value());
+    }
+}
+
+template <typename T>
+void test_order_independence()
+{
+    auto x {random_values<T>(N)};
+    const auto sum {reduce(x.data(), x.size())};
+    const auto squares {sum_of_squares(x.data(), x.size())};
+
+    std::shuffle(x.begin(), x.end(), rng);
+    BOOST_TEST_EQ(reduce(x.data(), x.size()), sum);
+    BOOST_TEST_EQ(sum_of_squares(x.data(), x.size()), squares);
+
+    std::reverse(x.begin(), x.end());
+    BOOST_TEST_EQ(reduce(x.data(), x.size()), sum);
+    BOOST_TEST_EQ(sum_of_squares(x.data(), x.size()), squares);
+}
+
+template <typename T>
+void test_threads()
+{
+    const auto x {random_values<T>(large_n)};
+    const auto y {random_values<T>(large_n)};
+
+    const auto sum {reduce(x.data(), x.size())};
+    const auto abs_sum {transform_reduce(x.data(), x.size(), [](const T val) { return abs(val); })};
+    const auto products {dot(x.data(), y.data(), x.size())};
+    const auto squares {sum_of_squares(x.data(), x.size())};
+
+    for (const unsigned threads : {0U, 1U, 2U, 3U, 4U})
+    {
+        BOOST_TEST_EQ(reduce(x.data(), x.size(), threads), sum);
+        BOOST_TEST_EQ(transform_reduce(x.data(), x.size(), [](const T val) { return abs(val); }, threads), abs_sum);
+        BOOST_TEST_EQ(dot(x.data(), y.data(), x.size(), threads), products);
+        BOOST_TEST_EQ(sum_of_squares(x.data(), x.size(), threads), squares);
+    }
+
+    // Fewer elements than one thread is worth
+    BOOST_TEST_EQ(reduce(x.data(), 100U, 4U), reduce(x.data(), 100U));
+    BOOST_TEST_EQ(reduce(x.data(), 0U, 4U), T{0});
+}
+
+template <typename T>
+void test_special_values()
+{
+    auto x {random_values<T>(N)};
+    x.emplace_back(std::numeric_limits<T>::max());
+    x.emplace_back(-std::numeric_limits<T>::max());
+    BOOST_TEST_EQ(reduce(x.data(), x.size()), reduce(x.data(), x.size() - 2U));
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    x.emplace_back(std::numeric_limits<T>::infinity());
+    BOOST_TEST(isinf(reduce(x.data(), x.size())));
+    BOOST_TEST(isinf(sum_of_squares(x.data(), x.size())));
+
+    x.emplace_back(std::numeric_limits<T>::quiet_NaN());
+    BOOST_TEST(isnan(reduce(x.data(), x.size())));
+    BOOST_TEST(isnan(sum_of_squares(x.data(), x.size())));
+    #endif
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+void test_span()
+{
+    const auto x {random_values<decimal64_t>(N)};
+    const auto y {random_values<decimal64_t>(N)};
+    const std::span<const decimal64_t> x_span {x};
+    const std::span<const decimal64_t> y_span {y};
+
+    BOOST_TEST_EQ(reduce(x_span), reduce(x.data(), x.size()));
+    BOOST_TEST_EQ(reduce(x_span, 2U), reduce(x.data(), x.size()));
+    BOOST_TEST_EQ(transform_reduce(x_span, [](const decimal64_t val) { return -val; }), -reduce(x.data(), x.size()));
+    BOOST_TEST_EQ(transform_reduce(x_span, [](const decimal64_t val) { return -val; }, 2U), -reduce(x.data(), x.size()));
+    BOOST_TEST_EQ(dot(x_span, y_span), dot(x.data(), y.data(), x.size()));
+    BOOST_TEST_EQ(dot(x_span, y_span, 2U), dot(x.data(), y.data(), x.size()));
+    BOOST_TEST_EQ(sum_of_squares(x_span), sum_of_squares(x.data(), x.size()));
+    BOOST_TEST_EQ(sum_of_squares(x_span, 2U), sum_of_squares(x.data(), x.size()));
+
+    // Spans of non-const values
+    auto z {random_values<decimal64_t>(N)};
+    const std::span<decimal64_t> z_span {z};
+
+    BOOST_TEST_EQ(reduce(z_span), reduce(z.data(), z.size()));
+    BOOST_TEST_EQ(reduce(z_span, 2U), reduce(z.data(), z.size()));
+    BOOST_TEST_EQ(transform_reduce(z_span, [](const decimal64_t val) { return -val; }), -reduce(z.data(), z.size()));
+    BOOST_TEST_EQ(transform_reduce(z_span, [](const decimal64_t val) { return -val; }, 2U), -reduce(z.data(), z.size()));
+    BOOST_TEST_EQ(dot(z_span, z_span), dot(z.data(), z.data(), z.size()));
+    BOOST_TEST_EQ(dot(z_span, x_span, 2U), dot(z.data(), x.data(), z.size()));
+    BOOST_TEST_EQ(dot(x_span, z_span), dot(x.data(), z.data(), x.size()));
+    BOOST_TEST_EQ(sum_of_squares(z_span), sum_of_squares(z.data(), z.size()));
+    BOOST_TEST_EQ(sum_of_squares(z_span, 2U), sum_of_squares(z.data(), z.size()));
+
+    // As well as containers with DecimalType given explicitly
+    BOOST_TEST_EQ(reduce<decimal64_t>(x), reduce(x.data(), x.size()));
+    BOOST_TEST_EQ(reduce<decimal64_t>(z), reduce(z.data(), z.size()));
+    BOOST_TEST_EQ(dot<decimal64_t>(z, x), dot(z.data(), x.data(), z.size()));
+}
+
+#endif
+
+constexpr decimal32_t constexpr_values[] {decimal32_t{1, -1}, decimal32_t{2, -1}, decimal32_t{3, -1}, decimal32_t{4, -1}};
+
+template <typename T>
+void test_type()
+{
+    test_matches_accumulator<T>();
+    test_order_independence<T>();
+    test_special_values<T>();
+}
+
+int main()
+{
+    test_type<decimal32_t>();
+    test_type<decimal64_t>();
+    test_type<decimal128_t>();
+    test_type<decimal_fast32_t>();
+    test_type<decimal_fast64_t>();
+    test_type<decimal_fast128_t>();
+
+    test_threads<decimal32_t>();
+    test_threads<decimal64_t>();
+    test_threads<decimal128_t>();
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+    test_span();
+    #endif
+
+    static_assert(reduce(constexpr_values, 4U) == decimal32_t{1}, "Wrong value");
+    static_assert(sum_of_squares(constexpr_values, 4U) == decimal32_t{3, -1}, "Wrong value");
+
+    return boost::report_errors();
+}
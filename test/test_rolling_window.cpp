@@ -0,0 +1,319 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <random>
+#include <limits>
+#include <vector>
+#include <cstdint>
+
+using namespace boost::decimal;
+
+static std::mt19937_64 rng(42);
+
+#ifdef BOOST_DECIMAL_REDUCE_TEST_DEPTH
+static constexpr std::size_t N {256};
+#else
+static constexpr std::size_t N {2048};
+#endif
+
+template <typename T>
+auto random_values(const std::size_t n, const int min_exp, const int max_exp) -> std::vector<T>
+{
+    std::uniform_int_distribution<std::uint64_t> sig_dist(0U, 9'999'999U);
+    std::uniform_int_distribution<int> exp_dist(min_exp, max_exp);
+    std::uniform_int_distribution<int> sign_dist(0, 1);
+
+    std::vector<T> values;
+    values.reserve(n);
+    for (std::size_t i {}; i < n; ++i)
+    {
+        values.emplace_back(sig_dist(rng), exp_dist(rng), sign_dist(rng) == 1);
+    }
+
+    return values;
+}
+
+// The population variance of values[first, last], which are multiples of 10^-4 below 10^12,
+// rounded once to nearest with ties to even.
+// (n * sum of squares - sum^2) / n^2 is formed with integers from the values scaled by 10^4
+template <typename T>
+auto exact_variance(const std::vector<T>& values, const std::size_t first, const std::size_t last) -> T
+{
+    using boost::int128::int128_t;
+    using boost::int128::uint128_t;
+
+    int128_t sum {};
+    int128_t squares {};
+    for (auto i {first}; i <= last; ++i)
+    {
+        int exp {};
+        int128_t scaled {static_cast<uint128_t>(frexp10(values[i], &exp))};
+        for (exp += 4; exp < 0; ++exp)
+        {
+            scaled /= 10;
+        }
+        for (; exp > 0; --exp)
+        {
+            scaled *= 10;
+        }
+
+        scaled = signbit(values[i]) ? -scaled : scaled;
+        sum += scaled;
+        squares += scaled * scaled;
+    }
+
+    const int128_t n {static_cast<std::int64_t>(last - first + 1U)};
+    const auto numerator {static_cast<uint128_t>(n * squares - sum * sum)};
+    const auto divisor {static_cast<uint128_t>(n * n)};
+
+    if (numerator == 0U)
+    {
+        return T{0};
+    }
+
+    const auto min_sig {detail::pow10(uint128_t{static_cast<unsigned>(std::numeric_limits<T>::digits10)})};
+
+    auto sig {numerator / divisor};
+    auto remainder {numerator % divisor};
+    bool sticky {};
+    int exp {-8};
+
+    while (sig >= min_sig * 10U)
+    {
+        sticky = sticky || sig % 10U != 0U;
+        sig /= 10U;
+        ++exp;
+    }
+
+    while (sig < min_sig)
+    {
+        remainder *= 10U;
+        sig = sig * 10U + remainder / divisor;
+        remainder %= divisor;
+        --exp;
+    }
+
+    const auto digit {sig % 10U};
+    sticky = sticky || remainder != 0U;
+    sig /= 10U;
+    ++exp;
+
+    if (digit > 5U || (digit == 5U && (sticky || sig % 2U == 1U)))
+    {
+        ++sig;
+    }
+
+    if (sig == min_sig)
+    {
+        sig /= 10U;
+        ++exp;
+    }
+
+    return T{sig, exp};
+}
+
+// Every statistic must equal the one computed from scratch over the current window
+template <typename T>
+void test_against_recomputation(const std::size_t window_size)
+{
+    const auto values {random_values<T>(N, -4, 4)};
+    const auto weights {random_values<T>(N, 0, 2)};
+
+    rolling_window<T> window {window_size};
+    BOOST_TEST_EQ(window.window_size(), window_size);
+    BOOST_TEST(window.empty());
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        window.push(values[i], abs(weights[i]) + T{1});
+
+        const auto first {i + 1U >= window_size ? i + 1U - window_size : 0U};
+        const auto n {i + 1U - first};
+
+        decimal_accumulator<T> sum;
+        decimal_accumulator<T> sum_of_weights;
+        decimal_accumulator<T> weighted_sum;
+        for (auto j {first}; j <= i; ++j)
+        {
+            const auto weight {abs(weights[j]) + T{1}};
+            sum += values[j];
+            sum_of_weights += weight;
+            weighted_sum += values[j] * weight;
+        }
+
+        const auto mean {sum.value() / T{n}};
+
+        BOOST_TEST_EQ(window.size(), n);
+        BOOST_TEST_EQ(window.full(), n == window_size);
+        BOOST_TEST_EQ(window.sum(), sum.value());
+        BOOST_TEST_EQ(window.mean(), mean);
+        BOOST_TEST_EQ(window.variance(), exact_variance(values, first, i));
+        BOOST_TEST_EQ(window.vwap(), weighted_sum.value() / sum_of_weights.value());
+        BOOST_TEST_EQ(window.min(), *std::min_element(values.begin() + static_cast<std::ptrdiff_t>(first), values.begin() + static_cast<std::ptrdiff_t>(i + 1U)));
+        BOOST_TEST_EQ(window.max(), *std::max_element(values.begin() + static_cast<std::ptrdiff_t>(first), values.begin() + static_cast<std::ptrdiff_t>(i + 1U)));
+    }
+
+    window.clear();
+    BOOST_TEST(window.empty());
+    BOOST_TEST_EQ(window.size(), 0U);
+    BOOST_TEST_EQ(window.sum(), T{0});
+
+    window.push(T{5});
+    BOOST_TEST_EQ(window.min(), T{5});
+    BOOST_TEST_EQ(window.max(), T{5});
+    BOOST_TEST_EQ(window.variance(), T{0});
+}
+
+// A running sum updated with operator+= and operator-= keeps the rounding error of every step
+template <typename T>
+void test_no_drift()
+{
+    const auto big {std::numeric_limits<T>::max() / T{1000}};
+
+    std::vector<T> pushed;
+    rolling_window<T> window {3};
+    T running {0};
+
+    const auto push = [&](const T val)
+    {
+        if (window.full())
+        {
+            running -= pushed[pushed.size() - 3U];
+        }
+
+        running += val;
+        window.push(val);
+        pushed.push_back(val);
+    };
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        push(i % 3U == 0U ? big : T{1, -1});
+    }
+
+    // Until the large value has left the window
+    for (int i {}; i < 3; ++i)
+    {
+        push(T{1, -1});
+    }
+
+    BOOST_TEST_EQ(window.sum(), T(3, -1));
+    BOOST_TEST_EQ(window.variance(), T{0});
+    BOOST_TEST_EQ(window.min(), T(1, -1));
+    BOOST_TEST_EQ(window.max(), T(1, -1));
+    BOOST_TEST_NE(running, T(3, -1));
+}
+
+// Equal values must not be lost from the extremum queues
+template <typename T>
+void test_repeated_extrema()
+{
+    rolling_window<T> window {4};
+
+    for (const int val : {5, 1, 1, 7, 7, 3, 3, 3, 3, 9})
+    {
+        window.push(T{val});
+    }
+
+    BOOST_TEST_EQ(window.min(), T{3});
+    BOOST_TEST_EQ(window.max(), T{9});
+
+    window.push(T{2});
+    BOOST_TEST_EQ(window.min(), T{2});
+    BOOST_TEST_EQ(window.max(), T{9});
+}
+
+// Infinities and NaNs only affect the window while they are in it
+template <typename T>
+void test_special_values()
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    rolling_window<T> window {2};
+
+    window.push(std::numeric_limits<T>::infinity());
+    window.push(T{1});
+    BOOST_TEST(isinf(window.sum()));
+    BOOST_TEST(isinf(window.max()));
+
+    window.push(-std::numeric_limits<T>::infinity());
+    BOOST_TEST(isinf(window.sum()) && signbit(window.sum()));
+
+    window.push(std::numeric_limits<T>::quiet_NaN());
+    BOOST_TEST(isnan(window.sum()));
+    BOOST_TEST(isnan(window.mean()));
+    BOOST_TEST(isnan(window.variance()));
+
+    window.push(T{2});
+    window.push(T{3});
+    BOOST_TEST_EQ(window.sum(), T{5});
+    BOOST_TEST_EQ(window.variance(), T(25, -2));
+    BOOST_TEST_EQ(window.min(), T{2});
+    BOOST_TEST_EQ(window.max(), T{3});
+    #endif
+
+    // The squares of large values are held exactly as well
+    rolling_window<T> large {2};
+    large.push(std::numeric_limits<T>::max());
+    large.push(T{1});
+    large.push(T{2});
+    large.push(T{4});
+    BOOST_TEST_EQ(large.variance(), T{1});
+}
+
+// The variance of values that agree in most of their digits is small compared to the mean squared,
+// so subtracting rounded squares would cancel most of the digits of the result
+void test_variance_cancellation()
+{
+    rolling_window<decimal32_t> window {3};
+    window.push(decimal32_t{1000001, -4});
+    window.push(decimal32_t{1000002, -4});
+    BOOST_TEST_EQ(window.variance(), decimal32_t(25, -10));
+
+    window.push(decimal32_t{1000003, -4});
+    BOOST_TEST_EQ(window.variance(), decimal32_t(6666667, -15));
+
+    window.push(decimal32_t{1000001, -4});
+    BOOST_TEST_EQ(window.variance(), decimal32_t(6666667, -15));
+
+    window.push(decimal32_t{1000001, -4});
+    BOOST_TEST_EQ(window.variance(), decimal32_t(8888889, -15));
+
+    window.push(decimal32_t{1000001, -4});
+    BOOST_TEST_EQ(window.variance(), decimal32_t{0});
+
+    rolling_window<decimal128_t> wide {2};
+    wide.push(decimal128_t{1, 30} + decimal128_t{1, -3});
+    wide.push(decimal128_t{1, 30} + decimal128_t{3, -3});
+    BOOST_TEST_EQ(wide.variance(), decimal128_t(1, -6));
+}
+
+template <typename T>
+void test_type()
+{
+    for (const std::size_t window_size : {std::size_t{1}, std::size_t{2}, std::size_t{7}, std::size_t{30}})
+    {
+        test_against_recomputation<T>(window_size);
+    }
+
+    test_no_drift<T>();
+    test_repeated_extrema<T>();
+    test_special_values<T>();
+}
+
+int main()
+{
+    test_type<decimal32_t>();
+    test_type<decimal64_t>();
+    test_type<decimal128_t>();
+    test_type<decimal_fast32_t>();
+    test_type<decimal_fast64_t>();
+    test_type<decimal_fast128_t>();
+
+    test_variance_cancellation();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,224 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <random>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+using namespace boost::decimal;
+
+static std::mt19937_64 rng(42);
+
+#ifdef BOOST_DECIMAL_REDUCE_TEST_DEPTH
+static constexpr std::size_t N {1024};
+#else
+static constexpr std::size_t N {1024 * 16};
+#endif
+
+// Enough to be split between several threads
+static constexpr std::size_t large_n {std::size_t{1} << 18U};
+
+// Prices with few distinct values so that there are many ties and members of the same cohort
+template <typename T>
+auto random_values(const std::size_t n) -> std::vector<T>
+{
+    std::uniform_int_distribution<std::uint64_t> sig_dist(0U, 5000U);
+    std::uniform_int_distribution<int> exp_dist(-4, -2);
+    std::uniform_int_distribution<int> sign_dist(0, 9);
+
+    std::vector<T> values;
+    values.reserve(n);
+    for (std::size_t i {}; i < n; ++i)
+    {
+        const auto exp {exp_dist(rng)};
+        auto sig {sig_dist(rng)};
+        for (int j {exp}; j < -2; ++j)
+        {
+            sig *= 10U;
+        }
+
+        values.emplace_back(sig, exp, sign_dist(rng) == 0);
+    }
+
+    return values;
+}
+
+// Values across the whole range of the type
+template <typename T>
+auto random_wide_values(const std::size_t n) -> std::vector<T>
+{
+    std::uniform_int_distribution<std::uint64_t> sig_dist(0U, UINT64_C(9'999'999'999'999'999));
+    std::uniform_int_distribution<int> exp_dist(std::numeric_limits<T>::min_exponent10, std::numeric_limits<T>::max_exponent10 - 20);
+    std::uniform_int_distribution<int> sign_dist(0, 1);
+
+    std::vector<T> values;
+    values.reserve(n);
+    for (std::size_t i {}; i < n; ++i)
+    {
+        values.emplace_back(sig_dist(rng), exp_dist(rng), sign_dist(rng) == 1);
+    }
+
+    return values;
+}
+
+// The radix sort is stable, so it must give exactly the same bits as a stable sort of the keys
+template <typename T>
+auto reference_sort(const std::vector<T>& values) -> std::vector<T>
+{
+    using key_type = decltype(to_ordered_key(T{}));
+
+    std::vector<std::pair<key_type, std::size_t>> keys;
+    keys.reserve(values.size());
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        keys.emplace_back(to_ordered_key(values[i]), i);
+    }
+
+    std::stable_sort(keys.begin(), keys.end(), [](const std::pair<key_type, std::size_t>& lhs, const std::pair<key_type, std::size_t>& rhs) { return lhs.first < rhs.first; });
+
+    std::vector<T> sorted;
+    sorted.reserve(values.size());
+    for (const auto& key : keys)
+    {
+        sorted.emplace_back(values[key.second]);
+    }
+
+    return sorted;
+}
+
+template <typename T>
+void test_matches_reference(const std::vector<T>& values, const unsigned threads)
+{
+    const auto expected {reference_sort(values)};
+
+    auto sorted {values};
+    if (threads == 1U)
+    {
+        boost::decimal::sort(sorted.data(), sorted.size());
+    }
+    else
+    {
+        boost::decimal::sort(sorted.data(), sorted.size(), threads);
+    }
+
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        if (!BOOST_TEST(to_bid(sorted[i]) == to_bid(expected[i])))
+        {
+            // LCOV_EXCL_START
+            std::cerr << "Index: " << i
+                      << "\nSorted: " << sorted[i]
+                      << "\nExpected: " << expected[i] << std::endl;
+            break;
+            // LCOV_EXCL_STOP
+        }
+    }
+
+    BOOST_TEST(std::is_sorted(sorted.begin(), sorted.end()));
+}
+
+template <typename T>
+void test_sizes()
+{
+    for (const std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{2}, std::size_t{255}, std::size_t{256}, std::size_t{1000}, N})
+    {
+        test_matches_reference(random_values<T>(n), 1U);
+        test_matches_reference(random_wide_values<T>(n), 1U);
+    }
+}
+
+template <typename T>
+void test_threads()
+{
+    const auto values {random_values<T>(large_n)};
+
+    test_matches_reference(values, 1U);
+    test_matches_reference(values, 2U);
+    test_matches_reference(values, 3U);
+    test_matches_reference(values, 0U);
+
+    test_matches_reference(random_wide_values<T>(large_n), 4U);
+}
+
+template <typename T>
+void test_special_values()
+{
+    std::vector<T> values {random_values<T>(1000)};
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    values.emplace_back(std::numeric_limits<T>::infinity());
+    values.emplace_back(-std::numeric_limits<T>::infinity());
+    values.emplace_back(std::numeric_limits<T>::quiet_NaN());
+    #endif
+    values.emplace_back(std::numeric_limits<T>::max());
+    values.emplace_back(std::numeric_limits<T>::lowest());
+    values.emplace_back(std::numeric_limits<T>::denorm_min());
+    values.emplace_back(-T{0});
+    values.emplace_back(T{0});
+
+    std::shuffle(values.begin(), values.end(), rng);
+    boost::decimal::sort(values.data(), values.size());
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    BOOST_TEST(isinf(values.front()) && signbit(values.front()));
+    BOOST_TEST(isnan(values.back()));
+    BOOST_TEST(isinf(values[values.size() - 2U]) && !signbit(values[values.size() - 2U]));
+    BOOST_TEST_EQ(values[1], std::numeric_limits<T>::lowest());
+    #else
+    BOOST_TEST_EQ(values.front(), std::numeric_limits<T>::lowest());
+    BOOST_TEST_EQ(values.back(), std::numeric_limits<T>::max());
+    #endif
+
+    const auto zero {std::find(values.begin(), values.end(), T{0})};
+    BOOST_TEST(signbit(*zero));
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+void test_span()
+{
+    auto values {random_values<decimal64_t>(N)};
+    const auto expected {reference_sort(values)};
+
+    boost::decimal::sort(std::span<decimal64_t>(values));
+    BOOST_TEST(values == expected);
+
+    std::shuffle(values.begin(), values.end(), rng);
+    boost::decimal::sort(std::span<decimal64_t>(values), 2U);
+    BOOST_TEST(values == expected);
+}
+
+#endif
+
+template <typename T>
+void test_type()
+{
+    test_sizes<T>();
+    test_special_values<T>();
+}
+
+int main()
+{
+    test_type<decimal32_t>();
+    test_type<decimal64_t>();
+    test_type<decimal128_t>();
+    test_type<decimal_fast32_t>();
+    test_type<decimal_fast64_t>();
+    test_type<decimal_fast128_t>();
+
+    test_threads<decimal32_t>();
+    test_threads<decimal64_t>();
+    test_threads<decimal128_t>();
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+    test_span();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,154 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_DECIMAL_STRTOD_C_LOCALE
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cerrno>
+#include <clocale>
+#include <cstring>
+#include <iostream>
+#include <locale>
+#include <random>
+#include <string>
+
+using namespace boost::decimal;
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024U); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024U >> 4U); // Number of trials
+#endif
+
+#if !defined(BOOST_DECIMAL_DISABLE_CLIB)
+
+template <typename T>
+void test_roundtrip()
+{
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<std::int64_t> sig_dist(-9'999'999'999'999'999, 9'999'999'999'999'999);
+    std::uniform_int_distribution<int> exp_dist(-30, 30);
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const T val {sig_dist(rng), exp_dist(rng)};
+
+        char buffer[64] {};
+        const auto r {to_chars(buffer, buffer + sizeof(buffer) - 1, val)};
+        BOOST_TEST(r);
+        *r.ptr = '\0';
+
+        char* endptr {};
+        BOOST_TEST_EQ(strtod_c_locale<T>(buffer, &endptr), val);
+        BOOST_TEST(endptr == r.ptr);
+
+        // With BOOST_DECIMAL_STRTOD_C_LOCALE defined strtod takes the same path
+        BOOST_TEST_EQ(boost::decimal::strtod<T>(buffer, &endptr), val);
+        BOOST_TEST(endptr == r.ptr);
+    }
+}
+
+template <typename T>
+void test_edges()
+{
+    errno = 0;
+    BOOST_TEST(isnan(strtod_c_locale<T>(nullptr, nullptr))) && BOOST_TEST_EQ(errno, EINVAL);
+
+    errno = 0;
+    BOOST_TEST(issignaling(strtod_c_locale<T>("nan(snan)", nullptr))) && BOOST_TEST_EQ(errno, 0);
+
+    errno = 0;
+    BOOST_TEST(isinf(strtod_c_locale<T>("-inf", nullptr))) && BOOST_TEST_EQ(errno, 0);
+
+    errno = 0;
+    const char junk[] {"junk"};
+    char* endptr {};
+    BOOST_TEST(isnan(strtod_c_locale<T>(junk, &endptr))) && BOOST_TEST_EQ(errno, EINVAL);
+    BOOST_TEST(endptr == junk);
+
+    // Parsing stops at the first character that is not part of the number
+    const char trailing[] {"12.5 apples"};
+    BOOST_TEST_EQ(strtod_c_locale<T>(trailing, &endptr), T(125, -1));
+    BOOST_TEST(endptr == trailing + 4);
+
+    // Strings longer than the internal buffer of strtod are parsed in place as well
+    std::string long_str {"1."};
+    long_str.append(4096U, '1');
+    BOOST_TEST_EQ(strtod_c_locale<T>(long_str.c_str(), &endptr), strtod_c_locale<T>(long_str.substr(0, 60).c_str(), nullptr));
+    BOOST_TEST(endptr == long_str.c_str() + long_str.size());
+
+    const std::wstring wide_str {L"-0.0125e2"};
+    wchar_t* wide_endptr {};
+    BOOST_TEST_EQ(boost::decimal::wcstod<T>(wide_str.c_str(), &wide_endptr), T(-125, -2));
+    BOOST_TEST(wide_endptr == wide_str.c_str() + wide_str.size());
+}
+
+#ifndef BOOST_DECIMAL_DISABLE_EXCEPTIONS
+
+// The global locale is ignored, so a comma is not a decimal point even when the locale says it is
+template <typename T>
+void test_locale_ignored()
+{
+    try
+    {
+        #ifdef BOOST_MSVC
+        std::locale::global(std::locale("German"));
+        #else
+        std::locale::global(std::locale("de_DE.UTF-8"));
+        #endif
+    }
+    // LCOV_EXCL_START
+    catch (...)
+    {
+        std::cerr << "Locale not installed. Skipping test." << std::endl;
+        return;
+    }
+    // LCOV_EXCL_STOP
+
+    const char buffer[] {"1,1897e+02"};
+    char* endptr {};
+    BOOST_TEST_EQ(strtod_c_locale<T>(buffer, &endptr), T(1));
+    BOOST_TEST(endptr == buffer + 1);
+
+    const char dot_buffer[] {"1.1897e+02"};
+    BOOST_TEST_EQ(strtod_c_locale<T>(dot_buffer, &endptr), T(11897, -2));
+
+    std::locale::global(std::locale::classic());
+}
+
+#endif
+
+template <typename T>
+void test()
+{
+    test_roundtrip<T>();
+    test_edges<T>();
+
+    // Homebrew GCC does not support locales
+    #if !(defined(__GNUC__) && __GNUC__ >= 5 && defined(__APPLE__)) && !defined(BOOST_DECIMAL_QEMU_TEST) && !defined(BOOST_DECIMAL_DISABLE_EXCEPTIONS)
+    test_locale_ignored<T>();
+    #endif
+}
+
+int main()
+{
+    test<decimal32_t>();
+    test<decimal64_t>();
+    test<decimal128_t>();
+    test<decimal_fast32_t>();
+    test<decimal_fast64_t>();
+    test<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,222 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace boost::decimal;
+
+static std::mt19937_64 rng(42);
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024U); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024U >> 4U); // Number of trials
+#endif
+
+#if !defined(BOOST_DECIMAL_DISABLE_CLIB)
+
+template <typename T>
+std::vector<T> generate_values()
+{
+    std::uniform_int_distribution<std::int64_t> sig_dist(-9'999'999'999'999'999, 9'999'999'999'999'999);
+    std::uniform_int_distribution<std::int64_t> small_sig_dist(-99'999, 99'999);
+    std::uniform_int_distribution<int> exp_dist(-30, 30);
+    std::uniform_int_distribution<int> kind_dist(0, 15);
+
+    std::vector<T> values(N);
+    for (auto& val : values)
+    {
+        switch (kind_dist(rng))
+        {
+            case 0:
+                val = std::numeric_limits<T>::infinity();
+                break;
+            case 1:
+                val = -std::numeric_limits<T>::quiet_NaN();
+                break;
+            case 2:
+                val = T{0U, exp_dist(rng), kind_dist(rng) > 7};
+                break;
+            case 3:
+                val = std::numeric_limits<T>::max();
+                break;
+            case 4:
+                val = std::numeric_limits<T>::denorm_min();
+                break;
+            case 5:
+            case 6:
+            case 7:
+                // Prices with a few decimal places
+                val = T{small_sig_dist(rng), -(kind_dist(rng) % 5)};
+                break;
+            default:
+                val = T{sig_dist(rng), exp_dist(rng)};
+                break;
+        }
+    }
+
+    return values;
+}
+
+// Every value has to come out exactly as to_chars writes it on its own
+template <typename T>
+void test_matches_to_chars(const chars_format fmt, const char separator)
+{
+    const auto values {generate_values<T>()};
+
+    std::string expected;
+    for (const auto& val : values)
+    {
+        char field[8192];
+        const auto r {to_chars(field, field + sizeof(field), val, fmt)};
+        BOOST_TEST(r);
+        expected.append(field, r.ptr);
+        expected.push_back(separator);
+    }
+
+    std::vector<char> buffer(expected.size() + 16U);
+    std::vector<std::size_t> offsets(values.size() + 1U);
+
+    const auto res {to_chars_bulk(buffer.data(), buffer.data() + buffer.size(), values.data(), values.size(), separator, fmt, offsets.data())};
+    BOOST_TEST(res);
+    BOOST_TEST_EQ(res.count, values.size());
+    BOOST_TEST_EQ(static_cast<std::size_t>(res.ptr - buffer.data()), expected.size());
+
+    const std::string result(buffer.data(), res.ptr);
+    BOOST_TEST_EQ(result, expected);
+
+    // Each value is in [offsets[i], offsets[i + 1] - 1) and followed by the separator
+    BOOST_TEST_EQ(offsets[0], 0U);
+    BOOST_TEST_EQ(offsets[values.size()], expected.size());
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        T parsed {};
+        const auto field_first {buffer.data() + offsets[i]};
+        const auto field_last {buffer.data() + offsets[i + 1U] - 1};
+        BOOST_TEST_EQ(*field_last, separator);
+
+        const auto r {from_chars(field_first, field_last, parsed, fmt)};
+        if (isnan(values[i]))
+        {
+            BOOST_TEST(isnan(parsed));
+        }
+        else if (isinf(values[i]) || values[i] == T{} || values[i] == std::numeric_limits<T>::max())
+        {
+            // from_chars reports inf as out of range, does not read "0e+00" back with chars_format::scientific,
+            // and does not read the thousands of digits of max in fixed format, so these are only compared above
+            continue;
+        }
+        else if (!BOOST_TEST(r.ptr == field_last && parsed == values[i]))
+        {
+            // LCOV_EXCL_START
+            std::cerr << "Index: " << i << "\nField: " << std::string(field_first, field_last) << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    }
+}
+
+template <typename T>
+void test_buffer_full()
+{
+    const T values[] {T{125, -2}, T{-5}, T{3, 50}, T{7}};
+
+    // "1.25,-5," fits but "3e+50," does not
+    char buffer[10] {};
+    std::size_t offsets[5] {};
+    const auto res {to_chars_bulk(buffer, buffer + sizeof(buffer), values, 4U, ',', chars_format::general, offsets)};
+    BOOST_TEST(!res);
+    BOOST_TEST(res.ec == std::errc::value_too_large);
+    BOOST_TEST_EQ(res.count, 2U);
+    BOOST_TEST(res.ptr == buffer + 8);
+    BOOST_TEST_EQ(std::string(buffer, res.ptr), std::string("1.25,-5,"));
+    BOOST_TEST_EQ(offsets[1], 5U);
+    BOOST_TEST_EQ(offsets[2], 8U);
+
+    // Resuming from ptr writes the rest
+    char rest[16] {};
+    const auto rest_res {to_chars_bulk(rest, rest + sizeof(rest), values + res.count, 4U - res.count, '\n')};
+    BOOST_TEST(rest_res);
+    BOOST_TEST_EQ(std::string(rest, rest_res.ptr), std::string("3e+50\n7\n"));
+
+    // Nothing to write
+    const auto empty {to_chars_bulk(buffer, buffer + sizeof(buffer), values, 0U)};
+    BOOST_TEST(empty);
+    BOOST_TEST_EQ(empty.count, 0U);
+    BOOST_TEST(empty.ptr == buffer);
+
+    // Not even the separator fits
+    const auto tiny {to_chars_bulk(buffer, buffer + 1, values + 3, 1U)};
+    BOOST_TEST(!tiny);
+    BOOST_TEST_EQ(tiny.count, 0U);
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+template <typename T>
+void test_span()
+{
+    const std::vector<T> values {T{1}, T{-25, -1}, T{1, -10}};
+    std::vector<char> buffer(64U);
+    std::vector<std::size_t> offsets(values.size() + 1U);
+
+    const auto res {to_chars_bulk<T>(buffer, values, '|', chars_format::general, offsets)};
+    BOOST_TEST(res);
+    BOOST_TEST_EQ(res.count, 3U);
+    BOOST_TEST_EQ(std::string(buffer.data(), res.ptr), std::string("1|-2.5|1e-10|"));
+    BOOST_TEST_EQ(offsets[2], 7U);
+
+    // A span of non-const values
+    std::vector<T> mutable_values {values};
+    const auto mutable_res {to_chars_bulk(std::span<char>{buffer}, std::span<T>{mutable_values}, '|')};
+    BOOST_TEST(mutable_res);
+    BOOST_TEST_EQ(std::string(buffer.data(), mutable_res.ptr), std::string("1|-2.5|1e-10|"));
+
+    const auto explicit_res {to_chars_bulk<T>(buffer, mutable_values, '|')};
+    BOOST_TEST(explicit_res);
+    BOOST_TEST_EQ(std::string(buffer.data(), explicit_res.ptr), std::string("1|-2.5|1e-10|"));
+}
+
+#endif
+
+template <typename T>
+void test()
+{
+    test_matches_to_chars<T>(chars_format::general, ',');
+    test_matches_to_chars<T>(chars_format::fixed, '\n');
+    test_matches_to_chars<T>(chars_format::scientific, '\x01');
+    test_matches_to_chars<T>(chars_format::hex, ';');
+    test_buffer_full<T>();
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+    test_span<T>();
+    #endif
+}
+
+int main()
+{
+    test<decimal32_t>();
+    test<decimal64_t>();
+    test<decimal128_t>();
+    test<decimal_fast32_t>();
+    test<decimal_fast64_t>();
+    test<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
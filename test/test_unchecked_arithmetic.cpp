@@ -0,0 +1,100 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::decimal;
+
+static std::mt19937_64 rng(42);
+
+#ifdef BOOST_DECIMAL_REDUCE_TEST_DEPTH
+static constexpr std::size_t N {128};
+#else
+static constexpr std::size_t N {1024};
+#endif
+
+template <typename T>
+auto random_value(const int exp_range) -> T
+{
+    std::uniform_int_distribution<std::uint64_t> sig_dist(0U, UINT64_C(9'999'999'999'999'999));
+    std::uniform_int_distribution<int> exp_dist(-exp_range, exp_range);
+    std::uniform_int_distribution<int> sign_dist(0, 1);
+
+    return T{sig_dist(rng), exp_dist(rng), sign_dist(rng) == 1};
+}
+
+// Finite operands must give exactly the results of the operators, including the sign of zero
+template <typename T>
+void test_against_operators(const T lhs, const T rhs)
+{
+    const T checked_add {lhs + rhs};
+    const T checked_sub {lhs - rhs};
+    const T checked_mul {lhs * rhs};
+
+    const T unchecked_add_res {unchecked_add(lhs, rhs)};
+    const T unchecked_sub_res {unchecked_sub(lhs, rhs)};
+    const T unchecked_mul_res {unchecked_mul(lhs, rhs)};
+
+    BOOST_TEST_EQ(checked_add, unchecked_add_res);
+    BOOST_TEST_EQ(checked_sub, unchecked_sub_res);
+    BOOST_TEST_EQ(checked_mul, unchecked_mul_res);
+
+    BOOST_TEST_EQ(signbit(checked_add), signbit(unchecked_add_res));
+    BOOST_TEST_EQ(signbit(checked_sub), signbit(unchecked_sub_res));
+    BOOST_TEST_EQ(signbit(checked_mul), signbit(unchecked_mul_res));
+}
+
+template <typename T>
+void test_type()
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        // Exponents close together, so that the operands interact, and far apart
+        test_against_operators(random_value<T>(5), random_value<T>(5));
+        test_against_operators(random_value<T>(50), random_value<T>(50));
+    }
+
+    const auto max {std::numeric_limits<T>::max()};
+    const auto min {std::numeric_limits<T>::min()};
+    const auto denorm_min {std::numeric_limits<T>::denorm_min()};
+    const T zero {0};
+
+    test_against_operators(zero, zero);
+    test_against_operators(-zero, zero);
+    test_against_operators(max, max);
+    test_against_operators(max, -max);
+    test_against_operators(min, denorm_min);
+    test_against_operators(min, T{1, -1});
+    test_against_operators(denorm_min, -denorm_min);
+
+    // Finite operands whose results overflow
+    test_against_operators(max, T{10});
+}
+
+constexpr auto constexpr_total() noexcept -> decimal64_t
+{
+    const decimal64_t price {1999, -2};
+    const decimal64_t quantity {3};
+    const decimal64_t fee {25, -2};
+
+    return unchecked_sub(unchecked_mul(price, quantity), unchecked_add(fee, fee));
+}
+
+int main()
+{
+    test_type<decimal32_t>();
+    test_type<decimal64_t>();
+    test_type<decimal128_t>();
+    test_type<decimal_fast32_t>();
+    test_type<decimal_fast64_t>();
+    test_type<decimal_fast128_t>();
+
+    static_assert(constexpr_total() == decimal64_t{5947, -2}, "Wrong value");
+
+    return boost::report_errors();
+}